@@ -1,122 +1,252 @@
 #include "DelaunayTetrahedralization.h"
+#include "GeometricPredicates.h"
+#include "Misc/MemStack.h"
 
 // ============================================================================
-// Helper types
+// Helpers
 // ============================================================================
 
-FDelaunayTetrahedralization::FFace::FFace(int32 A, int32 B, int32 C)
+namespace
 {
-	V[0] = A; V[1] = B; V[2] = C;
-	// Bubble sort 3 elements for canonical order
-	if (V[0] > V[1]) Swap(V[0], V[1]);
-	if (V[1] > V[2]) Swap(V[1], V[2]);
-	if (V[0] > V[1]) Swap(V[0], V[1]);
-}
+	/**
+	 * Vertices of the face opposite V[i], ordered so that Orient3D(face, V[i]) > 0 for a
+	 * positively oriented tetrahedron: a point is on the tetrahedron's side of face i exactly
+	 * when Orient3D(face, Point) > 0.
+	 */
+	constexpr int32 FaceVertices[4][3] = {
+		{ 1, 3, 2 },
+		{ 0, 2, 3 },
+		{ 0, 3, 1 },
+		{ 0, 1, 2 },
+	};
+
+	/** Bits per axis for Hilbert keys; 3 x 10 bits fits comfortably in a uint64. */
+	constexpr int32 HilbertBits = 10;
+
+	/** Position of (X, Y, Z) along a 3D Hilbert curve of HilbertBits per axis (Skilling's transform). */
+	uint64 HilbertIndex3D(uint32 X, uint32 Y, uint32 Z)
+	{
+		uint32 Axes[3] = { X, Y, Z };
+		const uint32 TopBit = 1u << (HilbertBits - 1);
 
-bool FDelaunayTetrahedralization::FFace::operator==(const FFace& Other) const
-{
-	return V[0] == Other.V[0] && V[1] == Other.V[1] && V[2] == Other.V[2];
-}
+		// Inverse undo excess work
+		for (uint32 Q = TopBit; Q > 1; Q >>= 1)
+		{
+			const uint32 LowMask = Q - 1;
+			for (int32 i = 0; i < 3; ++i)
+			{
+				if (Axes[i] & Q)
+				{
+					Axes[0] ^= LowMask;
+				}
+				else
+				{
+					const uint32 T = (Axes[0] ^ Axes[i]) & LowMask;
+					Axes[0] ^= T;
+					Axes[i] ^= T;
+				}
+			}
+		}
 
-FDelaunayTetrahedralization::FEdge::FEdge(int32 InA, int32 InB)
-	: A(FMath::Min(InA, InB))
-	, B(FMath::Max(InA, InB))
-{
-}
+		// Gray encode
+		Axes[1] ^= Axes[0];
+		Axes[2] ^= Axes[1];
+		uint32 T = 0;
+		for (uint32 Q = TopBit; Q > 1; Q >>= 1)
+		{
+			if (Axes[2] & Q)
+			{
+				T ^= Q - 1;
+			}
+		}
+		for (uint32& Axis : Axes)
+		{
+			Axis ^= T;
+		}
 
-bool FDelaunayTetrahedralization::FEdge::operator==(const FEdge& Other) const
-{
-	return A == Other.A && B == Other.B;
-}
+		// Interleave the transposed bits, most significant first
+		uint64 Key = 0;
+		for (int32 Bit = HilbertBits - 1; Bit >= 0; --Bit)
+		{
+			for (int32 i = 0; i < 3; ++i)
+			{
+				Key = (Key << 1) | ((Axes[i] >> Bit) & 1u);
+			}
+		}
+		return Key;
+	}
 
-bool FDelaunayTetrahedralization::FTetrahedron::ContainsVertex(int32 Idx) const
-{
-	return V[0] == Idx || V[1] == Idx || V[2] == Idx || V[3] == Idx;
+	/** SplitMix64 finalizer: a fixed, well-mixed coin source so insertion order is deterministic. */
+	FORCEINLINE uint64 MixIndex(uint64 Value)
+	{
+		Value += 0x9E3779B97F4A7C15ull;
+		Value = (Value ^ (Value >> 30)) * 0xBF58476D1CE4E5B9ull;
+		Value = (Value ^ (Value >> 27)) * 0x94D049BB133111EBull;
+		return Value ^ (Value >> 31);
+	}
+
+	FORCEINLINE int64 PackEdge(int32 A, int32 B)
+	{
+		return (static_cast<int64>(FMath::Min(A, B)) << 32) | static_cast<uint32>(FMath::Max(A, B));
+	}
+
+	/**
+	 * Open-addressed (linear probing) map from a packed cavity-boundary edge to the fan face still
+	 * waiting for its twin. Slots from earlier insertions are told apart by stamp, so clearing the
+	 * table between insertions is a counter increment. Every edge is looked up exactly twice, so a
+	 * matched slot is simply left in place.
+	 */
+	struct FOpenEdgeTable
+	{
+		struct FSlot
+		{
+			int64 Key;
+			uint32 Stamp;
+			int32 Tet;
+			int32 Face;
+		};
+
+		TArray<FSlot, TMemStackAllocator<>> Slots;
+		uint32 Mask = 0;
+
+		/** Room for NumEdges keys at no more than half load. Only call between insertions: growing forgets every slot. */
+		void Reserve(int32 NumEdges)
+		{
+			const uint32 Wanted = FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(NumEdges * 2, 64)));
+			if (static_cast<uint32>(Slots.Num()) < Wanted)
+			{
+				Slots.Reset();
+				Slots.SetNumZeroed(Wanted);
+				Mask = Wanted - 1;
+			}
+		}
+
+		/** The slot holding Key in this Stamp's insertion, or a fresh one claimed for it (bOutFound false). */
+		FSlot& FindOrAdd(int64 Key, uint32 Stamp, bool& bOutFound)
+		{
+			uint32 Index = static_cast<uint32>(MixIndex(Key)) & Mask;
+			while (Slots[Index].Stamp == Stamp)
+			{
+				if (Slots[Index].Key == Key)
+				{
+					bOutFound = true;
+					return Slots[Index];
+				}
+				Index = (Index + 1) & Mask;
+			}
+
+			bOutFound = false;
+			FSlot& Slot = Slots[Index];
+			Slot.Key = Key;
+			Slot.Stamp = Stamp;
+			return Slot;
+		}
+	};
 }
 
 // ============================================================================
-// Orientation test
+// Circumsphere test
 // ============================================================================
 
-double FDelaunayTetrahedralization::Orientation(
-	const FVector& A, const FVector& B,
-	const FVector& C, const FVector& D)
+bool FDelaunayTetrahedralization::IsInCircumsphere(
+	TArrayView<const FVector> Points,
+	const FTetrahedron& Tet,
+	int32 PointIdx)
 {
-	// dot(cross(B-A, C-A), D-A) — positive = right-handed orientation
-	const FVector AB(B.X - A.X, B.Y - A.Y, B.Z - A.Z);
-	const FVector AC(C.X - A.X, C.Y - A.Y, C.Z - A.Z);
-	const FVector AD(D.X - A.X, D.Y - A.Y, D.Z - A.Z);
-
-	const double CrossX = (double)AB.Y * AC.Z - (double)AB.Z * AC.Y;
-	const double CrossY = (double)AB.Z * AC.X - (double)AB.X * AC.Z;
-	const double CrossZ = (double)AB.X * AC.Y - (double)AB.Y * AC.X;
-
-	return CrossX * AD.X + CrossY * AD.Y + CrossZ * AD.Z;
+	// Every tetrahedron in the mesh is positively oriented, so the perturbed in-sphere sign
+	// answers directly. Cospherical points break ties by index, consistently across all tets.
+	return FGeometricPredicates::InSpherePerturbed(
+		Points, Tet.V[0], Tet.V[1], Tet.V[2], Tet.V[3], PointIdx) > 0;
 }
 
 // ============================================================================
-// Circumsphere test (4x4 determinant)
+// Insertion order & point location
 // ============================================================================
 
-namespace
+void FDelaunayTetrahedralization::ComputeInsertionOrder(
+	const TArray<FVector>& Points,
+	TArrayView<int32> OutOrder)
 {
-	FORCEINLINE double Det3x3(
-		double a, double b, double c,
-		double d, double e, double f,
-		double g, double h, double i)
+	FMemMark Mark(FMemStack::Get());
+	const int32 NumPoints = Points.Num();
+	check(OutOrder.Num() == NumPoints);
+
+	FVector Min = Points[0];
+	FVector Max = Points[0];
+	for (const FVector& P : Points)
 	{
-		return a * (e * i - f * h)
-		     - b * (d * i - f * g)
-		     + c * (d * h - e * g);
+		Min = Min.ComponentMin(P);
+		Max = Max.ComponentMax(P);
 	}
-}
+	const double Extent = FMath::Max(FMath::Max3(Max.X - Min.X, Max.Y - Min.Y, Max.Z - Min.Z), UE_DOUBLE_SMALL_NUMBER);
+	const double Scale = ((1 << HilbertBits) - 1) / Extent;
 
-bool FDelaunayTetrahedralization::IsInCircumsphere(
-	const TArray<FVector>& Points,
-	const FTetrahedron& Tet,
-	const FVector& P)
-{
-	// Coordinates relative to test point P
-	const FVector& A = Points[Tet.V[0]];
-	const FVector& B = Points[Tet.V[1]];
-	const FVector& C = Points[Tet.V[2]];
-	const FVector& D = Points[Tet.V[3]];
-
-	const double ax = A.X - P.X, ay = A.Y - P.Y, az = A.Z - P.Z;
-	const double bx = B.X - P.X, by = B.Y - P.Y, bz = B.Z - P.Z;
-	const double cx = C.X - P.X, cy = C.Y - P.Y, cz = C.Z - P.Z;
-	const double dx = D.X - P.X, dy = D.Y - P.Y, dz = D.Z - P.Z;
-
-	const double aw = ax * ax + ay * ay + az * az;
-	const double bw = bx * bx + by * by + bz * bz;
-	const double cw = cx * cx + cy * cy + cz * cz;
-	const double dw = dx * dx + dy * dy + dz * dz;
-
-	// 4x4 determinant via Laplace expansion along the 4th column:
-	// | ax ay az aw |
-	// | bx by bz bw |
-	// | cx cy cz cw |
-	// | dx dy dz dw |
-	const double det =
-		  aw * Det3x3(bx, by, bz, cx, cy, cz, dx, dy, dz)
-		- bw * Det3x3(ax, ay, az, cx, cy, cz, dx, dy, dz)
-		+ cw * Det3x3(ax, ay, az, bx, by, bz, dx, dy, dz)
-		- dw * Det3x3(ax, ay, az, bx, by, bz, cx, cy, cz);
-
-	// For a positively-oriented tetrahedron ABCD, det > 0 means P is inside circumsphere.
-	// Check the orientation of the tetrahedron and flip sign if needed.
-	const double Orient = Orientation(A, B, C, D);
-	if (Orient > 0.0)
+	// Round r holds about half the points of round r + 1 and goes in first; within a round,
+	// Hilbert order keeps consecutive points close so each walk is short
+	struct FOrderKey
 	{
-		return det > 0.0;
+		int32 Round;
+		uint64 Hilbert;
+		int32 Index;
+	};
+	TArray<FOrderKey, TMemStackAllocator<>> Keys;
+	Keys.SetNumUninitialized(NumPoints);
+	for (int32 i = 0; i < NumPoints; ++i)
+	{
+		const FVector Q = (Points[i] - Min) * Scale;
+		Keys[i].Round = static_cast<int32>(FMath::Min<uint64>(FMath::CountTrailingZeros64(MixIndex(i)), 16));
+		Keys[i].Hilbert = HilbertIndex3D(
+			static_cast<uint32>(Q.X), static_cast<uint32>(Q.Y), static_cast<uint32>(Q.Z));
+		Keys[i].Index = i;
 	}
-	else if (Orient < 0.0)
+
+	Keys.Sort([](const FOrderKey& A, const FOrderKey& B)
+	{
+		if (A.Round != B.Round) return A.Round > B.Round;
+		if (A.Hilbert != B.Hilbert) return A.Hilbert < B.Hilbert;
+		return A.Index < B.Index;
+	});
+
+	for (int32 i = 0; i < NumPoints; ++i)
 	{
-		return det < 0.0;
+		OutOrder[i] = Keys[i].Index;
 	}
+}
+
+int32 FDelaunayTetrahedralization::LocateTetrahedron(
+	TArrayView<const FVector> Points,
+	TArrayView<const FTetrahedron> Tetrahedra,
+	int32 StartTet,
+	const FVector& Point)
+{
+	// The walk terminates on a Delaunay mesh; the budget only guards against rounding loops.
+	const int32 MaxSteps = Tetrahedra.Num() * 4 + 16;
 
-	// Degenerate tetrahedron (zero volume) — treat as not containing the point
-	return false;
+	int32 Current = StartTet;
+	for (int32 Step = 1; Step <= MaxSteps; ++Step)
+	{
+		const FTetrahedron& Tet = Tetrahedra[Current];
+		int32 Next = INDEX_NONE;
+
+		// Rotate the first face tested so ties can't trap the walk in a cycle
+		for (int32 k = 0; k < 4; ++k)
+		{
+			const int32 Face = (k + Step) & 3;
+			const int32* FV = FaceVertices[Face];
+			if (FGeometricPredicates::Orient3D(Points[Tet.V[FV[0]]], Points[Tet.V[FV[1]]], Points[Tet.V[FV[2]]], Point) < 0.0)
+			{
+				Next = Tet.N[Face];
+				break;
+			}
+		}
+
+		if (Next == INDEX_NONE)
+		{
+			return Current;
+		}
+		Current = Next;
+	}
+	return INDEX_NONE;
 }
 
 // ============================================================================
@@ -150,8 +280,13 @@ void FDelaunayTetrahedralization::Tetrahedralize(
 		return;
 	}
 
+	// Everything below is scratch: take it all from this thread's FMemStack and release it at once
+	FMemMark Mark(FMemStack::Get());
+
 	// Build extended point array: original points + 4 super-tetrahedron vertices
-	TArray<FVector> AllPoints = Points;
+	TArray<FVector, TMemStackAllocator<>> AllPoints;
+	AllPoints.Reserve(NumPoints + 4);
+	AllPoints.Append(Points);
 
 	// Compute bounding box
 	FVector Min = Points[0];
@@ -183,17 +318,21 @@ void FDelaunayTetrahedralization::Tetrahedralize(
 	AllPoints.Add(Center + FVector(-Extent,  Extent, -Extent));
 
 	// Initial tetrahedralization with super-tetrahedron
-	TArray<FTetrahedron> Tetrahedra;
+	// About 6.5 live tetrahedra per point on typical input; reserving past that keeps the insertion
+	// loop from ever growing the array
+	TArray<FTetrahedron, TMemStackAllocator<>> Tetrahedra;
+	Tetrahedra.Reserve(NumPoints * 8 + 64);
 	{
 		FTetrahedron Super;
 		Super.V[0] = SuperA;
 		Super.V[1] = SuperB;
 		Super.V[2] = SuperC;
 		Super.V[3] = SuperD;
+		Super.N[0] = Super.N[1] = Super.N[2] = Super.N[3] = INDEX_NONE;
 
 		// Ensure positive orientation
-		if (Orientation(AllPoints[SuperA], AllPoints[SuperB],
-		                AllPoints[SuperC], AllPoints[SuperD]) < 0.0)
+		if (FGeometricPredicates::Orient3D(AllPoints[SuperA], AllPoints[SuperB],
+		                                   AllPoints[SuperC], AllPoints[SuperD]) < 0.0)
 		{
 			Swap(Super.V[2], Super.V[3]);
 		}
@@ -201,109 +340,220 @@ void FDelaunayTetrahedralization::Tetrahedralize(
 		Tetrahedra.Add(Super);
 	}
 
-	// Insert each point
-	for (int32 PointIdx = 0; PointIdx < NumPoints; ++PointIdx)
+	TArray<int32, TMemStackAllocator<>> InsertionOrder;
+	InsertionOrder.SetNumUninitialized(NumPoints);
+	ComputeInsertionOrder(Points, InsertionOrder);
+
+	// Per-insertion scratch, reset (never freed) between points. CavityStamp[t] == Stamp marks
+	// tet t as inside the current cavity; OpenEdges slots are only live for the current Stamp.
+	struct FBoundaryFace
+	{
+		int32 V[3];
+		int32 Outer;      // Tetrahedron on the far side, or INDEX_NONE
+		int32 OuterFace;  // Index in Outer.N that points back into the cavity
+	};
+	TArray<int32, TMemStackAllocator<>> Cavity;
+	TArray<FBoundaryFace, TMemStackAllocator<>> Boundary;
+	TArray<int32, TMemStackAllocator<>> FreeTets;
+	TArray<uint32, TMemStackAllocator<>> CavityStamp;
+	Cavity.Reserve(256);
+	Boundary.Reserve(256);
+	FreeTets.Reserve(256);
+	CavityStamp.SetNumZeroed(Tetrahedra.Max());
+	FOpenEdgeTable OpenEdges; // Cavity-boundary edge -> (new tet, local face)
+	OpenEdges.Reserve(Boundary.Max() * 3 / 2);
+	uint32 Stamp = 0;
+	int32 LastTet = 0;
+
+	for (const int32 PointIdx : InsertionOrder)
 	{
 		const FVector& P = AllPoints[PointIdx];
 
-		// Find bad tetrahedra (circumsphere contains the new point)
-		TArray<int32> BadIndices;
-		for (int32 i = 0; i < Tetrahedra.Num(); ++i)
+		// Locate by walking from the last tetrahedron created; fall back to a scan if rounding
+		// kept the walk from settling
+		int32 StartTet = LocateTetrahedron(AllPoints, Tetrahedra, LastTet, P);
+		if (StartTet == INDEX_NONE)
 		{
-			if (IsInCircumsphere(AllPoints, Tetrahedra[i], P))
+			for (int32 i = 0; i < Tetrahedra.Num(); ++i)
 			{
-				BadIndices.Add(i);
+				if (Tetrahedra[i].V[0] != INDEX_NONE && IsInCircumsphere(AllPoints, Tetrahedra[i], PointIdx))
+				{
+					StartTet = i;
+					break;
+				}
+			}
+			if (StartTet == INDEX_NONE)
+			{
+				// Point is outside all circumspheres — shouldn't happen with a proper super-tet
+				continue;
 			}
 		}
 
-		if (BadIndices.Num() == 0)
+		// Duplicate of an inserted point: nothing to add
+		const FTetrahedron& Located = Tetrahedra[StartTet];
+		if (AllPoints[Located.V[0]] == P || AllPoints[Located.V[1]] == P
+			|| AllPoints[Located.V[2]] == P || AllPoints[Located.V[3]] == P)
 		{
-			// Point is outside all circumspheres — shouldn't happen with a proper super-tet
 			continue;
 		}
 
-		// Extract boundary faces (faces appearing in exactly one bad tetrahedron)
-		TMap<FFace, int32> FaceCount;
-		for (int32 BadIdx : BadIndices)
+		// Grow the cavity by BFS from the containing tetrahedron. A neighbor joins if P is in its
+		// circumsphere, or if the face between them isn't strictly visible from P, which keeps the
+		// cavity star-shaped around P even when rounding misjudges a near-cospherical tet.
+		++Stamp;
+		Cavity.Reset();
+		Boundary.Reset();
+		Cavity.Add(StartTet);
+		CavityStamp[StartTet] = Stamp;
+		for (int32 c = 0; c < Cavity.Num(); ++c)
 		{
-			const FTetrahedron& BadTet = Tetrahedra[BadIdx];
-			FFace Faces[4] = {
-				FFace(BadTet.V[0], BadTet.V[1], BadTet.V[2]),
-				FFace(BadTet.V[0], BadTet.V[1], BadTet.V[3]),
-				FFace(BadTet.V[0], BadTet.V[2], BadTet.V[3]),
-				FFace(BadTet.V[1], BadTet.V[2], BadTet.V[3]),
-			};
-
-			for (const FFace& Face : Faces)
+			const FTetrahedron& Tet = Tetrahedra[Cavity[c]];
+			for (int32 Face = 0; Face < 4; ++Face)
 			{
-				int32& Count = FaceCount.FindOrAdd(Face, 0);
-				Count++;
+				const int32 Neighbor = Tet.N[Face];
+				if (Neighbor == INDEX_NONE || CavityStamp[Neighbor] == Stamp)
+				{
+					continue;
+				}
+				const int32* FV = FaceVertices[Face];
+				if (IsInCircumsphere(AllPoints, Tetrahedra[Neighbor], PointIdx)
+					|| FGeometricPredicates::Orient3D(AllPoints[Tet.V[FV[0]]], AllPoints[Tet.V[FV[1]]], AllPoints[Tet.V[FV[2]]], P) <= 0.0)
+				{
+					CavityStamp[Neighbor] = Stamp;
+					Cavity.Add(Neighbor);
+				}
 			}
 		}
 
-		TArray<FFace> BoundaryFaces;
-		for (const auto& Pair : FaceCount)
+		// Boundary faces: cavity faces whose neighbor stayed outside
+		for (const int32 TetIdx : Cavity)
 		{
-			if (Pair.Value == 1)
+			const FTetrahedron& Tet = Tetrahedra[TetIdx];
+			for (int32 Face = 0; Face < 4; ++Face)
 			{
-				BoundaryFaces.Add(Pair.Key);
+				const int32 Neighbor = Tet.N[Face];
+				if (Neighbor != INDEX_NONE && CavityStamp[Neighbor] == Stamp)
+				{
+					continue;
+				}
+
+				FBoundaryFace& BFace = Boundary.AddDefaulted_GetRef();
+				const int32* FV = FaceVertices[Face];
+				BFace.V[0] = Tet.V[FV[0]];
+				BFace.V[1] = Tet.V[FV[1]];
+				BFace.V[2] = Tet.V[FV[2]];
+				BFace.Outer = Neighbor;
+				BFace.OuterFace = INDEX_NONE;
+				if (Neighbor != INDEX_NONE)
+				{
+					const FTetrahedron& Outer = Tetrahedra[Neighbor];
+					for (int32 j = 0; j < 4; ++j)
+					{
+						if (Outer.N[j] == TetIdx)
+						{
+							BFace.OuterFace = j;
+							break;
+						}
+					}
+				}
 			}
 		}
 
-		// Remove bad tetrahedra (reverse order to preserve indices with RemoveAtSwap)
-		BadIndices.Sort([](int32 A, int32 B) { return A > B; });
-		for (int32 BadIdx : BadIndices)
+		// Remove the cavity
+		for (const int32 TetIdx : Cavity)
 		{
-			Tetrahedra.RemoveAtSwap(BadIdx);
+			Tetrahedra[TetIdx].V[0] = INDEX_NONE;
+			FreeTets.Add(TetIdx);
 		}
 
-		// Create new tetrahedra from each boundary face + the new point
-		for (const FFace& Face : BoundaryFaces)
+		// Fill it with a fan of tetrahedra from each boundary face to P. Each new tet's face
+		// opposite P faces the outer neighbor; the other three pair up across boundary edges,
+		// of which there are 3/2 per boundary face.
+		OpenEdges.Reserve(Boundary.Num() * 3 / 2);
+		for (const FBoundaryFace& BFace : Boundary)
 		{
-			FTetrahedron NewTet;
-			NewTet.V[0] = Face.V[0];
-			NewTet.V[1] = Face.V[1];
-			NewTet.V[2] = Face.V[2];
+			int32 NewIdx;
+			if (FreeTets.Num() > 0)
+			{
+				NewIdx = FreeTets.Pop(EAllowShrinking::No);
+			}
+			else
+			{
+				NewIdx = Tetrahedra.AddUninitialized();
+				if (CavityStamp.Num() < Tetrahedra.Num())
+				{
+					CavityStamp.SetNumZeroed(Tetrahedra.Max());
+				}
+			}
+
+			FTetrahedron& NewTet = Tetrahedra[NewIdx];
+			NewTet.V[0] = BFace.V[0];
+			NewTet.V[1] = BFace.V[1];
+			NewTet.V[2] = BFace.V[2];
 			NewTet.V[3] = PointIdx;
+			NewTet.N[0] = NewTet.N[1] = NewTet.N[2] = INDEX_NONE;
+			NewTet.N[3] = BFace.Outer;
+			if (BFace.Outer != INDEX_NONE)
+			{
+				Tetrahedra[BFace.Outer].N[BFace.OuterFace] = NewIdx;
+			}
 
-			// Ensure positive orientation
-			if (Orientation(AllPoints[NewTet.V[0]], AllPoints[NewTet.V[1]],
-			                AllPoints[NewTet.V[2]], AllPoints[NewTet.V[3]]) < 0.0)
+			for (int32 Local = 0; Local < 3; ++Local)
 			{
-				Swap(NewTet.V[1], NewTet.V[2]);
+				// Face opposite V[Local] holds P and the boundary edge between the other two
+				bool bFound;
+				FOpenEdgeTable::FSlot& Open = OpenEdges.FindOrAdd(
+					PackEdge(NewTet.V[(Local + 1) % 3], NewTet.V[(Local + 2) % 3]), Stamp, bFound);
+				if (bFound)
+				{
+					NewTet.N[Local] = Open.Tet;
+					Tetrahedra[Open.Tet].N[Open.Face] = NewIdx;
+				}
+				else
+				{
+					Open.Tet = NewIdx;
+					Open.Face = Local;
+				}
 			}
 
-			Tetrahedra.Add(NewTet);
+			LastTet = NewIdx;
 		}
 	}
 
 	// Extract unique edges between original points from ALL tetrahedra
 	// (including those containing super-tet vertices — we just skip super-tet endpoints)
-	TSet<FEdge> UniqueEdges;
+	TArray<int64, TMemStackAllocator<>> PackedEdges;
+	PackedEdges.Reserve(Tetrahedra.Num() * 6);
 	for (const FTetrahedron& Tet : Tetrahedra)
 	{
+		if (Tet.V[0] == INDEX_NONE)
+		{
+			continue;
+		}
+
 		// A tetrahedron has 6 edges — only keep edges where both endpoints are original points
-		const int32 Verts[4] = { Tet.V[0], Tet.V[1], Tet.V[2], Tet.V[3] };
 		for (int32 i = 0; i < 4; ++i)
 		{
 			for (int32 j = i + 1; j < 4; ++j)
 			{
-				if (Verts[i] < NumPoints && Verts[j] < NumPoints)
+				if (Tet.V[i] < NumPoints && Tet.V[j] < NumPoints)
 				{
-					UniqueEdges.Add(FEdge(Verts[i], Verts[j]));
+					PackedEdges.Add(PackEdge(Tet.V[i], Tet.V[j]));
 				}
 			}
 		}
 	}
 
-	for (const FEdge& Edge : UniqueEdges)
+	// Sort for determinism, then drop the copies shared between tetrahedra
+	PackedEdges.Sort();
+	for (int32 i = 0; i < PackedEdges.Num(); ++i)
 	{
-		OutEdges.Add(TPair<int32, int32>(Edge.A, Edge.B));
+		if (i > 0 && PackedEdges[i] == PackedEdges[i - 1])
+		{
+			continue;
+		}
+		OutEdges.Add(TPair<int32, int32>(
+			static_cast<int32>(PackedEdges[i] >> 32),
+			static_cast<int32>(PackedEdges[i] & 0xFFFFFFFF)));
 	}
-
-	// Sort for determinism (TSet iteration order is not guaranteed)
-	OutEdges.Sort([](const TPair<int32, int32>& A, const TPair<int32, int32>& B)
-	{
-		return A.Key < B.Key || (A.Key == B.Key && A.Value < B.Value);
-	});
 }
@@ -1,57 +1,154 @@
 #include "DelaunayTriangulation.h"
+#include "GeometricPredicates.h"
 
 // ============================================================================
-// FEdge
+// Helpers
 // ============================================================================
 
-FDelaunayTriangulation::FEdge::FEdge(int32 InA, int32 InB)
-	: A(FMath::Min(InA, InB))
-	, B(FMath::Max(InA, InB))
+namespace
 {
-}
+	/** Bits per axis for Hilbert keys. */
+	constexpr int32 HilbertBits = 16;
 
-bool FDelaunayTriangulation::FEdge::operator==(const FEdge& Other) const
-{
-	return A == Other.A && B == Other.B;
+	/** Position of (X, Y) along a 2D Hilbert curve of HilbertBits per axis. */
+	uint64 HilbertIndex2D(uint32 X, uint32 Y)
+	{
+		uint64 Key = 0;
+		for (uint32 S = 1u << (HilbertBits - 1); S > 0; S >>= 1)
+		{
+			const uint32 RX = (X & S) ? 1u : 0u;
+			const uint32 RY = (Y & S) ? 1u : 0u;
+			Key += static_cast<uint64>(S) * S * ((3u * RX) ^ RY);
+
+			// Rotate the quadrant so the curve stays continuous
+			if (RY == 0)
+			{
+				if (RX == 1)
+				{
+					X = S - 1 - (X & (S - 1));
+					Y = S - 1 - (Y & (S - 1));
+				}
+				Swap(X, Y);
+			}
+		}
+		return Key;
+	}
+
+	/** SplitMix64 finalizer: a fixed, well-mixed coin source so insertion order is deterministic. */
+	FORCEINLINE uint64 MixIndex(uint64 Value)
+	{
+		Value += 0x9E3779B97F4A7C15ull;
+		Value = (Value ^ (Value >> 30)) * 0xBF58476D1CE4E5B9ull;
+		Value = (Value ^ (Value >> 27)) * 0x94D049BB133111EBull;
+		return Value ^ (Value >> 31);
+	}
+
+	FORCEINLINE int64 PackEdge(int32 A, int32 B)
+	{
+		return (static_cast<int64>(FMath::Min(A, B)) << 32) | static_cast<uint32>(FMath::Max(A, B));
+	}
 }
 
 // ============================================================================
-// FTriangle
+// Circumcircle test
 // ============================================================================
 
-bool FDelaunayTriangulation::FTriangle::ContainsVertex(int32 Idx) const
+bool FDelaunayTriangulation::IsInCircumcircle(
+	const TArray<FVector2D>& Points,
+	const FTriangle& Tri,
+	int32 PointIdx)
 {
-	return V[0] == Idx || V[1] == Idx || V[2] == Idx;
+	// Every triangle in the mesh is counter-clockwise, so the perturbed in-circle sign
+	// answers directly. Cocircular points break ties by index, consistently across all triangles.
+	return FGeometricPredicates::InCirclePerturbed(
+		Points, Tri.V[0], Tri.V[1], Tri.V[2], PointIdx) > 0;
 }
 
 // ============================================================================
-// Circumcircle test
+// Insertion order & point location
 // ============================================================================
 
-bool FDelaunayTriangulation::IsInCircumcircle(
+void FDelaunayTriangulation::ComputeInsertionOrder(
 	const TArray<FVector2D>& Points,
-	const FTriangle& Tri,
-	const FVector2D& P)
+	TArray<int32>& OutOrder)
 {
-	// Incircle test via 3x3 determinant (coordinates relative to P).
-	// For CCW-oriented triangle ABC, det > 0 means P is inside circumcircle.
-	const FVector2D& A = Points[Tri.V[0]];
-	const FVector2D& B = Points[Tri.V[1]];
-	const FVector2D& C = Points[Tri.V[2]];
+	const int32 NumPoints = Points.Num();
 
-	const double ax = A.X - P.X, ay = A.Y - P.Y;
-	const double bx = B.X - P.X, by = B.Y - P.Y;
-	const double cx = C.X - P.X, cy = C.Y - P.Y;
+	FVector2D Min = Points[0];
+	FVector2D Max = Points[0];
+	for (const FVector2D& P : Points)
+	{
+		Min = FVector2D::Min(Min, P);
+		Max = FVector2D::Max(Max, P);
+	}
+	const double Extent = FMath::Max3(Max.X - Min.X, Max.Y - Min.Y, UE_DOUBLE_SMALL_NUMBER);
+	const double Scale = ((1 << HilbertBits) - 1) / Extent;
 
-	const double aSq = ax * ax + ay * ay;
-	const double bSq = bx * bx + by * by;
-	const double cSq = cx * cx + cy * cy;
+	// Same BRIO rounds as the tetrahedralizer: round r holds about half the points of round r + 1
+	// and goes in first; within a round, Hilbert order keeps consecutive points close
+	struct FOrderKey
+	{
+		int32 Round;
+		uint64 Hilbert;
+		int32 Index;
+	};
+	TArray<FOrderKey> Keys;
+	Keys.SetNumUninitialized(NumPoints);
+	for (int32 i = 0; i < NumPoints; ++i)
+	{
+		const FVector2D Q = (Points[i] - Min) * Scale;
+		Keys[i].Round = static_cast<int32>(FMath::Min<uint64>(FMath::CountTrailingZeros64(MixIndex(i)), 16));
+		Keys[i].Hilbert = HilbertIndex2D(static_cast<uint32>(Q.X), static_cast<uint32>(Q.Y));
+		Keys[i].Index = i;
+	}
+
+	Keys.Sort([](const FOrderKey& A, const FOrderKey& B)
+	{
+		if (A.Round != B.Round) return A.Round > B.Round;
+		if (A.Hilbert != B.Hilbert) return A.Hilbert < B.Hilbert;
+		return A.Index < B.Index;
+	});
+
+	OutOrder.SetNumUninitialized(NumPoints);
+	for (int32 i = 0; i < NumPoints; ++i)
+	{
+		OutOrder[i] = Keys[i].Index;
+	}
+}
+
+int32 FDelaunayTriangulation::LocateTriangle(
+	const TArray<FVector2D>& Points,
+	const TArray<FTriangle>& Triangles,
+	int32 StartTri,
+	const FVector2D& Point)
+{
+	// The walk terminates on a Delaunay mesh; the budget only guards against rounding loops.
+	const int32 MaxSteps = Triangles.Num() * 3 + 16;
+
+	int32 Current = StartTri;
+	for (int32 Step = 1; Step <= MaxSteps; ++Step)
+	{
+		const FTriangle& Tri = Triangles[Current];
+		int32 Next = INDEX_NONE;
 
-	const double det = ax * (by * cSq - cy * bSq)
-	                 - bx * (ay * cSq - cy * aSq)
-	                 + cx * (ay * bSq - by * aSq);
+		// Rotate the first edge tested so ties can't trap the walk in a cycle
+		for (int32 k = 0; k < 3; ++k)
+		{
+			const int32 Edge = (k + Step) % 3;
+			if (FGeometricPredicates::Orient2D(Points[Tri.V[(Edge + 1) % 3]], Points[Tri.V[(Edge + 2) % 3]], Point) < 0.0)
+			{
+				Next = Tri.N[Edge];
+				break;
+			}
+		}
 
-	return det > 0.0;
+		if (Next == INDEX_NONE)
+		{
+			return Current;
+		}
+		Current = Next;
+	}
+	return INDEX_NONE;
 }
 
 // ============================================================================
@@ -93,7 +190,8 @@ void FDelaunayTriangulation::Triangulate(
 
 	const double DeltaX = Max.X - Min.X;
 	const double DeltaY = Max.Y - Min.Y;
-	const double DeltaMax = FMath::Max(DeltaX, DeltaY);
+	double DeltaMax = FMath::Max(DeltaX, DeltaY);
+	if (DeltaMax < 1.0) DeltaMax = 100.0;
 	const double MidX = (Min.X + Max.X) * 0.5;
 	const double MidY = (Min.Y + Max.Y) * 0.5;
 
@@ -106,148 +204,230 @@ void FDelaunayTriangulation::Triangulate(
 	AllPoints.Add(FVector2D(MidX + 2.0 * DeltaMax, MidY - DeltaMax));
 	AllPoints.Add(FVector2D(MidX, MidY + 2.0 * DeltaMax));
 
-	// Ensure super-triangle is CCW
-	// Cross product (B-A) x (C-A) should be positive
-	{
-		const FVector2D& SA = AllPoints[SuperA];
-		const FVector2D& SB = AllPoints[SuperB];
-		const FVector2D& SC = AllPoints[SuperC];
-		const double Cross = (SB.X - SA.X) * (SC.Y - SA.Y) - (SB.Y - SA.Y) * (SC.X - SA.X);
-		if (Cross < 0.0)
-		{
-			AllPoints.Swap(SuperB, SuperC);
-		}
-	}
-
 	// Initial triangulation with super-triangle
 	TArray<FTriangle> Triangles;
+	Triangles.Reserve(NumPoints * 2 + 1);
 	{
 		FTriangle Super;
 		Super.V[0] = SuperA;
 		Super.V[1] = SuperB;
 		Super.V[2] = SuperC;
+		Super.N[0] = Super.N[1] = Super.N[2] = INDEX_NONE;
+
+		// Ensure CCW winding
+		if (FGeometricPredicates::Orient2D(AllPoints[SuperA], AllPoints[SuperB], AllPoints[SuperC]) < 0.0)
+		{
+			Swap(Super.V[1], Super.V[2]);
+		}
+
 		Triangles.Add(Super);
 	}
 
-	// Insert each point
-	for (int32 PointIdx = 0; PointIdx < NumPoints; ++PointIdx)
+	TArray<int32> InsertionOrder;
+	ComputeInsertionOrder(Points, InsertionOrder);
+
+	// Per-insertion scratch, reused across points. CavityStamp[t] == Stamp marks triangle t as
+	// inside the current cavity; OpenLinks[v] holds the fan edge through v still waiting for its twin.
+	struct FBoundaryEdge
+	{
+		int32 A, B;       // Counter-clockwise as seen from inside the cavity
+		int32 Outer;      // Triangle on the far side, or INDEX_NONE
+		int32 OuterEdge;  // Index in Outer.N that points back into the cavity
+	};
+	struct FOpenLink
+	{
+		uint32 Stamp;
+		int32 Tri;
+		int32 Local;
+	};
+	TArray<int32> Cavity;
+	TArray<FBoundaryEdge> Boundary;
+	TArray<int32> FreeTris;
+	TArray<uint32> CavityStamp;
+	CavityStamp.Init(0, Triangles.Max());
+	TArray<FOpenLink> OpenLinks;
+	OpenLinks.Init(FOpenLink{ 0, INDEX_NONE, INDEX_NONE }, AllPoints.Num());
+	uint32 Stamp = 0;
+	int32 LastTri = 0;
+
+	for (const int32 PointIdx : InsertionOrder)
 	{
 		const FVector2D& P = AllPoints[PointIdx];
 
-		// Find all triangles whose circumcircle contains P
-		TArray<FTriangle> BadTriangles;
-		for (const FTriangle& Tri : Triangles)
+		// Locate by walking from the last triangle created; fall back to a scan if rounding
+		// kept the walk from settling
+		int32 StartTri = LocateTriangle(AllPoints, Triangles, LastTri, P);
+		if (StartTri == INDEX_NONE)
 		{
-			if (IsInCircumcircle(AllPoints, Tri, P))
+			for (int32 i = 0; i < Triangles.Num(); ++i)
+			{
+				if (Triangles[i].V[0] != INDEX_NONE && IsInCircumcircle(AllPoints, Triangles[i], PointIdx))
+				{
+					StartTri = i;
+					break;
+				}
+			}
+			if (StartTri == INDEX_NONE)
 			{
-				BadTriangles.Add(Tri);
+				// Point is outside all circumcircles — shouldn't happen with a proper super-triangle
+				continue;
 			}
 		}
 
-		// Find boundary polygon (edges of bad triangles not shared with other bad triangles)
-		TArray<FEdge> BoundaryPolygon;
-		for (int32 i = 0; i < BadTriangles.Num(); ++i)
+		// Duplicate of an inserted point: nothing to add
+		const FTriangle& Located = Triangles[StartTri];
+		if (AllPoints[Located.V[0]] == P || AllPoints[Located.V[1]] == P || AllPoints[Located.V[2]] == P)
 		{
-			const FTriangle& BadTri = BadTriangles[i];
-
-			FEdge Edges[3] = {
-				FEdge(BadTri.V[0], BadTri.V[1]),
-				FEdge(BadTri.V[1], BadTri.V[2]),
-				FEdge(BadTri.V[2], BadTri.V[0]),
-			};
+			continue;
+		}
 
-			for (const FEdge& Edge : Edges)
+		// Grow the cavity by BFS from the containing triangle. A neighbor joins if P is in its
+		// circumcircle, or if the edge between them isn't strictly visible from P, which keeps the
+		// cavity star-shaped around P.
+		++Stamp;
+		Cavity.Reset();
+		Boundary.Reset();
+		Cavity.Add(StartTri);
+		CavityStamp[StartTri] = Stamp;
+		for (int32 c = 0; c < Cavity.Num(); ++c)
+		{
+			const FTriangle& Tri = Triangles[Cavity[c]];
+			for (int32 Edge = 0; Edge < 3; ++Edge)
 			{
-				bool bShared = false;
-				for (int32 j = 0; j < BadTriangles.Num(); ++j)
+				const int32 Neighbor = Tri.N[Edge];
+				if (Neighbor == INDEX_NONE || CavityStamp[Neighbor] == Stamp)
+				{
+					continue;
+				}
+				if (IsInCircumcircle(AllPoints, Triangles[Neighbor], PointIdx)
+					|| FGeometricPredicates::Orient2D(AllPoints[Tri.V[(Edge + 1) % 3]], AllPoints[Tri.V[(Edge + 2) % 3]], P) <= 0.0)
 				{
-					if (i == j) continue;
+					CavityStamp[Neighbor] = Stamp;
+					Cavity.Add(Neighbor);
+				}
+			}
+		}
 
-					const FTriangle& OtherTri = BadTriangles[j];
-					FEdge OtherEdges[3] = {
-						FEdge(OtherTri.V[0], OtherTri.V[1]),
-						FEdge(OtherTri.V[1], OtherTri.V[2]),
-						FEdge(OtherTri.V[2], OtherTri.V[0]),
-					};
+		// Boundary edges: cavity edges whose neighbor stayed outside
+		for (const int32 TriIdx : Cavity)
+		{
+			const FTriangle& Tri = Triangles[TriIdx];
+			for (int32 Edge = 0; Edge < 3; ++Edge)
+			{
+				const int32 Neighbor = Tri.N[Edge];
+				if (Neighbor != INDEX_NONE && CavityStamp[Neighbor] == Stamp)
+				{
+					continue;
+				}
 
-					for (const FEdge& OtherEdge : OtherEdges)
+				FBoundaryEdge& BEdge = Boundary.AddDefaulted_GetRef();
+				BEdge.A = Tri.V[(Edge + 1) % 3];
+				BEdge.B = Tri.V[(Edge + 2) % 3];
+				BEdge.Outer = Neighbor;
+				BEdge.OuterEdge = INDEX_NONE;
+				if (Neighbor != INDEX_NONE)
+				{
+					const FTriangle& Outer = Triangles[Neighbor];
+					for (int32 j = 0; j < 3; ++j)
 					{
-						if (Edge == OtherEdge)
+						if (Outer.N[j] == TriIdx)
 						{
-							bShared = true;
+							BEdge.OuterEdge = j;
 							break;
 						}
 					}
-					if (bShared) break;
-				}
-
-				if (!bShared)
-				{
-					BoundaryPolygon.Add(Edge);
 				}
 			}
 		}
 
-		// Remove bad triangles
-		for (const FTriangle& BadTri : BadTriangles)
+		// Remove the cavity
+		for (const int32 TriIdx : Cavity)
 		{
-			Triangles.RemoveAll([&BadTri](const FTriangle& T)
-			{
-				return T.V[0] == BadTri.V[0] && T.V[1] == BadTri.V[1] && T.V[2] == BadTri.V[2];
-			});
+			Triangles[TriIdx].V[0] = INDEX_NONE;
+			FreeTris.Add(TriIdx);
 		}
 
-		// Create new triangles from boundary edges to the inserted point
-		for (const FEdge& Edge : BoundaryPolygon)
+		// Fill it with a fan of triangles (A, B, P). The edge opposite P faces the outer neighbor;
+		// the edge opposite A (through B) pairs with the fan triangle whose A is this B, and vice versa.
+		for (const FBoundaryEdge& BEdge : Boundary)
 		{
-			FTriangle NewTri;
-
-			// Ensure CCW winding
-			const FVector2D& EA = AllPoints[Edge.A];
-			const FVector2D& EB = AllPoints[Edge.B];
-			const double Cross = (EB.X - EA.X) * (P.Y - EA.Y)
-			                   - (EB.Y - EA.Y) * (P.X - EA.X);
-
-			if (Cross > 0.0)
+			int32 NewIdx;
+			if (FreeTris.Num() > 0)
 			{
-				NewTri.V[0] = Edge.A;
-				NewTri.V[1] = Edge.B;
-				NewTri.V[2] = PointIdx;
+				NewIdx = FreeTris.Pop(EAllowShrinking::No);
 			}
 			else
 			{
-				NewTri.V[0] = Edge.B;
-				NewTri.V[1] = Edge.A;
-				NewTri.V[2] = PointIdx;
+				NewIdx = Triangles.AddUninitialized();
+				if (CavityStamp.Num() < Triangles.Num())
+				{
+					CavityStamp.SetNumZeroed(Triangles.Max());
+				}
+			}
+
+			FTriangle& NewTri = Triangles[NewIdx];
+			NewTri.V[0] = BEdge.A;
+			NewTri.V[1] = BEdge.B;
+			NewTri.V[2] = PointIdx;
+			NewTri.N[0] = NewTri.N[1] = INDEX_NONE;
+			NewTri.N[2] = BEdge.Outer;
+			if (BEdge.Outer != INDEX_NONE)
+			{
+				Triangles[BEdge.Outer].N[BEdge.OuterEdge] = NewIdx;
+			}
+
+			for (int32 Local = 0; Local < 2; ++Local)
+			{
+				// Edge opposite V[Local] joins P to the other boundary vertex
+				FOpenLink& Link = OpenLinks[NewTri.V[1 - Local]];
+				if (Link.Stamp == Stamp)
+				{
+					NewTri.N[Local] = Link.Tri;
+					Triangles[Link.Tri].N[Link.Local] = NewIdx;
+					Link.Stamp = 0;
+				}
+				else
+				{
+					Link = FOpenLink{ Stamp, NewIdx, Local };
+				}
 			}
 
-			Triangles.Add(NewTri);
+			LastTri = NewIdx;
 		}
 	}
 
-	// Remove triangles that share a vertex with the super-triangle
-	Triangles.RemoveAll([SuperA, SuperB, SuperC](const FTriangle& T)
-	{
-		return T.ContainsVertex(SuperA) || T.ContainsVertex(SuperB) || T.ContainsVertex(SuperC);
-	});
-
-	// Extract unique edges from remaining triangles
-	TSet<FEdge> UniqueEdges;
+	// Extract unique edges between original points from ALL triangles
+	// (including those containing super-triangle vertices — we just skip super endpoints)
+	TArray<int64> PackedEdges;
+	PackedEdges.Reserve(Triangles.Num() * 3);
 	for (const FTriangle& Tri : Triangles)
 	{
-		UniqueEdges.Add(FEdge(Tri.V[0], Tri.V[1]));
-		UniqueEdges.Add(FEdge(Tri.V[1], Tri.V[2]));
-		UniqueEdges.Add(FEdge(Tri.V[2], Tri.V[0]));
-	}
+		if (Tri.V[0] == INDEX_NONE)
+		{
+			continue;
+		}
 
-	for (const FEdge& Edge : UniqueEdges)
-	{
-		OutEdges.Add(TPair<int32, int32>(Edge.A, Edge.B));
+		for (int32 i = 0; i < 3; ++i)
+		{
+			const int32 A = Tri.V[i];
+			const int32 B = Tri.V[(i + 1) % 3];
+			if (A < NumPoints && B < NumPoints)
+			{
+				PackedEdges.Add(PackEdge(A, B));
+			}
+		}
 	}
 
-	// Sort edges for determinism (TSet iteration order is not guaranteed)
-	OutEdges.Sort([](const TPair<int32, int32>& A, const TPair<int32, int32>& B)
+	// Sort for determinism, then drop the copies shared between triangles
+	PackedEdges.Sort();
+	for (int32 i = 0; i < PackedEdges.Num(); ++i)
 	{
-		return A.Key < B.Key || (A.Key == B.Key && A.Value < B.Value);
-	});
+		if (i > 0 && PackedEdges[i] == PackedEdges[i - 1])
+		{
+			continue;
+		}
+		OutEdges.Add(TPair<int32, int32>(
+			static_cast<int32>(PackedEdges[i] >> 32),
+			static_cast<int32>(PackedEdges[i] & 0xFFFFFFFF)));
+	}
 }
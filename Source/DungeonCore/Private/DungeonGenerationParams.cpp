@@ -0,0 +1,147 @@
+#include "DungeonGenerationParams.h"
+#include "DungeonConfig.h"
+
+namespace
+{
+	// Bump when fields are added, removed, or reordered so persisted hashes are invalidated.
+	constexpr int32 ParamsHashVersion = 9;
+
+	/** 64-bit FNV-1a over explicitly serialized values (no struct padding, fixed byte order). */
+	struct FStableHasher
+	{
+		uint64 Hash = 0xcbf29ce484222325ull;
+
+		void AddByte(uint8 Byte)
+		{
+			Hash ^= Byte;
+			Hash *= 0x100000001b3ull;
+		}
+
+		void AddInt(int32 Value)
+		{
+			const uint32 Bits = static_cast<uint32>(Value);
+			AddByte(static_cast<uint8>(Bits));
+			AddByte(static_cast<uint8>(Bits >> 8));
+			AddByte(static_cast<uint8>(Bits >> 16));
+			AddByte(static_cast<uint8>(Bits >> 24));
+		}
+
+		void AddFloat(float Value)
+		{
+			int32 Bits;
+			FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+			AddInt(Bits);
+		}
+
+		void AddBool(bool bValue)
+		{
+			AddByte(bValue ? 1 : 0);
+		}
+
+		void AddVector(const FIntVector& Value)
+		{
+			AddInt(Value.X);
+			AddInt(Value.Y);
+			AddInt(Value.Z);
+		}
+	};
+}
+
+FDungeonGenerationParams FDungeonGenerationParams::FromConfig(const UDungeonConfiguration& Config)
+{
+	FDungeonGenerationParams Params;
+
+	Params.GridSize = Config.GridSize;
+	Params.CellWorldSize = Config.CellWorldSize;
+
+	Params.RoomCount = Config.RoomCount;
+	Params.MinRoomSize = Config.MinRoomSize;
+	Params.MaxRoomSize = Config.MaxRoomSize;
+	Params.RoomBuffer = Config.RoomBuffer;
+	Params.MaxPlacementAttempts = Config.MaxPlacementAttempts;
+	Params.RoomPlacementMode = Config.RoomPlacementMode;
+	Params.RoomCenterSpacing = Config.RoomCenterSpacing;
+
+	Params.RoomTypeRules = Config.RoomTypeRules;
+	Params.bGuaranteeEntrance = Config.bGuaranteeEntrance;
+	Params.bGuaranteeBossRoom = Config.bGuaranteeBossRoom;
+
+	Params.RoomGraphMode = Config.RoomGraphMode;
+	Params.NeighborCount = Config.NeighborCount;
+	Params.NeighborPruning = Config.NeighborPruning;
+	Params.EdgeReadditionChance = Config.EdgeReadditionChance;
+	Params.HallwayMergeCostMultiplier = Config.HallwayMergeCostMultiplier;
+	Params.RoomPassthroughCostMultiplier = Config.RoomPassthroughCostMultiplier;
+	Params.bBoundHallwaySearch = Config.bBoundHallwaySearch;
+	Params.HallwaySearchMargin = Config.HallwaySearchMargin;
+	Params.HallwaySearchMode = Config.HallwaySearchMode;
+	Params.BidirectionalMinDistance = Config.BidirectionalMinDistance;
+	Params.bUseRadixOpenSet = Config.bUseRadixOpenSet;
+	Params.bMultiGoalHallwaySearch = Config.bMultiGoalHallwaySearch;
+	Params.HierarchicalClusterSize = Config.HierarchicalClusterSize;
+	Params.bSpeculativeHallwayCarving = Config.bSpeculativeHallwayCarving;
+	Params.SpeculativeHallwayBatchSize = Config.SpeculativeHallwayBatchSize;
+
+	Params.StaircaseRiseToRun = Config.StaircaseRiseToRun;
+	Params.StaircaseHeadroom = Config.StaircaseHeadroom;
+
+	Params.EntrancePlacement = Config.EntrancePlacement;
+
+	return Params;
+}
+
+uint64 FDungeonGenerationParams::GetStableHash() const
+{
+	FStableHasher Hasher;
+	Hasher.AddInt(ParamsHashVersion);
+
+	Hasher.AddVector(GridSize);
+	Hasher.AddFloat(CellWorldSize);
+
+	Hasher.AddInt(RoomCount);
+	Hasher.AddVector(MinRoomSize);
+	Hasher.AddVector(MaxRoomSize);
+	Hasher.AddInt(RoomBuffer);
+	Hasher.AddInt(MaxPlacementAttempts);
+	Hasher.AddByte(static_cast<uint8>(RoomPlacementMode));
+	Hasher.AddFloat(RoomCenterSpacing);
+
+	// Rule order matters (stable sort by priority keeps ties in array order)
+	Hasher.AddInt(RoomTypeRules.Num());
+	for (const FDungeonRoomTypeRule& Rule : RoomTypeRules)
+	{
+		Hasher.AddByte(static_cast<uint8>(Rule.RoomType));
+		Hasher.AddInt(Rule.Count);
+		Hasher.AddInt(Rule.Priority);
+		Hasher.AddFloat(Rule.MinGraphDistanceFromEntrance);
+		Hasher.AddFloat(Rule.MaxGraphDistanceFromEntrance);
+		Hasher.AddBool(Rule.bPreferLeafNodes);
+		Hasher.AddBool(Rule.bPreferMainPath);
+		Hasher.AddBool(Rule.bRequireMultiFloor);
+		Hasher.AddVector(Rule.MinSize);
+	}
+	Hasher.AddBool(bGuaranteeEntrance);
+	Hasher.AddBool(bGuaranteeBossRoom);
+
+	Hasher.AddByte(static_cast<uint8>(RoomGraphMode));
+	Hasher.AddInt(NeighborCount);
+	Hasher.AddByte(static_cast<uint8>(NeighborPruning));
+	Hasher.AddFloat(EdgeReadditionChance);
+	Hasher.AddFloat(HallwayMergeCostMultiplier);
+	Hasher.AddFloat(RoomPassthroughCostMultiplier);
+	Hasher.AddBool(bBoundHallwaySearch);
+	Hasher.AddInt(HallwaySearchMargin);
+	Hasher.AddByte(static_cast<uint8>(HallwaySearchMode));
+	Hasher.AddInt(BidirectionalMinDistance);
+	Hasher.AddBool(bUseRadixOpenSet);
+	Hasher.AddBool(bMultiGoalHallwaySearch);
+	Hasher.AddInt(HierarchicalClusterSize);
+	// bSpeculativeHallwayCarving / SpeculativeHallwayBatchSize only change how hallways are scheduled, never the layout
+
+	Hasher.AddInt(StaircaseRiseToRun);
+	Hasher.AddInt(StaircaseHeadroom);
+
+	Hasher.AddByte(static_cast<uint8>(EntrancePlacement));
+
+	return Hasher.Hash;
+}
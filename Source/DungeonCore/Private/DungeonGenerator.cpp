@@ -1,15 +1,119 @@
 #include "DungeonGenerator.h"
 #include "DungeonConfig.h"
+#include "DungeonGenerationParams.h"
 #include "DungeonSeed.h"
 #include "RoomPlacement.h"
+#include "DelaunayTriangulation.h"
 #include "DelaunayTetrahedralization.h"
+#include "NeighborGraph.h"
 #include "MinimumSpanningTree.h"
 #include "HallwayPathfinder.h"
 #include "RoomSemantics.h"
 #include "DungeonValidator.h"
+#include "DungeonStats.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogDungeonGenerator, Log, All);
 
+DECLARE_CYCLE_STAT(TEXT("Generate"), STAT_Dungeon_Generate, STATGROUP_Dungeon);
+DECLARE_CYCLE_STAT(TEXT("Room Placement"), STAT_Dungeon_RoomPlacement, STATGROUP_Dungeon);
+DECLARE_CYCLE_STAT(TEXT("Entrance Selection"), STAT_Dungeon_EntranceSelection, STATGROUP_Dungeon);
+DECLARE_CYCLE_STAT(TEXT("Tetrahedralization"), STAT_Dungeon_Tetrahedralization, STATGROUP_Dungeon);
+DECLARE_CYCLE_STAT(TEXT("Spanning Tree"), STAT_Dungeon_SpanningTree, STATGROUP_Dungeon);
+DECLARE_CYCLE_STAT(TEXT("Edge Re-addition"), STAT_Dungeon_EdgeReaddition, STATGROUP_Dungeon);
+DECLARE_CYCLE_STAT(TEXT("Room Semantics"), STAT_Dungeon_RoomSemantics, STATGROUP_Dungeon);
+DECLARE_CYCLE_STAT(TEXT("Hallway Carving"), STAT_Dungeon_HallwayCarving, STATGROUP_Dungeon);
+DECLARE_CYCLE_STAT(TEXT("Metrics"), STAT_Dungeon_Metrics, STATGROUP_Dungeon);
+DECLARE_CYCLE_STAT(TEXT("Validation"), STAT_Dungeon_Validation, STATGROUP_Dungeon);
+
+namespace
+{
+	/** Adds the wall time of the enclosing scope to a FDungeonStageTimings field. */
+	struct FScopedStageTimer
+	{
+		explicit FScopedStageTimer(double& InTargetMs)
+			: TargetMs(InTargetMs)
+			, StartTime(FPlatformTime::Seconds())
+		{
+		}
+
+		~FScopedStageTimer()
+		{
+			TargetMs += (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		}
+
+		double& TargetMs;
+		const double StartTime;
+	};
+
+	/**
+	 * Cells within reach of one batch's changes. Every grid read of a search lies within staircase
+	 * reach of a cell it closed: RiseToRun + 1 cells across, from two floors below (a descending
+	 * exit's floor support) to HeadroomCells floors above. Changes are stamped as they arrive, so
+	 * each check costs only the new changes plus the search's closed list.
+	 */
+	struct FBatchReadFootprint
+	{
+		void Begin(int32 NumCells)
+		{
+			if (Stamps.Num() != NumCells)
+			{
+				Stamps.Init(0, NumCells);
+			}
+			++Stamp;
+			NumStamped = 0;
+		}
+
+		/** True if a search that closed ExploredCells could have read any of Changed (all changes so far this batch). */
+		bool SearchReadAnyOf(TArrayView<const int32> ExploredCells, TArrayView<const FIntVector> Changed,
+			const FIntVector& GridSize, int32 RiseToRun, int32 HeadroomCells)
+		{
+			const int32 Reach = RiseToRun + 1;
+			for (; NumStamped < Changed.Num(); ++NumStamped)
+			{
+				const FIntVector& Cell = Changed[NumStamped];
+				const int32 MinX = FMath::Max(Cell.X - Reach, 0);
+				const int32 MaxX = FMath::Min(Cell.X + Reach, GridSize.X - 1);
+				const int32 MinY = FMath::Max(Cell.Y - Reach, 0);
+				const int32 MaxY = FMath::Min(Cell.Y + Reach, GridSize.Y - 1);
+				const int32 MinZ = FMath::Max(Cell.Z - HeadroomCells, 0);
+				const int32 MaxZ = FMath::Min(Cell.Z + 2, GridSize.Z - 1);
+				for (int32 Z = MinZ; Z <= MaxZ; ++Z)
+				{
+					for (int32 Y = MinY; Y <= MaxY; ++Y)
+					{
+						const int32 RowStart = Y * GridSize.X + Z * GridSize.X * GridSize.Y;
+						for (int32 X = MinX; X <= MaxX; ++X)
+						{
+							Stamps[RowStart + X] = Stamp;
+						}
+					}
+				}
+			}
+			if (NumStamped == 0)
+			{
+				return false;
+			}
+
+			for (const int32 GridIdx : ExploredCells)
+			{
+				if (Stamps[GridIdx] == Stamp)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+	private:
+		TArray<uint32> Stamps;
+		uint32 Stamp = 0;
+		int32 NumStamped = 0;
+	};
+}
+
 TArray<FVector> UDungeonGenerator::GetCellWorldPositionsByType(const FDungeonResult& Result, EDungeonCellType CellType)
 {
 	TArray<FVector> Positions;
@@ -34,13 +138,135 @@ TArray<FVector> UDungeonGenerator::GetCellWorldPositionsByType(const FDungeonRes
 
 FDungeonResult UDungeonGenerator::Generate(UDungeonConfiguration* Config, int64 Seed)
 {
-	FDungeonResult Result;
-
 	if (!Config)
 	{
 		UE_LOG(LogDungeonGenerator, Error, TEXT("Generate called with null Config"));
-		return Result;
+		return FDungeonResult();
+	}
+
+	return RunPipeline(FDungeonGenerationParams::FromConfig(*Config), Seed, nullptr);
+}
+
+FDungeonResult UDungeonGenerator::GenerateFromParams(const FDungeonGenerationParams& Params, int64 Seed)
+{
+	return RunPipeline(Params, Seed, nullptr);
+}
+
+TFuture<FDungeonResult> UDungeonGenerator::GenerateAsync(
+	UDungeonConfiguration* Config,
+	int64 Seed,
+	TSharedPtr<FDungeonGenerationProgress> Progress)
+{
+	if (!Config)
+	{
+		UE_LOG(LogDungeonGenerator, Error, TEXT("GenerateAsync called with null Config"));
+		return MakeFulfilledPromise<FDungeonResult>().GetFuture();
+	}
+
+	// Snapshot on the calling thread so the worker never reads the data asset
+	return GenerateAsync(FDungeonGenerationParams::FromConfig(*Config), Seed, MoveTemp(Progress));
+}
+
+TFuture<FDungeonResult> UDungeonGenerator::GenerateAsync(
+	const FDungeonGenerationParams& Params,
+	int64 Seed,
+	TSharedPtr<FDungeonGenerationProgress> Progress)
+{
+	return Async(EAsyncExecution::TaskGraph,
+		[Params, Seed, Progress = MoveTemp(Progress)]()
+		{
+			return RunPipeline(Params, Seed, Progress.Get());
+		});
+}
+
+TArray<FDungeonResult> UDungeonGenerator::GenerateBatch(
+	UDungeonConfiguration* Config,
+	TArrayView<const int64> Seeds,
+	FDungeonBatchStats* OutStats)
+{
+	if (!Config)
+	{
+		UE_LOG(LogDungeonGenerator, Error, TEXT("GenerateBatch called with null Config"));
+		return TArray<FDungeonResult>();
+	}
+
+	return GenerateBatch(FDungeonGenerationParams::FromConfig(*Config), Seeds, OutStats);
+}
+
+TArray<FDungeonResult> UDungeonGenerator::GenerateBatch(
+	const FDungeonGenerationParams& Params,
+	TArrayView<const int64> Seeds,
+	FDungeonBatchStats* OutStats)
+{
+	TArray<FDungeonResult> Results;
+	Results.SetNum(Seeds.Num());
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Each seed is an independent pipeline run writing only its own slot, so results
+	// land in seed order regardless of which worker finishes first. Per-dungeon cost
+	// varies a lot with layout, hence Unbalanced scheduling.
+	ParallelFor(Seeds.Num(), [&Params, &Seeds, &Results](int32 Index)
+	{
+		Results[Index] = RunPipeline(Params, Seeds[Index], nullptr);
+	}, EParallelForFlags::Unbalanced);
+
+	FDungeonBatchStats Stats;
+	Stats.DungeonCount = Seeds.Num();
+	Stats.WorkerThreadCount = FTaskGraphInterface::Get().GetNumWorkerThreads();
+	Stats.WallTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	for (const FDungeonResult& Result : Results)
+	{
+		Stats.TotalGenerationTimeMs += Result.GenerationTimeMs;
 	}
+	if (Stats.WallTimeMs > 0.0)
+	{
+		Stats.DungeonsPerSecond = Stats.DungeonCount / (Stats.WallTimeMs / 1000.0);
+	}
+
+	UE_LOG(LogDungeonGenerator, Log,
+		TEXT("Batch complete: %d dungeons in %.2fms (%.1f dungeons/sec, %d workers, %.2fms summed pipeline time)"),
+		Stats.DungeonCount, Stats.WallTimeMs, Stats.DungeonsPerSecond,
+		Stats.WorkerThreadCount, Stats.TotalGenerationTimeMs);
+
+	if (OutStats)
+	{
+		*OutStats = Stats;
+	}
+
+	return Results;
+}
+
+FDungeonResult UDungeonGenerator::RunPipeline(
+	const FDungeonGenerationParams& Params,
+	int64 Seed,
+	FDungeonGenerationProgress* Progress)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(Dungeon_Generate);
+	SCOPE_CYCLE_COUNTER(STAT_Dungeon_Generate);
+
+	FDungeonResult Result;
+	FDungeonStageTimings& Timings = Result.StageTimings;
+
+	// Cooperative cancellation checkpoint. Returns true (and marks the progress cancelled)
+	// if the caller asked us to stop; the partially built result is discarded.
+	auto ShouldCancel = [Progress]()
+	{
+		if (Progress && Progress->IsCancelRequested())
+		{
+			Progress->SetStage(EDungeonGenerationStage::Cancelled);
+			return true;
+		}
+		return false;
+	};
+
+	auto ReportStage = [Progress](EDungeonGenerationStage Stage)
+	{
+		if (Progress)
+		{
+			Progress->SetStage(Stage);
+		}
+	};
 
 	const double StartTime = FPlatformTime::Seconds();
 
@@ -51,13 +277,14 @@ FDungeonResult UDungeonGenerator::Generate(UDungeonConfiguration* Config, int64
 	}
 
 	Result.Seed = Seed;
-	Result.GridSize = Config->GridSize;
-	Result.CellWorldSize = Config->CellWorldSize;
+	Result.ParamsHash = Params.GetStableHash();
+	Result.GridSize = Params.GridSize;
+	Result.CellWorldSize = Params.CellWorldSize;
 
 	// =========================================================================
 	// Step 1: Initialize Grid
 	// =========================================================================
-	Result.Grid.Initialize(Config->GridSize);
+	Result.Grid.Initialize(Params.GridSize);
 
 	// =========================================================================
 	// Step 2: Seed RNG
@@ -67,195 +294,329 @@ FDungeonResult UDungeonGenerator::Generate(UDungeonConfiguration* Config, int64
 	// =========================================================================
 	// Step 3: Place Rooms
 	// =========================================================================
-	if (!FRoomPlacement::PlaceRooms(Result.Grid, *Config, MainSeed, Result.Rooms))
+	if (ShouldCancel())
 	{
-		UE_LOG(LogDungeonGenerator, Error,
-			TEXT("Failed to place enough rooms (need >= 2, got %d)"), Result.Rooms.Num());
-		return Result;
+		return FDungeonResult();
 	}
+	ReportStage(EDungeonGenerationStage::RoomPlacement);
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(Dungeon_RoomPlacement);
+		SCOPE_CYCLE_COUNTER(STAT_Dungeon_RoomPlacement);
+		FScopedStageTimer StageTimer(Timings.RoomPlacementMs);
 
-	UE_LOG(LogDungeonGenerator, Warning, TEXT("Step 3: Placed %d rooms"), Result.Rooms.Num());
+		if (!FRoomPlacement::PlaceRooms(Result.Grid, Params, MainSeed, Result.Rooms))
+		{
+			UE_LOG(LogDungeonGenerator, Error,
+				TEXT("Failed to place enough rooms (need >= 2, got %d)"), Result.Rooms.Num());
+			ReportStage(EDungeonGenerationStage::Complete);
+			return Result;
+		}
+	}
+
+	UE_LOG(LogDungeonGenerator, Verbose, TEXT("Step 3: Placed %d rooms"), Result.Rooms.Num());
 	for (int32 r = 0; r < Result.Rooms.Num(); ++r)
 	{
 		const FDungeonRoom& Rm = Result.Rooms[r];
-		UE_LOG(LogDungeonGenerator, Warning, TEXT("  Room %d: Center=(%d,%d,%d) Size=(%d,%d,%d)"),
+		UE_LOG(LogDungeonGenerator, VeryVerbose, TEXT("  Room %d: Center=(%d,%d,%d) Size=(%d,%d,%d)"),
 			r, Rm.Center.X, Rm.Center.Y, Rm.Center.Z, Rm.Size.X, Rm.Size.Y, Rm.Size.Z);
 	}
 
 	// =========================================================================
 	// Step 4: Select Entrance Room
 	// =========================================================================
-	FDungeonSeed EntranceSeed = MainSeed.Fork(3);
-	Result.EntranceRoomIndex = FRoomSemantics::SelectEntranceRoom(Result, *Config, EntranceSeed);
-	if (Result.EntranceRoomIndex >= 0)
+	if (ShouldCancel())
+	{
+		return FDungeonResult();
+	}
+	ReportStage(EDungeonGenerationStage::EntranceSelection);
 	{
-		Result.Rooms[Result.EntranceRoomIndex].RoomType = EDungeonRoomType::Entrance;
-		// Use ground-floor center so the entrance is at the walkable level
-		const FDungeonRoom& EntRoom = Result.Rooms[Result.EntranceRoomIndex];
-		Result.EntranceCell = EntRoom.Position + FIntVector(EntRoom.Size.X / 2, EntRoom.Size.Y / 2, 0);
+		TRACE_CPUPROFILER_EVENT_SCOPE(Dungeon_EntranceSelection);
+		SCOPE_CYCLE_COUNTER(STAT_Dungeon_EntranceSelection);
+		FScopedStageTimer StageTimer(Timings.EntranceSelectionMs);
+
+		FDungeonSeed EntranceSeed = MainSeed.Fork(3);
+		Result.EntranceRoomIndex = FRoomSemantics::SelectEntranceRoom(Result, Params, EntranceSeed);
+		if (Result.EntranceRoomIndex >= 0)
+		{
+			Result.Rooms[Result.EntranceRoomIndex].RoomType = EDungeonRoomType::Entrance;
+			// Use ground-floor center so the entrance is at the walkable level
+			const FDungeonRoom& EntRoom = Result.Rooms[Result.EntranceRoomIndex];
+			Result.EntranceCell = EntRoom.Position + FIntVector(EntRoom.Size.X / 2, EntRoom.Size.Y / 2, 0);
+		}
 	}
 
-	UE_LOG(LogDungeonGenerator, Log, TEXT("Step 4: Selected entrance room %d (placement=%d)"),
-		Result.EntranceRoomIndex, static_cast<int32>(Config->EntrancePlacement));
+	UE_LOG(LogDungeonGenerator, Verbose, TEXT("Step 4: Selected entrance room %d (placement=%d)"),
+		Result.EntranceRoomIndex, static_cast<int32>(Params.EntrancePlacement));
 
 	// =========================================================================
-	// Step 5: Delaunay Tetrahedralization (3D)
+	// Step 5: Delaunay Tetrahedralization (3D), or Triangulation (2D) for flat layouts
 	// =========================================================================
-	TArray<FVector> RoomCenters3D;
-	RoomCenters3D.Reserve(Result.Rooms.Num());
-	for (const FDungeonRoom& Room : Result.Rooms)
+	if (ShouldCancel())
 	{
-		RoomCenters3D.Add(FVector(Room.Center));
+		return FDungeonResult();
 	}
+	ReportStage(EDungeonGenerationStage::Tetrahedralization);
 
-	// Detect coplanar rooms (all on the same Z floor) and add jitter
-	// to prevent degenerate tetrahedralization
+	TArray<FVector> RoomCenters3D;
+	TArray<TPair<int32, int32>> DelaunayEdgesInt;
 	bool bAllCoplanar = true;
-	if (RoomCenters3D.Num() > 1)
+	bool bSingleFloor = true;
 	{
-		const float FirstZ = RoomCenters3D[0].Z;
-		for (int32 i = 1; i < RoomCenters3D.Num(); ++i)
+		TRACE_CPUPROFILER_EVENT_SCOPE(Dungeon_Tetrahedralization);
+		SCOPE_CYCLE_COUNTER(STAT_Dungeon_Tetrahedralization);
+		FScopedStageTimer StageTimer(Timings.TetrahedralizationMs);
+
+		RoomCenters3D.Reserve(Result.Rooms.Num());
+		for (const FDungeonRoom& Room : Result.Rooms)
+		{
+			RoomCenters3D.Add(FVector(Room.Center));
+		}
+
+		// Detect coplanar rooms (all centers at the same Z) and single-floor layouts (all rooms
+		// on one floor level, even if their heights differ)
+		if (RoomCenters3D.Num() > 1)
 		{
-			if (!FMath::IsNearlyEqual(RoomCenters3D[i].Z, FirstZ, 0.01f))
+			const float FirstZ = RoomCenters3D[0].Z;
+			const int32 FirstFloor = Result.Rooms[0].FloorLevel;
+			for (int32 i = 1; i < RoomCenters3D.Num(); ++i)
 			{
-				bAllCoplanar = false;
-				break;
+				bAllCoplanar &= FMath::IsNearlyEqual(RoomCenters3D[i].Z, FirstZ, 0.01f);
+				bSingleFloor &= Result.Rooms[i].FloorLevel == FirstFloor;
 			}
 		}
-	}
 
-	if (bAllCoplanar && RoomCenters3D.Num() >= 4)
-	{
-		FDungeonSeed JitterSeed = MainSeed.Fork(99);
-		for (FVector& Center : RoomCenters3D)
+		// A flat layout only needs the planar triangulation of its XY projection: a third of the
+		// predicate work, and none of the coplanar degeneracy the 3D mesh would have to perturb away.
+		// Both paths emit the same sorted, unique (Low, High) index pairs.
+		if (Params.RoomGraphMode == EDungeonRoomGraph::NearestNeighbors)
 		{
-			Center.Z += JitterSeed.FRand() * 0.01f;
+			// Sparse k-nearest-neighbor candidates instead of a full Delaunay mesh; same edge format
+			FNeighborGraph::Build(RoomCenters3D, Params.NeighborCount, Params.NeighborPruning, DelaunayEdgesInt);
+		}
+		else if (bAllCoplanar || bSingleFloor)
+		{
+			TArray<FVector2D> RoomCenters2D;
+			RoomCenters2D.Reserve(RoomCenters3D.Num());
+			for (const FVector& Center : RoomCenters3D)
+			{
+				RoomCenters2D.Add(FVector2D(Center.X, Center.Y));
+			}
+			FDelaunayTriangulation::Triangulate(RoomCenters2D, DelaunayEdgesInt);
+		}
+		else
+		{
+			FDelaunayTetrahedralization::Tetrahedralize(RoomCenters3D, DelaunayEdgesInt);
 		}
-	}
-
-	TArray<TPair<int32, int32>> DelaunayEdgesInt;
-	FDelaunayTetrahedralization::Tetrahedralize(RoomCenters3D, DelaunayEdgesInt);
 
-	// Convert int32 edges to uint8 for storage
-	Result.DelaunayEdges.Reserve(DelaunayEdgesInt.Num());
-	for (const auto& Edge : DelaunayEdgesInt)
-	{
-		Result.DelaunayEdges.Add(TPair<uint8, uint8>(
-			static_cast<uint8>(Edge.Key),
-			static_cast<uint8>(Edge.Value)));
+		// Convert int32 edges to uint8 for storage
+		Result.DelaunayEdges.Reserve(DelaunayEdgesInt.Num());
+		for (const auto& Edge : DelaunayEdgesInt)
+		{
+			Result.DelaunayEdges.Add(TPair<uint8, uint8>(
+				static_cast<uint8>(Edge.Key),
+				static_cast<uint8>(Edge.Value)));
+		}
 	}
 
-	UE_LOG(LogDungeonGenerator, Warning, TEXT("Step 5: Delaunay produced %d edges (coplanar=%d)"),
-		Result.DelaunayEdges.Num(), bAllCoplanar ? 1 : 0);
+	UE_LOG(LogDungeonGenerator, Verbose, TEXT("Step 5: Candidate graph has %d edges (%s, coplanar=%d, single floor=%d)"),
+		Result.DelaunayEdges.Num(),
+		Params.RoomGraphMode == EDungeonRoomGraph::NearestNeighbors ? TEXT("nearest neighbors")
+			: ((bAllCoplanar || bSingleFloor) ? TEXT("Delaunay 2D") : TEXT("Delaunay 3D")),
+		bAllCoplanar ? 1 : 0, bSingleFloor ? 1 : 0);
 	for (const auto& Edge : Result.DelaunayEdges)
 	{
-		UE_LOG(LogDungeonGenerator, Warning, TEXT("  Edge: %d <-> %d"), Edge.Key, Edge.Value);
+		UE_LOG(LogDungeonGenerator, VeryVerbose, TEXT("  Edge: %d <-> %d"), Edge.Key, Edge.Value);
 	}
 
 	// =========================================================================
 	// Step 6: Minimum Spanning Tree (Prim's)
 	// =========================================================================
-	TArray<TPair<int32, int32>> MSTEdgesInt;
-	FMinimumSpanningTree::Compute(RoomCenters3D, DelaunayEdgesInt,
-		Result.EntranceRoomIndex, MSTEdgesInt);
-
-	Result.MSTEdges.Reserve(MSTEdgesInt.Num());
-	for (const auto& Edge : MSTEdgesInt)
+	if (ShouldCancel())
 	{
-		Result.MSTEdges.Add(TPair<uint8, uint8>(
-			static_cast<uint8>(Edge.Key),
-			static_cast<uint8>(Edge.Value)));
+		return FDungeonResult();
+	}
+	ReportStage(EDungeonGenerationStage::SpanningTree);
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(Dungeon_SpanningTree);
+		SCOPE_CYCLE_COUNTER(STAT_Dungeon_SpanningTree);
+		FScopedStageTimer StageTimer(Timings.SpanningTreeMs);
+
+		TArray<TPair<int32, int32>> MSTEdgesInt;
+		FMinimumSpanningTree::Compute(RoomCenters3D, DelaunayEdgesInt,
+			Result.EntranceRoomIndex, MSTEdgesInt);
+
+		Result.MSTEdges.Reserve(MSTEdgesInt.Num());
+		for (const auto& Edge : MSTEdgesInt)
+		{
+			Result.MSTEdges.Add(TPair<uint8, uint8>(
+				static_cast<uint8>(Edge.Key),
+				static_cast<uint8>(Edge.Value)));
+		}
 	}
 
-	UE_LOG(LogDungeonGenerator, Warning, TEXT("Step 6: MST has %d edges"), Result.MSTEdges.Num());
+	UE_LOG(LogDungeonGenerator, Verbose, TEXT("Step 6: MST has %d edges"), Result.MSTEdges.Num());
 
 	// =========================================================================
 	// Step 7: Edge Re-addition (add some Delaunay edges back for loops)
 	// =========================================================================
-	FDungeonSeed EdgeSeed = MainSeed.Fork(2);
-	Result.FinalEdges = Result.MSTEdges;
-
-	for (const auto& Edge : Result.DelaunayEdges)
+	ReportStage(EDungeonGenerationStage::EdgeReaddition);
 	{
-		// Check if this edge is already in the MST
-		bool bInMST = false;
-		for (const auto& MSTEdge : Result.MSTEdges)
+		TRACE_CPUPROFILER_EVENT_SCOPE(Dungeon_EdgeReaddition);
+		SCOPE_CYCLE_COUNTER(STAT_Dungeon_EdgeReaddition);
+		FScopedStageTimer StageTimer(Timings.EdgeReadditionMs);
+
+		FDungeonSeed EdgeSeed = MainSeed.Fork(2);
+		Result.FinalEdges = Result.MSTEdges;
+
+		for (const auto& Edge : Result.DelaunayEdges)
 		{
-			if ((MSTEdge.Key == Edge.Key && MSTEdge.Value == Edge.Value) ||
-				(MSTEdge.Key == Edge.Value && MSTEdge.Value == Edge.Key))
+			// Check if this edge is already in the MST
+			bool bInMST = false;
+			for (const auto& MSTEdge : Result.MSTEdges)
 			{
-				bInMST = true;
-				break;
+				if ((MSTEdge.Key == Edge.Key && MSTEdge.Value == Edge.Value) ||
+					(MSTEdge.Key == Edge.Value && MSTEdge.Value == Edge.Key))
+				{
+					bInMST = true;
+					break;
+				}
 			}
-		}
 
-		if (!bInMST && EdgeSeed.RandBool(Config->EdgeReadditionChance))
-		{
-			Result.FinalEdges.Add(Edge);
+			if (!bInMST && EdgeSeed.RandBool(Params.EdgeReadditionChance))
+			{
+				Result.FinalEdges.Add(Edge);
+			}
 		}
 	}
 
-	UE_LOG(LogDungeonGenerator, Warning, TEXT("Step 7: Final graph has %d edges (%d MST + %d re-added)"),
+	UE_LOG(LogDungeonGenerator, Verbose, TEXT("Step 7: Final graph has %d edges (%d MST + %d re-added)"),
 		Result.FinalEdges.Num(), Result.MSTEdges.Num(),
 		Result.FinalEdges.Num() - Result.MSTEdges.Num());
 
 	// =========================================================================
 	// Step 8: Graph Metrics + Room Type Assignment
 	// =========================================================================
-	TArray<FRoomSemanticContext> SemanticContexts = FRoomSemantics::ComputeGraphMetrics(Result);
-	FDungeonSeed TypeSeed = MainSeed.Fork(4);
-	FRoomSemantics::AssignRoomTypes(Result, *Config, SemanticContexts, TypeSeed);
+	if (ShouldCancel())
+	{
+		return FDungeonResult();
+	}
+	ReportStage(EDungeonGenerationStage::RoomSemantics);
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(Dungeon_RoomSemantics);
+		SCOPE_CYCLE_COUNTER(STAT_Dungeon_RoomSemantics);
+		FScopedStageTimer StageTimer(Timings.RoomSemanticsMs);
+
+		TArray<FRoomSemanticContext> SemanticContexts = FRoomSemantics::ComputeGraphMetrics(Result);
+		FDungeonSeed TypeSeed = MainSeed.Fork(4);
+		FRoomSemantics::AssignRoomTypes(Result, Params, SemanticContexts, TypeSeed);
+	}
 
 	// =========================================================================
 	// Step 9: A* Hallway Carving
 	// =========================================================================
-	uint8 HallwayIdx = 1;
-
-	for (const auto& Edge : Result.FinalEdges)
+	ReportStage(EDungeonGenerationStage::HallwayCarving);
 	{
-		const int32 RoomAIdx = Edge.Key;
-		const int32 RoomBIdx = Edge.Value;
+		TRACE_CPUPROFILER_EVENT_SCOPE(Dungeon_HallwayCarving);
+		SCOPE_CYCLE_COUNTER(STAT_Dungeon_HallwayCarving);
+		FScopedStageTimer StageTimer(Timings.HallwayCarvingMs);
 
-		if (RoomAIdx >= Result.Rooms.Num() || RoomBIdx >= Result.Rooms.Num())
-		{
-			continue;
-		}
+		uint8 HallwayIdx = 1;
+		Result.PathfindStats.SetNum(Result.FinalEdges.Num());
 
-		const FDungeonRoom& RoomA = Result.Rooms[RoomAIdx];
-		const FDungeonRoom& RoomB = Result.Rooms[RoomBIdx];
+		auto IsValidEdge = [&Result](int32 EdgeIdx)
+		{
+			const auto& Edge = Result.FinalEdges[EdgeIdx];
+			return Edge.Key < Result.Rooms.Num() && Edge.Value < Result.Rooms.Num();
+		};
 
-		// Check if this is an MST edge
-		bool bIsMST = false;
-		for (const auto& MSTEdge : Result.MSTEdges)
+		// Reads Result but never writes it, so speculative batches can run several at once
+		auto SearchEdge = [&Result, &Params](int32 EdgeIdx, FPathfinderWorkspace& Workspace, TArray<FIntVector>& OutPath, FPathfindStats& OutStats)
 		{
-			if ((MSTEdge.Key == Edge.Key && MSTEdge.Value == Edge.Value) ||
-				(MSTEdge.Key == Edge.Value && MSTEdge.Value == Edge.Key))
+			const auto& Edge = Result.FinalEdges[EdgeIdx];
+			const FDungeonRoom& RoomA = Result.Rooms[Edge.Key];
+			const FDungeonRoom& RoomB = Result.Rooms[Edge.Value];
+
+			FPathSearchWindow SearchWindow;
+			if (Params.bBoundHallwaySearch)
 			{
-				bIsMST = true;
-				break;
+				SearchWindow = FPathSearchWindow::FromRooms(RoomA, RoomB, Params.HallwaySearchMargin, Result.GridSize);
 			}
-		}
-
-		// Use ground-floor center for pathfinding so hallways connect at
-		// the walkable level of multi-floor rooms, not the volumetric center.
-		const FIntVector StartPoint = RoomA.Position + FIntVector(RoomA.Size.X / 2, RoomA.Size.Y / 2, 0);
-		const FIntVector EndPoint = RoomB.Position + FIntVector(RoomB.Size.X / 2, RoomB.Size.Y / 2, 0);
 
-		UE_LOG(LogDungeonGenerator, Warning, TEXT("  Attempting hallway: room %d (%d,%d,%d) -> room %d (%d,%d,%d)"),
-			RoomAIdx, StartPoint.X, StartPoint.Y, StartPoint.Z,
-			RoomBIdx, EndPoint.X, EndPoint.Y, EndPoint.Z);
+			if (Params.bMultiGoalHallwaySearch)
+			{
+				// Leave from any edge cell of room A, stop at the first edge cell of room B
+				TArray<FIntVector> StartCells;
+				TArray<FIntVector> GoalCells;
+				FHallwayPathfinder::GetRoomBoundaryCells(RoomA, StartCells);
+				FHallwayPathfinder::GetRoomBoundaryCells(RoomB, GoalCells);
+				return FHallwayPathfinder::FindPath(
+					Result.Grid, StartCells, GoalCells, Params,
+					RoomA.RoomIndex, RoomB.RoomIndex, OutPath, &OutStats, &Workspace,
+					Params.bBoundHallwaySearch ? &SearchWindow : nullptr);
+			}
 
-		TArray<FIntVector> PathCells;
-		if (FHallwayPathfinder::FindPath(
-				Result.Grid, StartPoint, EndPoint, *Config,
-				RoomA.RoomIndex, RoomB.RoomIndex, PathCells))
+			// Use ground-floor center for pathfinding so hallways connect at
+			// the walkable level of multi-floor rooms, not the volumetric center.
+			const FIntVector StartPoint = RoomA.Position + FIntVector(RoomA.Size.X / 2, RoomA.Size.Y / 2, 0);
+			const FIntVector EndPoint = RoomB.Position + FIntVector(RoomB.Size.X / 2, RoomB.Size.Y / 2, 0);
+			return FHallwayPathfinder::FindPath(
+				Result.Grid, StartPoint, EndPoint, Params,
+				RoomA.RoomIndex, RoomB.RoomIndex, OutPath, &OutStats, &Workspace,
+				Params.bBoundHallwaySearch ? &SearchWindow : nullptr);
+		};
+
+		// One workspace for every hallway: FindPath resets it in O(1) instead of reallocating full-grid arrays.
+		// Its cost field and staircase masks persist across hallways; CarveHallway keeps them current.
+		FPathfinderWorkspace PathWorkspace;
+
+		auto CommitEdge = [&](int32 EdgeIdx, TArray<FIntVector>& PathCells, bool bFoundPath)
 		{
+			const auto& Edge = Result.FinalEdges[EdgeIdx];
+			const int32 RoomAIdx = Edge.Key;
+			const int32 RoomBIdx = Edge.Value;
+			const FDungeonRoom& RoomA = Result.Rooms[RoomAIdx];
+			const FDungeonRoom& RoomB = Result.Rooms[RoomBIdx];
+			const FPathfindStats& EdgeStats = Result.PathfindStats[EdgeIdx];
+			Result.PathfindTotals += EdgeStats;
+
+			UE_LOG(LogDungeonGenerator, VeryVerbose, TEXT("  Hallway: room %d (%d,%d,%d) -> room %d (%d,%d,%d)"),
+				RoomAIdx, RoomA.Position.X, RoomA.Position.Y, RoomA.Position.Z,
+				RoomBIdx, RoomB.Position.X, RoomB.Position.Y, RoomB.Position.Z);
+			UE_LOG(LogDungeonGenerator, VeryVerbose,
+				TEXT("    A*: popped=%d pushed=%d stale=%d stair probes=%d (rejected %d, mask misses %d) peak open=%d fallbacks=%d clusters rebuilt=%d hpa fallbacks=%d reruns=%d in %.3fms"),
+				EdgeStats.NodesPopped, EdgeStats.NodesPushed, EdgeStats.StalePops,
+				EdgeStats.StaircaseProbes, EdgeStats.StaircaseRejections, EdgeStats.StaircaseMaskMisses,
+				EdgeStats.PeakOpenSetSize, EdgeStats.WindowFallbacks, EdgeStats.ClustersRebuilt,
+				EdgeStats.HierarchicalFallbacks, EdgeStats.SpeculativeReruns, EdgeStats.WallTimeMs);
+
+			if (!bFoundPath)
+			{
+				// A real failure, but can be frequent on cramped grids; the validator reports
+				// any resulting disconnection at Warning
+				UE_LOG(LogDungeonGenerator, Verbose,
+					TEXT("A* failed to find path between room %d and room %d"),
+					RoomAIdx, RoomBIdx);
+				return;
+			}
+
+			// Check if this is an MST edge
+			bool bIsMST = false;
+			for (const auto& MSTEdge : Result.MSTEdges)
+			{
+				if ((MSTEdge.Key == Edge.Key && MSTEdge.Value == Edge.Value) ||
+					(MSTEdge.Key == Edge.Value && MSTEdge.Value == Edge.Key))
+				{
+					bIsMST = true;
+					break;
+				}
+			}
+
 			TArray<FDungeonStaircase> HallwayStaircases;
 			FHallwayPathfinder::CarveHallway(
 				Result.Grid, PathCells, HallwayIdx,
-				RoomA.RoomIndex, RoomB.RoomIndex, *Config, HallwayStaircases);
+				RoomA.RoomIndex, RoomB.RoomIndex, Params, HallwayStaircases, &PathWorkspace);
 
-			UE_LOG(LogDungeonGenerator, Warning, TEXT("    SUCCESS: path=%d cells, staircases=%d"),
+			UE_LOG(LogDungeonGenerator, VeryVerbose, TEXT("    SUCCESS: path=%d cells, staircases=%d"),
 				PathCells.Num(), HallwayStaircases.Num());
 
 			FDungeonHallway Hallway;
@@ -279,17 +640,124 @@ FDungeonResult UDungeonGenerator::Generate(UDungeonConfiguration* Config, int64
 			Result.Rooms[RoomBIdx].ConnectedRoomIndices.AddUnique(static_cast<uint8>(RoomAIdx));
 
 			HallwayIdx++;
+		};
+
+		// Speculative carving searches a batch of edges in parallel against the grid as it stands, then
+		// commits them in edge order. A search is redone on the main workspace only if an earlier commit
+		// in its batch changed a cell it could have read, so layouts match sequential carving exactly.
+		// Jump point scans and the shared cluster graph read beyond the cells a search closes, so those
+		// modes always carve one edge at a time.
+		const bool bSpeculative = Params.bSpeculativeHallwayCarving
+			&& Params.SpeculativeHallwayBatchSize > 1
+			&& Params.HallwaySearchMode != EDungeonHallwaySearch::JumpPoint
+			&& Params.HallwaySearchMode != EDungeonHallwaySearch::Hierarchical;
+		const int32 BatchSize = bSpeculative ? Params.SpeculativeHallwayBatchSize : 1;
+
+		struct FSpeculativeSearch
+		{
+			FPathfinderWorkspace Workspace;
+			TArray<int32> ExploredCells;
+			TArray<FIntVector> PathCells;
+			FPathfindStats Stats;
+			bool bFoundPath = false;
+		};
+		TArray<FSpeculativeSearch> SpeculativeSearches;
+		TArray<FIntVector> BatchChanges;
+		FBatchReadFootprint BatchFootprint;
+		if (bSpeculative)
+		{
+			SpeculativeSearches.SetNum(BatchSize);
+			PathWorkspace.ChangeLog = &BatchChanges;
 		}
-		else
+
+		const int32 NumEdges = Result.FinalEdges.Num();
+		for (int32 BatchStart = 0; BatchStart < NumEdges; BatchStart += BatchSize)
 		{
-			UE_LOG(LogDungeonGenerator, Warning,
-				TEXT("A* failed to find path between room %d and room %d"),
-				RoomAIdx, RoomBIdx);
+			// Each carve depends on the previous ones, so batches are the natural cancellation points
+			if (ShouldCancel())
+			{
+				return FDungeonResult();
+			}
+			if (Progress)
+			{
+				Progress->SetStageFraction(static_cast<float>(BatchStart) / NumEdges);
+			}
+
+			const int32 BatchEnd = FMath::Min(BatchStart + BatchSize, NumEdges);
+
+			if (bSpeculative)
+			{
+				// Nothing writes the grid until the batch commits, so the searches share it read-only
+				ParallelFor(BatchEnd - BatchStart, [&](int32 Slot)
+				{
+					const int32 EdgeIdx = BatchStart + Slot;
+					if (!IsValidEdge(EdgeIdx))
+					{
+						return;
+					}
+
+					FSpeculativeSearch& Search = SpeculativeSearches[Slot];
+					Search.ExploredCells.Reset();
+					Search.Workspace.ExploredCells = &Search.ExploredCells;
+					Search.bFoundPath = SearchEdge(EdgeIdx, Search.Workspace, Search.PathCells, Search.Stats);
+				});
+				BatchChanges.Reset();
+				BatchFootprint.Begin(Result.Grid.Cells.Num());
+			}
+
+			for (int32 EdgeIdx = BatchStart; EdgeIdx < BatchEnd; ++EdgeIdx)
+			{
+				if (!IsValidEdge(EdgeIdx))
+				{
+					continue;
+				}
+
+				TArray<FIntVector> PathCells;
+				FPathfindStats& EdgeStats = Result.PathfindStats[EdgeIdx];
+				bool bFoundPath = false;
+				if (bSpeculative)
+				{
+					FSpeculativeSearch& Search = SpeculativeSearches[EdgeIdx - BatchStart];
+					if (BatchFootprint.SearchReadAnyOf(Search.ExploredCells, BatchChanges, Result.GridSize,
+						Params.StaircaseRiseToRun, Params.StaircaseHeadroom))
+					{
+						bFoundPath = SearchEdge(EdgeIdx, PathWorkspace, PathCells, EdgeStats);
+						EdgeStats.SpeculativeReruns = 1;
+					}
+					else
+					{
+						PathCells = MoveTemp(Search.PathCells);
+						EdgeStats = Search.Stats;
+						bFoundPath = Search.bFoundPath;
+					}
+				}
+				else
+				{
+					bFoundPath = SearchEdge(EdgeIdx, PathWorkspace, PathCells, EdgeStats);
+				}
+
+				CommitEdge(EdgeIdx, PathCells, bFoundPath);
+			}
+
+			if (bSpeculative && BatchChanges.Num() > 0)
+			{
+				// Bring every search workspace's grid caches up to date with this batch's carving
+				ParallelFor(SpeculativeSearches.Num(), [&](int32 Slot)
+				{
+					SpeculativeSearches[Slot].Workspace.NotifyCellsChanged(Result.Grid, BatchChanges);
+				});
+			}
 		}
 	}
 
-	UE_LOG(LogDungeonGenerator, Warning, TEXT("Step 9: Carved %d hallways, %d total staircases"),
+	UE_LOG(LogDungeonGenerator, Verbose, TEXT("Step 9: Carved %d hallways, %d total staircases"),
 		Result.Hallways.Num(), Result.Staircases.Num());
+	UE_LOG(LogDungeonGenerator, Verbose,
+		TEXT("  A* totals: popped=%d pushed=%d stale=%d stair probes=%d (rejected %d, mask misses %d) peak open=%d in %.2fms"),
+		Result.PathfindTotals.NodesPopped, Result.PathfindTotals.NodesPushed, Result.PathfindTotals.StalePops,
+		Result.PathfindTotals.StaircaseProbes, Result.PathfindTotals.StaircaseRejections,
+		Result.PathfindTotals.StaircaseMaskMisses,
+		Result.PathfindTotals.PeakOpenSetSize, Result.PathfindTotals.WallTimeMs);
 
 	// =========================================================================
 	// Step 10: Place Entrances & Doors (doors handled by CarveHallway)
@@ -298,41 +766,48 @@ FDungeonResult UDungeonGenerator::Generate(UDungeonConfiguration* Config, int64
 	{
 		const FDungeonRoom& EntranceRoom = Result.Rooms[Result.EntranceRoomIndex];
 
-		// Mark entrance cell in the grid
-		FDungeonCell& EntranceGridCell = Result.Grid.GetCell(Result.EntranceCell);
-		if (EntranceGridCell.CellType == EDungeonCellType::Room ||
-			EntranceGridCell.CellType == EDungeonCellType::Door)
-		{
-			EntranceGridCell.CellType = EDungeonCellType::Entrance;
-			EntranceGridCell.Flags |= 0x01; // bIsEntrance flag
-		}
+		// Mark entrance cell in the grid (room or door cells only)
+		FDungeonCell EntranceValue;
+		EntranceValue.CellType = EDungeonCellType::Entrance;
+		EntranceValue.Flags = 0x01; // bIsEntrance flag
+		FDungeonCell EntranceMask = FDungeonGrid::FieldMask(&FDungeonCell::CellType);
+		EntranceMask.Flags = 0x01; // set only this bit, keeping any other flags
+		Result.Grid.FillBoxWhere(Result.EntranceCell, Result.EntranceCell + FIntVector(1, 1, 1),
+			FDungeonGrid::CellTypeBit(EDungeonCellType::Room) | FDungeonGrid::CellTypeBit(EDungeonCellType::Door),
+			EntranceValue, EntranceMask, [](const FIntVector&) {});
 	}
 
 	// =========================================================================
 	// Compute Metrics
 	// =========================================================================
-	Result.TotalRoomCells = 0;
-	Result.TotalHallwayCells = 0;
-	Result.TotalStaircaseCells = 0;
-
-	for (const FDungeonCell& Cell : Result.Grid.Cells)
 	{
-		switch (Cell.CellType)
+		TRACE_CPUPROFILER_EVENT_SCOPE(Dungeon_Metrics);
+		SCOPE_CYCLE_COUNTER(STAT_Dungeon_Metrics);
+		FScopedStageTimer StageTimer(Timings.MetricsMs);
+
+		Result.TotalRoomCells = 0;
+		Result.TotalHallwayCells = 0;
+		Result.TotalStaircaseCells = 0;
+
+		for (const FDungeonCell& Cell : Result.Grid.Cells)
 		{
-		case EDungeonCellType::Room:
-		case EDungeonCellType::Door:
-		case EDungeonCellType::Entrance:
-			Result.TotalRoomCells++;
-			break;
-		case EDungeonCellType::Hallway:
-			Result.TotalHallwayCells++;
-			break;
-		case EDungeonCellType::Staircase:
-		case EDungeonCellType::StaircaseHead:
-			Result.TotalStaircaseCells++;
-			break;
-		default:
-			break;
+			switch (Cell.CellType)
+			{
+			case EDungeonCellType::Room:
+			case EDungeonCellType::Door:
+			case EDungeonCellType::Entrance:
+				Result.TotalRoomCells++;
+				break;
+			case EDungeonCellType::Hallway:
+				Result.TotalHallwayCells++;
+				break;
+			case EDungeonCellType::Staircase:
+			case EDungeonCellType::StaircaseHead:
+				Result.TotalStaircaseCells++;
+				break;
+			default:
+				break;
+			}
 		}
 	}
 
@@ -340,8 +815,13 @@ FDungeonResult UDungeonGenerator::Generate(UDungeonConfiguration* Config, int64
 	// Step 11: Validation (non-shipping builds only)
 	// =========================================================================
 #if !UE_BUILD_SHIPPING
+	ReportStage(EDungeonGenerationStage::Validation);
 	{
-		FDungeonValidationResult Validation = FDungeonValidator::ValidateAll(Result, *Config);
+		TRACE_CPUPROFILER_EVENT_SCOPE(Dungeon_Validation);
+		SCOPE_CYCLE_COUNTER(STAT_Dungeon_Validation);
+		FScopedStageTimer StageTimer(Timings.ValidationMs);
+
+		FDungeonValidationResult Validation = FDungeonValidator::ValidateAll(Result, Params);
 		if (!Validation.bPassed)
 		{
 			UE_LOG(LogDungeonGenerator, Warning, TEXT("Validation: %s"), *Validation.GetSummary());
@@ -358,5 +838,12 @@ FDungeonResult UDungeonGenerator::Generate(UDungeonConfiguration* Config, int64
 		Result.TotalRoomCells, Result.TotalHallwayCells, Result.TotalStaircaseCells,
 		Result.GenerationTimeMs, Result.Seed);
 
+	UE_LOG(LogDungeonGenerator, Verbose,
+		TEXT("  Stages: place=%.2f entrance=%.2f tetra=%.2f mst=%.2f readd=%.2f semantics=%.2f carve=%.2f metrics=%.2f validate=%.2f (ms)"),
+		Timings.RoomPlacementMs, Timings.EntranceSelectionMs, Timings.TetrahedralizationMs,
+		Timings.SpanningTreeMs, Timings.EdgeReadditionMs, Timings.RoomSemanticsMs,
+		Timings.HallwayCarvingMs, Timings.MetricsMs, Timings.ValidationMs);
+
+	ReportStage(EDungeonGenerationStage::Complete);
 	return Result;
 }
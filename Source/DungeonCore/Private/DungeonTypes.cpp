@@ -1,37 +1,77 @@
 #include "DungeonTypes.h"
+#include <atomic>
+
+namespace
+{
+	FORCEINLINE uint64 CellBits(const FDungeonCell& Cell)
+	{
+		uint64 Bits;
+		FMemory::Memcpy(&Bits, &Cell, sizeof(Bits));
+		return Bits;
+	}
+
+	/** Store Value over Count contiguous cells as 8-byte words; the loop vectorizes to wide stores. */
+	FORCEINLINE void StoreRun(FDungeonCell* Dst, int32 Count, uint64 Value)
+	{
+		for (int32 i = 0; i < Count; ++i)
+		{
+			FMemory::Memcpy(Dst + i, &Value, sizeof(Value));
+		}
+	}
+
+	/** As StoreRun, keeping the bits of each cell outside Mask. Value must already be masked. */
+	FORCEINLINE void StoreRunMasked(FDungeonCell* Dst, int32 Count, uint64 Value, uint64 Mask)
+	{
+		for (int32 i = 0; i < Count; ++i)
+		{
+			uint64 Bits;
+			FMemory::Memcpy(&Bits, Dst + i, sizeof(Bits));
+			Bits = (Bits & ~Mask) | Value;
+			FMemory::Memcpy(Dst + i, &Bits, sizeof(Bits));
+		}
+	}
+}
 
 // ============================================================================
 // FDungeonGrid
 // ============================================================================
 
+uint64 FDungeonGridRevision::NewSequence()
+{
+	static std::atomic<uint64> LastSequence{0};
+	return (LastSequence.fetch_add(1, std::memory_order_relaxed) + 1) << 32;
+}
+
 void FDungeonGrid::Initialize(const FIntVector& InGridSize)
 {
 	GridSize = InGridSize;
 	Cells.SetNum(GridSize.X * GridSize.Y * GridSize.Z);
+	MarkChanged();
 }
 
-FDungeonCell& FDungeonGrid::GetCell(int32 X, int32 Y, int32 Z)
+const FDungeonCell& FDungeonGrid::GetCell(int32 X, int32 Y, int32 Z) const
 {
 	checkf(IsInBounds(X, Y, Z), TEXT("Grid access out of bounds: (%d,%d,%d) in grid (%d,%d,%d)"),
 		X, Y, Z, GridSize.X, GridSize.Y, GridSize.Z);
 	return Cells[CellIndex(X, Y, Z)];
 }
 
-const FDungeonCell& FDungeonGrid::GetCell(int32 X, int32 Y, int32 Z) const
+const FDungeonCell& FDungeonGrid::GetCell(const FIntVector& Coord) const
 {
-	checkf(IsInBounds(X, Y, Z), TEXT("Grid access out of bounds: (%d,%d,%d) in grid (%d,%d,%d)"),
-		X, Y, Z, GridSize.X, GridSize.Y, GridSize.Z);
-	return Cells[CellIndex(X, Y, Z)];
+	return GetCell(Coord.X, Coord.Y, Coord.Z);
 }
 
-FDungeonCell& FDungeonGrid::GetCell(const FIntVector& Coord)
+FDungeonCell& FDungeonGrid::GetCellForWrite(int32 X, int32 Y, int32 Z)
 {
-	return GetCell(Coord.X, Coord.Y, Coord.Z);
+	checkf(IsInBounds(X, Y, Z), TEXT("Grid access out of bounds: (%d,%d,%d) in grid (%d,%d,%d)"),
+		X, Y, Z, GridSize.X, GridSize.Y, GridSize.Z);
+	MarkChanged();
+	return Cells[CellIndex(X, Y, Z)];
 }
 
-const FDungeonCell& FDungeonGrid::GetCell(const FIntVector& Coord) const
+FDungeonCell& FDungeonGrid::GetCellForWrite(const FIntVector& Coord)
 {
-	return GetCell(Coord.X, Coord.Y, Coord.Z);
+	return GetCellForWrite(Coord.X, Coord.Y, Coord.Z);
 }
 
 bool FDungeonGrid::IsInBounds(int32 X, int32 Y, int32 Z) const
@@ -46,6 +86,111 @@ bool FDungeonGrid::IsInBounds(const FIntVector& Coord) const
 	return IsInBounds(Coord.X, Coord.Y, Coord.Z);
 }
 
+bool FDungeonGrid::ClipBox(FIntVector& InOutMin, FIntVector& InOutMaxExclusive) const
+{
+	InOutMin = FIntVector(FMath::Max(InOutMin.X, 0), FMath::Max(InOutMin.Y, 0), FMath::Max(InOutMin.Z, 0));
+	InOutMaxExclusive = FIntVector(
+		FMath::Min(InOutMaxExclusive.X, GridSize.X),
+		FMath::Min(InOutMaxExclusive.Y, GridSize.Y),
+		FMath::Min(InOutMaxExclusive.Z, GridSize.Z));
+	return InOutMin.X < InOutMaxExclusive.X
+		&& InOutMin.Y < InOutMaxExclusive.Y
+		&& InOutMin.Z < InOutMaxExclusive.Z;
+}
+
+int32 FDungeonGrid::FillRow(int32 Y, int32 Z, int32 MinX, int32 MaxXExclusive, const FDungeonCell& Value)
+{
+	return FillBox(FIntVector(MinX, Y, Z), FIntVector(MaxXExclusive, Y + 1, Z + 1), Value);
+}
+
+int32 FDungeonGrid::FillRow(int32 Y, int32 Z, int32 MinX, int32 MaxXExclusive, const FDungeonCell& Value,
+	const FDungeonCell& Mask)
+{
+	return FillBox(FIntVector(MinX, Y, Z), FIntVector(MaxXExclusive, Y + 1, Z + 1), Value, Mask);
+}
+
+int32 FDungeonGrid::FillBox(const FIntVector& Min, const FIntVector& MaxExclusive, const FDungeonCell& Value)
+{
+	FIntVector Lo = Min;
+	FIntVector Hi = MaxExclusive;
+	if (!ClipBox(Lo, Hi))
+	{
+		return 0;
+	}
+
+	MarkChanged();
+	const uint64 ValueBits = CellBits(Value);
+	const int32 RunLength = Hi.X - Lo.X;
+	FDungeonCell* Data = Cells.GetData();
+	for (int32 Z = Lo.Z; Z < Hi.Z; ++Z)
+	{
+		for (int32 Y = Lo.Y; Y < Hi.Y; ++Y)
+		{
+			StoreRun(Data + CellIndex(Lo.X, Y, Z), RunLength, ValueBits);
+		}
+	}
+	return RunLength * (Hi.Y - Lo.Y) * (Hi.Z - Lo.Z);
+}
+
+int32 FDungeonGrid::FillBox(const FIntVector& Min, const FIntVector& MaxExclusive, const FDungeonCell& Value,
+	const FDungeonCell& Mask)
+{
+	FIntVector Lo = Min;
+	FIntVector Hi = MaxExclusive;
+	if (!ClipBox(Lo, Hi))
+	{
+		return 0;
+	}
+
+	MarkChanged();
+	const uint64 MaskBits = CellBits(Mask);
+	const uint64 ValueBits = CellBits(Value) & MaskBits;
+	const int32 RunLength = Hi.X - Lo.X;
+	FDungeonCell* Data = Cells.GetData();
+	for (int32 Z = Lo.Z; Z < Hi.Z; ++Z)
+	{
+		for (int32 Y = Lo.Y; Y < Hi.Y; ++Y)
+		{
+			StoreRunMasked(Data + CellIndex(Lo.X, Y, Z), RunLength, ValueBits, MaskBits);
+		}
+	}
+	return RunLength * (Hi.Y - Lo.Y) * (Hi.Z - Lo.Z);
+}
+
+int32 FDungeonGrid::FillBoxWhere(const FIntVector& Min, const FIntVector& MaxExclusive, uint32 MatchTypes,
+	const FDungeonCell& Value, const FDungeonCell& Mask, TFunctionRef<void(const FIntVector&)> OnWritten)
+{
+	FIntVector Lo = Min;
+	FIntVector Hi = MaxExclusive;
+	if (!ClipBox(Lo, Hi))
+	{
+		return 0;
+	}
+
+	const uint64 MaskBits = CellBits(Mask);
+	const uint64 ValueBits = CellBits(Value) & MaskBits;
+	FDungeonCell* Data = Cells.GetData();
+	int32 Written = 0;
+	for (int32 Z = Lo.Z; Z < Hi.Z; ++Z)
+	{
+		for (int32 Y = Lo.Y; Y < Hi.Y; ++Y)
+		{
+			FDungeonCell* Row = Data + CellIndex(0, Y, Z);
+			for (int32 X = Lo.X; X < Hi.X; ++X)
+			{
+				if ((MatchTypes & CellTypeBit(Row[X].CellType)) != 0)
+				{
+					StoreRunMasked(Row + X, 1, ValueBits, MaskBits);
+					MarkChanged();
+					OnWritten(FIntVector(X, Y, Z));
+					++Written;
+				}
+			}
+		}
+	}
+	return Written;
+}
+
 // ============================================================================
 // FDungeonResult
 // ============================================================================
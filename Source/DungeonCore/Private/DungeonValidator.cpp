@@ -1,6 +1,6 @@
 // DungeonValidator.cpp — Validates dungeon generation results for structural correctness
 #include "DungeonValidator.h"
-#include "DungeonConfig.h"
+#include "DungeonGenerationParams.h"
 
 // ---------------------------------------------------------------------------
 // FDungeonValidationResult
@@ -25,7 +25,7 @@ FString FDungeonValidationResult::GetSummary() const
 // ValidateAll
 // ---------------------------------------------------------------------------
 
-FDungeonValidationResult FDungeonValidator::ValidateAll(const FDungeonResult& Result, const UDungeonConfiguration& Config)
+FDungeonValidationResult FDungeonValidator::ValidateAll(const FDungeonResult& Result, const FDungeonGenerationParams& Params)
 {
 	FDungeonValidationResult Validation;
 
@@ -33,11 +33,11 @@ FDungeonValidationResult FDungeonValidator::ValidateAll(const FDungeonResult& Re
 	ValidateMetrics(Result, Validation.Issues);
 	ValidateCellBounds(Result, Validation.Issues);
 	ValidateNoRoomOverlap(Result, Validation.Issues);
-	ValidateRoomBuffer(Result, Config, Validation.Issues);
+	ValidateRoomBuffer(Result, Params, Validation.Issues);
 	ValidateRoomConnectivity(Result, Validation.Issues);
 	ValidateStaircaseHeadroom(Result, Validation.Issues);
 	ValidateReachability(Result, Validation.Issues);
-	ValidateRoomSemantics(Result, Config, Validation.Issues);
+	ValidateRoomSemantics(Result, Params, Validation.Issues);
 
 	Validation.bPassed = Validation.Issues.Num() == 0;
 	return Validation;
@@ -224,9 +224,9 @@ void FDungeonValidator::ValidateNoRoomOverlap(const FDungeonResult& Result, TArr
 // ValidateRoomBuffer
 // ---------------------------------------------------------------------------
 
-void FDungeonValidator::ValidateRoomBuffer(const FDungeonResult& Result, const UDungeonConfiguration& Config, TArray<FDungeonValidationIssue>& OutIssues)
+void FDungeonValidator::ValidateRoomBuffer(const FDungeonResult& Result, const FDungeonGenerationParams& Params, TArray<FDungeonValidationIssue>& OutIssues)
 {
-	const int32 Buffer = Config.RoomBuffer;
+	const int32 Buffer = Params.RoomBuffer;
 	if (Buffer <= 0)
 	{
 		return; // No buffer to enforce
@@ -350,7 +350,7 @@ void FDungeonValidator::ValidateStaircaseHeadroom(const FDungeonResult& Result,
 // ValidateRoomSemantics
 // ---------------------------------------------------------------------------
 
-void FDungeonValidator::ValidateRoomSemantics(const FDungeonResult& Result, const UDungeonConfiguration& Config, TArray<FDungeonValidationIssue>& OutIssues)
+void FDungeonValidator::ValidateRoomSemantics(const FDungeonResult& Result, const FDungeonGenerationParams& Params, TArray<FDungeonValidationIssue>& OutIssues)
 {
 	// 1. Exactly one Entrance room exists
 	int32 EntranceCount = 0;
@@ -375,7 +375,7 @@ void FDungeonValidator::ValidateRoomSemantics(const FDungeonResult& Result, cons
 	}
 
 	// 2. Boss guarantee
-	if (Config.bGuaranteeBossRoom && Result.Rooms.Num() > 1)
+	if (Params.bGuaranteeBossRoom && Result.Rooms.Num() > 1)
 	{
 		bool bHasBoss = false;
 		for (const FDungeonRoom& Room : Result.Rooms)
@@ -395,7 +395,7 @@ void FDungeonValidator::ValidateRoomSemantics(const FDungeonResult& Result, cons
 	}
 
 	// 3. Rule count limits — no over-assignment
-	for (const FDungeonRoomTypeRule& Rule : Config.RoomTypeRules)
+	for (const FDungeonRoomTypeRule& Rule : Params.RoomTypeRules)
 	{
 		if (Rule.RoomType == EDungeonRoomType::Entrance)
 		{
@@ -0,0 +1,466 @@
+#include "GeometricPredicates.h"
+#include "Algo/Sort.h"
+#include <cmath>
+
+// Expansion arithmetic depends on every operation rounding exactly as IEEE 754 specifies;
+// keep MSVC from contracting or reassociating it under /fp:fast.
+#if defined(_MSC_VER) && !defined(__clang__)
+#pragma float_control(precise, on, push)
+#endif
+
+namespace
+{
+	// ========================================================================
+	// Error bounds (Shewchuk, "Adaptive Precision Floating-Point Arithmetic
+	// and Fast Robust Geometric Predicates", 1997)
+	// ========================================================================
+
+	/** Half an ulp of 1.0: the relative rounding error of one double operation. */
+	constexpr double Epsilon = 1.1102230246251565e-16; // 2^-53
+	constexpr double Orient2DErrorBound = (3.0 + 16.0 * Epsilon) * Epsilon;
+	constexpr double InCircleErrorBound = (10.0 + 96.0 * Epsilon) * Epsilon;
+	constexpr double Orient3DErrorBound = (7.0 + 56.0 * Epsilon) * Epsilon;
+	constexpr double InSphereErrorBound = (16.0 + 224.0 * Epsilon) * Epsilon;
+
+	// ========================================================================
+	// Floating-point expansions: a value held exactly as a sum of non-overlapping
+	// doubles, smallest magnitude first, with zero components eliminated
+	// ========================================================================
+
+	using FExpansion = TArray<double, TInlineAllocator<64>>;
+
+	FORCEINLINE void TwoSum(double A, double B, double& OutSum, double& OutError)
+	{
+		OutSum = A + B;
+		const double BVirtual = OutSum - A;
+		const double AVirtual = OutSum - BVirtual;
+		OutError = (A - AVirtual) + (B - BVirtual);
+	}
+
+	FORCEINLINE void FastTwoSum(double A, double B, double& OutSum, double& OutError)
+	{
+		// Requires |A| >= |B|
+		OutSum = A + B;
+		OutError = B - (OutSum - A);
+	}
+
+	FORCEINLINE void TwoDiff(double A, double B, double& OutDiff, double& OutError)
+	{
+		OutDiff = A - B;
+		const double BVirtual = A - OutDiff;
+		const double AVirtual = OutDiff + BVirtual;
+		OutError = (A - AVirtual) + (BVirtual - B);
+	}
+
+	FORCEINLINE void TwoProduct(double A, double B, double& OutProduct, double& OutError)
+	{
+		// A fused multiply-add yields the rounding error exactly, and unlike Dekker's split it
+		// can't be broken by the compiler contracting the error terms into FMAs itself
+		OutProduct = A * B;
+		OutError = std::fma(A, B, -OutProduct);
+	}
+
+	/** Exact A - B as an expansion of one or two components. */
+	FExpansion Difference(double A, double B)
+	{
+		double Diff, Error;
+		TwoDiff(A, B, Diff, Error);
+		FExpansion Out;
+		if (Error != 0.0)
+		{
+			Out.Add(Error);
+		}
+		Out.Add(Diff);
+		return Out;
+	}
+
+	/** E + B (Grow-Expansion). */
+	FExpansion Grow(const FExpansion& E, double B)
+	{
+		FExpansion Out;
+		double Q = B;
+		for (const double Component : E)
+		{
+			double Sum, Error;
+			TwoSum(Q, Component, Sum, Error);
+			Q = Sum;
+			if (Error != 0.0)
+			{
+				Out.Add(Error);
+			}
+		}
+		if (Q != 0.0 || Out.Num() == 0)
+		{
+			Out.Add(Q);
+		}
+		return Out;
+	}
+
+	/** E + F, one component of F at a time. */
+	FExpansion Add(const FExpansion& E, const FExpansion& F)
+	{
+		FExpansion Out = E;
+		for (const double Component : F)
+		{
+			Out = Grow(Out, Component);
+		}
+		return Out;
+	}
+
+	FExpansion Negate(const FExpansion& E)
+	{
+		FExpansion Out = E;
+		for (double& Component : Out)
+		{
+			Component = -Component;
+		}
+		return Out;
+	}
+
+	FExpansion Subtract(const FExpansion& E, const FExpansion& F)
+	{
+		return Add(E, Negate(F));
+	}
+
+	/** E * B (Scale-Expansion). */
+	FExpansion Scale(const FExpansion& E, double B)
+	{
+		FExpansion Out;
+		double Q, Error;
+		TwoProduct(E[0], B, Q, Error);
+		if (Error != 0.0)
+		{
+			Out.Add(Error);
+		}
+		for (int32 i = 1; i < E.Num(); ++i)
+		{
+			double Product, ProductError, Sum;
+			TwoProduct(E[i], B, Product, ProductError);
+			TwoSum(Q, ProductError, Sum, Error);
+			if (Error != 0.0)
+			{
+				Out.Add(Error);
+			}
+			FastTwoSum(Product, Sum, Q, Error);
+			if (Error != 0.0)
+			{
+				Out.Add(Error);
+			}
+		}
+		if (Q != 0.0 || Out.Num() == 0)
+		{
+			Out.Add(Q);
+		}
+		return Out;
+	}
+
+	FExpansion Multiply(const FExpansion& E, const FExpansion& F)
+	{
+		FExpansion Out = Scale(E, F[0]);
+		for (int32 i = 1; i < F.Num(); ++i)
+		{
+			Out = Add(Out, Scale(E, F[i]));
+		}
+		return Out;
+	}
+
+	/** E[I]*F[J] - E[J]*F[I] */
+	FExpansion Cross2(const FExpansion* E, const FExpansion* F, int32 I, int32 J)
+	{
+		return Subtract(Multiply(E[I], F[J]), Multiply(E[J], F[I]));
+	}
+
+	/** The largest component carries the sign (and approximates the value). */
+	FORCEINLINE double Estimate(const FExpansion& E)
+	{
+		return E.Last();
+	}
+
+	// ========================================================================
+	// Exact fallbacks, mirroring the floating-point formulas term for term
+	// ========================================================================
+
+	double Orient2DExact(const FVector2D& A, const FVector2D& B, const FVector2D& C)
+	{
+		return Estimate(Subtract(
+			Multiply(Difference(A.X, C.X), Difference(B.Y, C.Y)),
+			Multiply(Difference(A.Y, C.Y), Difference(B.X, C.X))));
+	}
+
+	double InCircleExact(const FVector2D& A, const FVector2D& B, const FVector2D& C, const FVector2D& D)
+	{
+		const FVector2D* Rows[3] = { &A, &B, &C };
+		FExpansion DX[3], DY[3], Lift[3];
+		for (int32 i = 0; i < 3; ++i)
+		{
+			DX[i] = Difference(Rows[i]->X, D.X);
+			DY[i] = Difference(Rows[i]->Y, D.Y);
+			Lift[i] = Add(Multiply(DX[i], DX[i]), Multiply(DY[i], DY[i]));
+		}
+
+		return Estimate(Add(Add(
+			Multiply(Lift[0], Cross2(DX, DY, 1, 2)),
+			Multiply(Lift[1], Cross2(DX, DY, 2, 0))),
+			Multiply(Lift[2], Cross2(DX, DY, 0, 1))));
+	}
+
+	double Orient3DExact(const FVector& A, const FVector& B, const FVector& C, const FVector& D)
+	{
+		const FExpansion AB[3] = { Difference(B.X, A.X), Difference(B.Y, A.Y), Difference(B.Z, A.Z) };
+		const FExpansion AC[3] = { Difference(C.X, A.X), Difference(C.Y, A.Y), Difference(C.Z, A.Z) };
+		const FExpansion AD[3] = { Difference(D.X, A.X), Difference(D.Y, A.Y), Difference(D.Z, A.Z) };
+
+		const FExpansion CrossX = Subtract(Multiply(AB[1], AC[2]), Multiply(AB[2], AC[1]));
+		const FExpansion CrossY = Subtract(Multiply(AB[2], AC[0]), Multiply(AB[0], AC[2]));
+		const FExpansion CrossZ = Subtract(Multiply(AB[0], AC[1]), Multiply(AB[1], AC[0]));
+
+		return Estimate(Add(Add(Multiply(CrossX, AD[0]), Multiply(CrossY, AD[1])), Multiply(CrossZ, AD[2])));
+	}
+
+	double InSphereExact(const FVector& A, const FVector& B, const FVector& C, const FVector& D, const FVector& E)
+	{
+		const FVector* Rows[4] = { &A, &B, &C, &D };
+		FExpansion EX[4], EY[4], EZ[4], Lift[4];
+		for (int32 i = 0; i < 4; ++i)
+		{
+			EX[i] = Difference(Rows[i]->X, E.X);
+			EY[i] = Difference(Rows[i]->Y, E.Y);
+			EZ[i] = Difference(Rows[i]->Z, E.Z);
+			Lift[i] = Add(Add(Multiply(EX[i], EX[i]), Multiply(EY[i], EY[i])), Multiply(EZ[i], EZ[i]));
+		}
+
+		const FExpansion AB = Cross2(EX, EY, 0, 1);
+		const FExpansion BC = Cross2(EX, EY, 1, 2);
+		const FExpansion CD = Cross2(EX, EY, 2, 3);
+		const FExpansion DA = Cross2(EX, EY, 3, 0);
+		const FExpansion AC = Cross2(EX, EY, 0, 2);
+		const FExpansion BD = Cross2(EX, EY, 1, 3);
+
+		const FExpansion ABC = Add(Subtract(Multiply(EZ[0], BC), Multiply(EZ[1], AC)), Multiply(EZ[2], AB));
+		const FExpansion BCD = Add(Subtract(Multiply(EZ[1], CD), Multiply(EZ[2], BD)), Multiply(EZ[3], BC));
+		const FExpansion CDA = Add(Add(Multiply(EZ[2], DA), Multiply(EZ[3], AC)), Multiply(EZ[0], CD));
+		const FExpansion DAB = Add(Add(Multiply(EZ[3], AB), Multiply(EZ[0], BD)), Multiply(EZ[1], DA));
+
+		return Estimate(Add(
+			Subtract(Multiply(Lift[3], ABC), Multiply(Lift[2], DAB)),
+			Subtract(Multiply(Lift[1], CDA), Multiply(Lift[0], BCD))));
+	}
+}
+
+// ============================================================================
+// Predicates
+// ============================================================================
+
+double FGeometricPredicates::Orient2D(
+	const FVector2D& A, const FVector2D& B,
+	const FVector2D& C)
+{
+	const double Left = (A.X - C.X) * (B.Y - C.Y);
+	const double Right = (A.Y - C.Y) * (B.X - C.X);
+	const double Det = Left - Right;
+
+	const double ErrorBound = Orient2DErrorBound * (FMath::Abs(Left) + FMath::Abs(Right));
+	if (Det > ErrorBound || -Det > ErrorBound)
+	{
+		return Det;
+	}
+
+	return Orient2DExact(A, B, C);
+}
+
+double FGeometricPredicates::InCircle(
+	const FVector2D& A, const FVector2D& B,
+	const FVector2D& C, const FVector2D& D)
+{
+	const double ADX = A.X - D.X, BDX = B.X - D.X, CDX = C.X - D.X;
+	const double ADY = A.Y - D.Y, BDY = B.Y - D.Y, CDY = C.Y - D.Y;
+
+	const double BDXCDY = BDX * CDY, CDXBDY = CDX * BDY;
+	const double CDXADY = CDX * ADY, ADXCDY = ADX * CDY;
+	const double ADXBDY = ADX * BDY, BDXADY = BDX * ADY;
+
+	const double ALift = ADX * ADX + ADY * ADY;
+	const double BLift = BDX * BDX + BDY * BDY;
+	const double CLift = CDX * CDX + CDY * CDY;
+
+	const double Det = ALift * (BDXCDY - CDXBDY) + BLift * (CDXADY - ADXCDY) + CLift * (ADXBDY - BDXADY);
+
+	const double Permanent =
+		  (FMath::Abs(BDXCDY) + FMath::Abs(CDXBDY)) * ALift
+		+ (FMath::Abs(CDXADY) + FMath::Abs(ADXCDY)) * BLift
+		+ (FMath::Abs(ADXBDY) + FMath::Abs(BDXADY)) * CLift;
+	const double ErrorBound = InCircleErrorBound * Permanent;
+	if (Det > ErrorBound || -Det > ErrorBound)
+	{
+		return Det;
+	}
+
+	return InCircleExact(A, B, C, D);
+}
+
+double FGeometricPredicates::Orient3D(
+	const FVector& A, const FVector& B,
+	const FVector& C, const FVector& D)
+{
+	const double ABX = B.X - A.X, ABY = B.Y - A.Y, ABZ = B.Z - A.Z;
+	const double ACX = C.X - A.X, ACY = C.Y - A.Y, ACZ = C.Z - A.Z;
+	const double ADX = D.X - A.X, ADY = D.Y - A.Y, ADZ = D.Z - A.Z;
+
+	const double ABYACZ = ABY * ACZ, ABZACY = ABZ * ACY;
+	const double ABZACX = ABZ * ACX, ABXACZ = ABX * ACZ;
+	const double ABXACY = ABX * ACY, ABYACX = ABY * ACX;
+
+	const double Det = (ABYACZ - ABZACY) * ADX + (ABZACX - ABXACZ) * ADY + (ABXACY - ABYACX) * ADZ;
+
+	const double Permanent =
+		  (FMath::Abs(ABYACZ) + FMath::Abs(ABZACY)) * FMath::Abs(ADX)
+		+ (FMath::Abs(ABZACX) + FMath::Abs(ABXACZ)) * FMath::Abs(ADY)
+		+ (FMath::Abs(ABXACY) + FMath::Abs(ABYACX)) * FMath::Abs(ADZ);
+	const double ErrorBound = Orient3DErrorBound * Permanent;
+	if (Det > ErrorBound || -Det > ErrorBound)
+	{
+		return Det;
+	}
+
+	return Orient3DExact(A, B, C, D);
+}
+
+double FGeometricPredicates::InSphere(
+	const FVector& A, const FVector& B,
+	const FVector& C, const FVector& D,
+	const FVector& E)
+{
+	const double AEX = A.X - E.X, BEX = B.X - E.X, CEX = C.X - E.X, DEX = D.X - E.X;
+	const double AEY = A.Y - E.Y, BEY = B.Y - E.Y, CEY = C.Y - E.Y, DEY = D.Y - E.Y;
+	const double AEZ = A.Z - E.Z, BEZ = B.Z - E.Z, CEZ = C.Z - E.Z, DEZ = D.Z - E.Z;
+
+	const double AEXBEY = AEX * BEY, BEXAEY = BEX * AEY;
+	const double BEXCEY = BEX * CEY, CEXBEY = CEX * BEY;
+	const double CEXDEY = CEX * DEY, DEXCEY = DEX * CEY;
+	const double DEXAEY = DEX * AEY, AEXDEY = AEX * DEY;
+	const double AEXCEY = AEX * CEY, CEXAEY = CEX * AEY;
+	const double BEXDEY = BEX * DEY, DEXBEY = DEX * BEY;
+
+	const double AB = AEXBEY - BEXAEY;
+	const double BC = BEXCEY - CEXBEY;
+	const double CD = CEXDEY - DEXCEY;
+	const double DA = DEXAEY - AEXDEY;
+	const double AC = AEXCEY - CEXAEY;
+	const double BD = BEXDEY - DEXBEY;
+
+	const double ABC = AEZ * BC - BEZ * AC + CEZ * AB;
+	const double BCD = BEZ * CD - CEZ * BD + DEZ * BC;
+	const double CDA = CEZ * DA + DEZ * AC + AEZ * CD;
+	const double DAB = DEZ * AB + AEZ * BD + BEZ * DA;
+
+	const double ALift = AEX * AEX + AEY * AEY + AEZ * AEZ;
+	const double BLift = BEX * BEX + BEY * BEY + BEZ * BEZ;
+	const double CLift = CEX * CEX + CEY * CEY + CEZ * CEZ;
+	const double DLift = DEX * DEX + DEY * DEY + DEZ * DEZ;
+
+	// This is the determinant of the rows (P - E, |P - E|^2), which is negative when E is inside
+	// for our (right-handed) orientation; flip it on the way out
+	const double Det = (DLift * ABC - CLift * DAB) + (BLift * CDA - ALift * BCD);
+
+	// Same expression with every term made non-negative
+	const double AEZAbs = FMath::Abs(AEZ), BEZAbs = FMath::Abs(BEZ), CEZAbs = FMath::Abs(CEZ), DEZAbs = FMath::Abs(DEZ);
+	const double ABAbs = FMath::Abs(AEXBEY) + FMath::Abs(BEXAEY);
+	const double BCAbs = FMath::Abs(BEXCEY) + FMath::Abs(CEXBEY);
+	const double CDAbs = FMath::Abs(CEXDEY) + FMath::Abs(DEXCEY);
+	const double DAAbs = FMath::Abs(DEXAEY) + FMath::Abs(AEXDEY);
+	const double ACAbs = FMath::Abs(AEXCEY) + FMath::Abs(CEXAEY);
+	const double BDAbs = FMath::Abs(BEXDEY) + FMath::Abs(DEXBEY);
+	const double Permanent =
+		  (CDAbs * BEZAbs + BDAbs * CEZAbs + BCAbs * DEZAbs) * ALift
+		+ (DAAbs * CEZAbs + ACAbs * DEZAbs + CDAbs * AEZAbs) * BLift
+		+ (ABAbs * DEZAbs + BDAbs * AEZAbs + DAAbs * BEZAbs) * CLift
+		+ (BCAbs * AEZAbs + ACAbs * BEZAbs + ABAbs * CEZAbs) * DLift;
+	const double ErrorBound = InSphereErrorBound * Permanent;
+	if (Det > ErrorBound || -Det > ErrorBound)
+	{
+		return -Det;
+	}
+
+	return -InSphereExact(A, B, C, D, E);
+}
+
+int32 FGeometricPredicates::InSpherePerturbed(
+	TArrayView<const FVector> Points,
+	int32 A, int32 B, int32 C, int32 D, int32 E)
+{
+	const int32 Indices[5] = { A, B, C, D, E };
+	const double Det = InSphere(Points[A], Points[B], Points[C], Points[D], Points[E]);
+	if (Det != 0.0)
+	{
+		return Det > 0.0 ? 1 : -1;
+	}
+
+	// InSphere is minus the 5x5 determinant with rows (x, y, z, |p|^2, 1). Raising row i's lifted
+	// coordinate by d_i adds d_i * (-1)^i * Orient3D(other four rows, in order) to that determinant;
+	// with d_i infinitely larger for larger indices, the first non-zero term by descending index decides.
+	int32 Rows[5] = { 0, 1, 2, 3, 4 };
+	Algo::Sort(Rows, [&Indices](int32 L, int32 R) { return Indices[L] > Indices[R]; });
+
+	for (const int32 Row : Rows)
+	{
+		const FVector* Others[4];
+		int32 NumOthers = 0;
+		for (int32 i = 0; i < 5; ++i)
+		{
+			if (i != Row)
+			{
+				Others[NumOthers++] = &Points[Indices[i]];
+			}
+		}
+
+		const double Minor = Orient3D(*Others[0], *Others[1], *Others[2], *Others[3]);
+		if (Minor != 0.0)
+		{
+			const bool bDeterminantPositive = (Minor > 0.0) == ((Row & 1) == 0);
+			return bDeterminantPositive ? -1 : 1;
+		}
+	}
+	return 0;
+}
+
+int32 FGeometricPredicates::InCirclePerturbed(
+	TArrayView<const FVector2D> Points,
+	int32 A, int32 B, int32 C, int32 D)
+{
+	const int32 Indices[4] = { A, B, C, D };
+	const double Det = InCircle(Points[A], Points[B], Points[C], Points[D]);
+	if (Det != 0.0)
+	{
+		return Det > 0.0 ? 1 : -1;
+	}
+
+	// InCircle is the 4x4 determinant with rows (x, y, |p|^2, 1) itself, so the same expansion
+	// applies with Orient2D minors and no sign flip on the way out.
+	int32 Rows[4] = { 0, 1, 2, 3 };
+	Algo::Sort(Rows, [&Indices](int32 L, int32 R) { return Indices[L] > Indices[R]; });
+
+	for (const int32 Row : Rows)
+	{
+		const FVector2D* Others[3];
+		int32 NumOthers = 0;
+		for (int32 i = 0; i < 4; ++i)
+		{
+			if (i != Row)
+			{
+				Others[NumOthers++] = &Points[Indices[i]];
+			}
+		}
+
+		const double Minor = Orient2D(*Others[0], *Others[1], *Others[2]);
+		if (Minor != 0.0)
+		{
+			const bool bDeterminantPositive = (Minor > 0.0) == ((Row & 1) == 0);
+			return bDeterminantPositive ? 1 : -1;
+		}
+	}
+	return 0;
+}
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#pragma float_control(pop)
+#endif
@@ -1,6 +1,8 @@
 #include "HallwayPathfinder.h"
 #include "DungeonTypes.h"
-#include "DungeonConfig.h"
+#include "DungeonGenerationParams.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Misc/ScopeExit.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogDungeonPathfinder, Log, All);
 
@@ -31,397 +33,2210 @@ namespace
 			&& BelowCell.RoomIndex == RoomIndex;
 	}
 
-	float GetCellCost(
-		const FDungeonGrid& Grid,
-		const FIntVector& Coord,
-		const UDungeonConfiguration& Config,
-		uint8 SourceRoomIdx,
-		uint8 DestRoomIdx)
+	using ECostClass = FHallwayCostField::ECostClass;
+
+	ECostClass ClassifyCell(const FDungeonGrid& Grid, const FIntVector& Coord)
 	{
 		const FDungeonCell& Cell = Grid.GetCell(Coord);
 
 		switch (Cell.CellType)
 		{
 		case EDungeonCellType::Empty:
-		return 1.0f;
+			return ECostClass::Empty;
 		case EDungeonCellType::Hallway:
-		return Config.HallwayMergeCostMultiplier;
 		case EDungeonCellType::Door:
-			return Config.HallwayMergeCostMultiplier;
+			return ECostClass::Hallway;
 		case EDungeonCellType::Room:
 			// Block upper room cells — airspace above the ground floor has no walkable surface.
 			// Ground floor is detected by checking if the cell below belongs to the same room.
-			if (IsUpperRoomCell(Grid, Coord, Cell.RoomIndex))
+			return IsUpperRoomCell(Grid, Coord, Cell.RoomIndex) ? ECostClass::Blocked : ECostClass::Room;
+		case EDungeonCellType::RoomWall:
+			// Block upper room walls — can't break through walls above the ground floor.
+			return IsUpperRoomCell(Grid, Coord, Cell.RoomIndex) ? ECostClass::Blocked : ECostClass::RoomWall;
+		default:
+			return ECostClass::Blocked; // Staircase, StaircaseHead, Entrance
+		}
+	}
+
+	/**
+	 * One search's view of the cost field: class costs resolved from Params once, plus the
+	 * source/dest override (their room cells are free to cross).
+	 */
+	struct FCellCostLookup
+	{
+		const FDungeonGrid& Grid;
+		const FHallwayCostField& Field;
+		uint8 SourceRoomIdx;
+		uint8 DestRoomIdx;
+		float ClassCosts[FHallwayCostField::NumClasses];
+
+		FCellCostLookup(
+			const FDungeonGrid& InGrid,
+			const FHallwayCostField& InField,
+			const FDungeonGenerationParams& Params,
+			uint8 InSourceRoomIdx,
+			uint8 InDestRoomIdx)
+			: Grid(InGrid)
+			, Field(InField)
+			, SourceRoomIdx(InSourceRoomIdx)
+			, DestRoomIdx(InDestRoomIdx)
+		{
+			ClassCosts[static_cast<uint8>(ECostClass::Blocked)] = -1.0f;
+			ClassCosts[static_cast<uint8>(ECostClass::Empty)] = 1.0f;
+			ClassCosts[static_cast<uint8>(ECostClass::Hallway)] = Params.HallwayMergeCostMultiplier;
+			ClassCosts[static_cast<uint8>(ECostClass::Room)] = Params.RoomPassthroughCostMultiplier;
+			ClassCosts[static_cast<uint8>(ECostClass::RoomWall)] = 5.0f;
+		}
+
+		FORCEINLINE ECostClass GetClass(const FIntVector& Coord) const
+		{
+			return Field.GetClass(Grid.CellIndex(Coord));
+		}
+
+		/** Cost of entering Coord, or -1 if it is blocked. */
+		FORCEINLINE float GetCost(const FIntVector& Coord) const
+		{
+			const int32 GridIdx = Grid.CellIndex(Coord);
+			const ECostClass Class = Field.GetClass(GridIdx);
+			if (Class == ECostClass::Room)
+			{
+				const uint8 RoomIndex = Grid.Cells[GridIdx].RoomIndex;
+				if (RoomIndex == SourceRoomIdx || RoomIndex == DestRoomIdx)
+				{
+					return 0.0f;
+				}
+			}
+			return ClassCosts[static_cast<uint8>(Class)];
+		}
+	};
+
+	bool IsCellAvailableForStaircase(const FDungeonGrid& Grid, const FIntVector& Coord)
+	{
+		if (!Grid.IsInBounds(Coord)) return false;
+		const EDungeonCellType Type = Grid.GetCell(Coord).CellType;
+		// Only allow empty cells — existing hallways, staircases, and rooms are off-limits.
+		// This prevents new staircases from overlapping existing corridors.
+		return Type == EDungeonCellType::Empty;
+	}
+
+	/** Manhattan distance to the nearest cell of Box, with each floor weighted as a staircase's length. */
+	float Heuristic(const FIntVector& Coord, const FPathSearchWindow& Box, int32 RiseToRun)
+	{
+		auto AxisGap = [](int32 Value, int32 Min, int32 Max) { return FMath::Max3(Min - Value, Value - Max, 0); };
+		const float Horizontal = static_cast<float>(
+			AxisGap(Coord.X, Box.Min.X, Box.Max.X) + AxisGap(Coord.Y, Box.Min.Y, Box.Max.Y));
+		const float Vertical = static_cast<float>(AxisGap(Coord.Z, Box.Min.Z, Box.Max.Z)) * static_cast<float>(RiseToRun + 1);
+		return Horizontal + Vertical;
+	}
+
+	/** Heuristic's weighted distance between the closest cells of two boxes. */
+	float BoxDistance(const FPathSearchWindow& A, const FPathSearchWindow& B, int32 RiseToRun)
+	{
+		auto AxisGap = [](int32 MinA, int32 MaxA, int32 MinB, int32 MaxB) { return FMath::Max3(MinB - MaxA, MinA - MaxB, 0); };
+		const float Horizontal = static_cast<float>(
+			AxisGap(A.Min.X, A.Max.X, B.Min.X, B.Max.X) + AxisGap(A.Min.Y, A.Max.Y, B.Min.Y, B.Max.Y));
+		return Horizontal + static_cast<float>(AxisGap(A.Min.Z, A.Max.Z, B.Min.Z, B.Max.Z)) * static_cast<float>(RiseToRun + 1);
+	}
+
+	/**
+	 * Consistent heuristic for one half of a bidirectional search. Plain Heuristic overestimates
+	 * wherever a step costs less than 1 (hallways at HallwayMergeCostMultiplier, the free
+	 * source/dest rooms), which the bidirectional stopping rule can't tolerate. Here every step is
+	 * priced at MinStep, the cheapest non-free cell cost, and each side's region grows to cover its
+	 * free room plus the ring of cells a step into it starts from. The estimate is the distance to
+	 * the far region, or to the near one and across the gap, whichever is shorter, so crossing
+	 * either free room never drops it by more than the step costs.
+	 */
+	struct FBidirectionalHeuristic
+	{
+		FPathSearchWindow Near;
+		FPathSearchWindow Far;
+		float Gap;
+		float MinStep;
+		int32 RiseToRun;
+
+		FBidirectionalHeuristic(const FPathSearchWindow& InNear, const FPathSearchWindow& InFar, float InMinStep, int32 InRiseToRun)
+			: Near(InNear)
+			, Far(InFar)
+			, Gap(BoxDistance(InNear, InFar, InRiseToRun))
+			, MinStep(InMinStep)
+			, RiseToRun(InRiseToRun)
+		{
+		}
+
+		FORCEINLINE float operator()(const FIntVector& Coord) const
+		{
+			return MinStep * FMath::Min(Heuristic(Coord, Far, RiseToRun), Heuristic(Coord, Near, RiseToRun) + Gap);
+		}
+	};
+
+	/** Smallest box holding every cell. Cells must not be empty. */
+	FPathSearchWindow BoundsOf(TArrayView<const FIntVector> Cells)
+	{
+		FPathSearchWindow Bounds(Cells[0], Cells[0]);
+		for (const FIntVector& Cell : Cells)
+		{
+			Bounds.Min = FIntVector(FMath::Min(Bounds.Min.X, Cell.X), FMath::Min(Bounds.Min.Y, Cell.Y), FMath::Min(Bounds.Min.Z, Cell.Z));
+			Bounds.Max = FIntVector(FMath::Max(Bounds.Max.X, Cell.X), FMath::Max(Bounds.Max.Y, Cell.Y), FMath::Max(Bounds.Max.Z, Cell.Z));
+		}
+		return Bounds;
+	}
+
+	/**
+	 * 4-connected jump point scans on a single floor, using the canonical "horizontal first"
+	 * ordering: horizontal jumps probe up/down the column at every step, vertical jumps run
+	 * straight. Cells are Uniform (Empty, cost exactly 1), Other (enterable at a different cost —
+	 * hallways, doors, rooms, walls) or Blocked. Jumps land on Other cells, and stop beside them,
+	 * so those are still entered one at a time at their own cost.
+	 */
+	struct FJumpScanner
+	{
+		enum class ECellClass : uint8 { Uniform, Other, Blocked };
+
+		const FCellCostLookup& Costs;
+		const FPathSearchWindow& Window;
+		const FPathSearchWindow& Storage;
+		const FPathfinderWorkspace& WS;
+		int32 CellsScanned = 0;
+
+		/** Jumps always stop on a goal cell. Only called on cells Classify accepted (inside Window). */
+		bool IsGoal(const FIntVector& Coord) const
+		{
+			return WS.IsGoal(Storage.Index(Coord));
+		}
+
+		ECellClass Classify(const FIntVector& Coord) const
+		{
+			if (!Window.Contains(Coord) || WS.IsStaircaseReserved(Storage.Index(Coord)))
 			{
-				return -1.0f;
+				return ECellClass::Blocked;
 			}
-			if (Cell.RoomIndex == SourceRoomIdx || Cell.RoomIndex == DestRoomIdx)
+			switch (Costs.GetClass(Coord))
 			{
-				return 0.0f;
+			case ECostClass::Empty:
+				return ECellClass::Uniform;
+			case ECostClass::Blocked:
+				return ECellClass::Blocked;
+			default:
+				return ECellClass::Other;
 			}
-			return Config.RoomPassthroughCostMultiplier;
-		case EDungeonCellType::RoomWall:
-			// Block upper room walls — can't break through walls above the ground floor.
-			if (IsUpperRoomCell(Grid, Coord, Cell.RoomIndex))
+		}
+
+		/**
+		 * Entering Coord along (DX, DY): a side cell is forced if it opens up just past an obstacle
+		 * (only reachable optimally through Coord) or has a non-uniform cost.
+		 */
+		bool HasForcedNeighbor(const FIntVector& Coord, int32 DX, int32 DY) const
+		{
+			for (int32 Sign : {1, -1})
+			{
+				const int32 SX = DY * Sign;
+				const int32 SY = DX * Sign;
+				const ECellClass Side = Classify(FIntVector(Coord.X + SX, Coord.Y + SY, Coord.Z));
+				if (Side == ECellClass::Other)
+				{
+					return true;
+				}
+				if (Side == ECellClass::Uniform
+					&& Classify(FIntVector(Coord.X - DX + SX, Coord.Y - DY + SY, Coord.Z)) == ECellClass::Blocked)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/** True if a vertical jump from Coord along DY would land somewhere, making Coord a turning point. */
+		bool VerticalScanFindsJumpPoint(FIntVector Coord, int32 DY)
+		{
+			for (;;)
+			{
+				Coord.Y += DY;
+				CellsScanned++;
+				const ECellClass Class = Classify(Coord);
+				if (Class == ECellClass::Blocked)
+				{
+					return false;
+				}
+				if (Class == ECellClass::Other || IsGoal(Coord) || HasForcedNeighbor(Coord, 0, DY))
+				{
+					return true;
+				}
+			}
+		}
+
+		/** Jump from From along (DX, DY). On success returns the landing cell and the number of steps taken. */
+		bool Jump(const FIntVector& From, int32 DX, int32 DY, FIntVector& OutCoord, int32& OutSteps)
+		{
+			FIntVector Coord = From;
+			for (int32 Steps = 1; ; ++Steps)
+			{
+				Coord.X += DX;
+				Coord.Y += DY;
+				CellsScanned++;
+
+				const ECellClass Class = Classify(Coord);
+				if (Class == ECellClass::Blocked)
+				{
+					return false;
+				}
+				if (Class == ECellClass::Other || IsGoal(Coord) || HasForcedNeighbor(Coord, DX, DY)
+					|| (DX != 0 && (VerticalScanFindsJumpPoint(Coord, 1) || VerticalScanFindsJumpPoint(Coord, -1))))
+				{
+					OutCoord = Coord;
+					OutSteps = Steps;
+					return true;
+				}
+			}
+		}
+	};
+
+	/**
+	 * True if the body/headroom of a staircase starting at Entry overlaps, or is side-adjacent to,
+	 * one already planned by this search. Adjacency prevents elbow/U-staircase connections through
+	 * staircase sides within the same A* search (the grid check in CanBuildStaircase only sees
+	 * carved stairs).
+	 */
+	FORCEINLINE bool IsStaircaseBlockedByReservation(
+		const FPathSearchWindow& Storage,
+		const FPathfinderWorkspace& WS,
+		const FIntVector& Entry,
+		int32 DirX, int32 DirY,
+		int32 StairLowerZ,
+		int32 RiseToRun,
+		int32 HeadroomCells)
+	{
+		auto IsReserved = [&Storage, &WS](const FIntVector& Coord)
+		{
+			return Storage.Contains(Coord) && WS.IsStaircaseReserved(Storage.Index(Coord));
+		};
+
+		// Overlap with an already-planned staircase
+		for (int32 s = 1; s <= RiseToRun; ++s)
+		{
+			if (IsReserved(FIntVector(Entry.X + DirX * s, Entry.Y + DirY * s, StairLowerZ)))
+			{
+				return true;
+			}
+			for (int32 h = 1; h <= HeadroomCells; ++h)
+			{
+				if (IsReserved(FIntVector(Entry.X + DirX * s, Entry.Y + DirY * s, StairLowerZ + h)))
+				{
+					return true;
+				}
+			}
+		}
+
+		// Body and headroom cells must not be side-adjacent to reserved cells
+		for (int32 s = 1; s <= RiseToRun; ++s)
+		{
+			for (int32 h = 0; h <= HeadroomCells; ++h)
+			{
+				const FIntVector Cell(Entry.X + DirX * s, Entry.Y + DirY * s, StairLowerZ + h);
+				for (const FHDir& AdjDir : HorizontalDirs)
+				{
+					if (IsReserved(FIntVector(Cell.X + AdjDir.DX, Cell.Y + AdjDir.DY, Cell.Z)))
+					{
+						return true;
+					}
+				}
+			}
+		}
+
+		return false;
+	}
+
+	/** Claim the body and headroom cells of a planned staircase for the rest of this search. */
+	FORCEINLINE void ReserveStaircase(
+		const FPathSearchWindow& Storage,
+		FPathfinderWorkspace& WS,
+		const FIntVector& Entry,
+		int32 DirX, int32 DirY,
+		int32 StairLowerZ,
+		int32 RiseToRun,
+		int32 HeadroomCells)
+	{
+		for (int32 s = 1; s <= RiseToRun; ++s)
+		{
+			for (int32 h = 0; h <= HeadroomCells; ++h)
+			{
+				const FIntVector Cell(Entry.X + DirX * s, Entry.Y + DirY * s, StairLowerZ + h);
+				if (Storage.Contains(Cell))
+				{
+					WS.SetStaircaseReserved(Storage.Index(Cell));
+				}
+			}
+		}
+	}
+
+	/**
+	 * True if two staircases in Path collide, or a path cell lies in a staircase's body or
+	 * headroom. A single A* search rules both out through its reservations; paths stitched
+	 * together from several searches have to be checked afterwards.
+	 */
+	bool HasStaircaseConflicts(
+		const FDungeonGrid& Grid,
+		const TArray<FIntVector>& Path,
+		int32 RiseToRun,
+		int32 HeadroomCells,
+		FPathfinderWorkspace& WS)
+	{
+		const FPathSearchWindow Storage = FPathSearchWindow::FullGrid(Grid.GridSize);
+		WS.BeginSearch(Storage.Num());
+
+		for (int32 i = 0; i + 1 < Path.Num(); ++i)
+		{
+			const FIntVector& Entry = Path[i];
+			const FIntVector& Exit = Path[i + 1];
+			if (Entry.Z == Exit.Z) continue;
+
+			const int32 DirX = FMath::Sign(Exit.X - Entry.X);
+			const int32 DirY = FMath::Sign(Exit.Y - Entry.Y);
+			const int32 StairLowerZ = FMath::Min(Entry.Z, Exit.Z);
+			if (IsStaircaseBlockedByReservation(Storage, WS, Entry, DirX, DirY, StairLowerZ, RiseToRun, HeadroomCells))
+			{
+				return true;
+			}
+			ReserveStaircase(Storage, WS, Entry, DirX, DirY, StairLowerZ, RiseToRun, HeadroomCells);
+		}
+
+		for (const FIntVector& Cell : Path)
+		{
+			if (WS.IsStaircaseReserved(Storage.Index(Cell)))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	 * Dijkstra over the single-floor Box from every source at once, leaving G scores in WS
+	 * (indexed by Box). With bReverse a step pays for the cell it leaves rather than the one it
+	 * enters, so each score is the cost of walking from that cell to the nearest source.
+	 */
+	void FloodBox(
+		const FCellCostLookup& Costs,
+		const FPathSearchWindow& Box,
+		TArrayView<const FIntVector> Sources,
+		bool bReverse,
+		FPathfinderWorkspace& WS,
+		FPathfindStats& Stats)
+	{
+		using FNode = FPathfinderWorkspace::FOpenNode;
+		auto HeapPred = [](const FNode& A, const FNode& B) { return A.FScore < B.FScore; };
+
+		WS.BeginSearch(Box.Num());
+		for (const FIntVector& Source : Sources)
+		{
+			const int32 SourceIdx = Box.Index(Source);
+			WS.SetVisited(SourceIdx, 0.0f, -1);
+			WS.OpenSet.HeapPush(FNode{0.0f, SourceIdx}, HeapPred);
+		}
+
+		while (WS.OpenSet.Num() > 0)
+		{
+			FNode Node;
+			WS.OpenSet.HeapPop(Node, HeapPred);
+			Stats.NodesPopped++;
+
+			if (WS.IsClosed(Node.CellIdx))
+			{
+				Stats.StalePops++;
+				continue;
+			}
+			WS.SetClosed(Node.CellIdx);
+
+			const FIntVector Cur = Box.Coord(Node.CellIdx);
+			const float CurrentG = WS.GetGScore(Node.CellIdx);
+			const float CurrentCost = Costs.GetCost(Cur);
+
+			for (const FHDir& Dir : HorizontalDirs)
+			{
+				const FIntVector Next(Cur.X + Dir.DX, Cur.Y + Dir.DY, Cur.Z);
+				if (!Box.Contains(Next)) continue;
+
+				const int32 NextIdx = Box.Index(Next);
+				if (WS.IsClosed(NextIdx)) continue;
+
+				const float NextCost = Costs.GetCost(Next);
+				if (NextCost < 0.0f) continue;
+
+				const float TentativeG = CurrentG + FMath::Max(bReverse ? CurrentCost : NextCost, 0.001f);
+				if (TentativeG < WS.GetGScore(NextIdx))
+				{
+					WS.SetVisited(NextIdx, TentativeG, Node.CellIdx);
+					WS.OpenSet.HeapPush(FNode{TentativeG, NextIdx}, HeapPred);
+					Stats.NodesPushed++;
+				}
+			}
+		}
+	}
+}
+
+// ============================================================================
+// Search window
+// ============================================================================
+
+FPathSearchWindow FPathSearchWindow::FromRooms(
+	const FDungeonRoom& RoomA,
+	const FDungeonRoom& RoomB,
+	int32 Margin,
+	const FIntVector& GridSize)
+{
+	const FIntVector MinCorner(
+		FMath::Min(RoomA.Position.X, RoomB.Position.X),
+		FMath::Min(RoomA.Position.Y, RoomB.Position.Y),
+		FMath::Min(RoomA.Position.Z, RoomB.Position.Z));
+	const FIntVector MaxCorner(
+		FMath::Max(RoomA.Position.X + RoomA.Size.X, RoomB.Position.X + RoomB.Size.X) - 1,
+		FMath::Max(RoomA.Position.Y + RoomA.Size.Y, RoomB.Position.Y + RoomB.Size.Y) - 1,
+		FMath::Max(RoomA.Position.Z + RoomA.Size.Z, RoomB.Position.Z + RoomB.Size.Z) - 1);
+
+	const FIntVector Pad(FMath::Max(Margin, 0));
+	return FPathSearchWindow(MinCorner - Pad, MaxCorner + Pad).ClampedTo(GridSize);
+}
+
+FPathSearchWindow FPathSearchWindow::ClampedTo(const FIntVector& GridSize) const
+{
+	return FPathSearchWindow(
+		FIntVector(FMath::Max(Min.X, 0), FMath::Max(Min.Y, 0), FMath::Max(Min.Z, 0)),
+		FIntVector(
+			FMath::Min(Max.X, GridSize.X - 1),
+			FMath::Min(Max.Y, GridSize.Y - 1),
+			FMath::Min(Max.Z, GridSize.Z - 1)));
+}
+
+// ============================================================================
+// Radix open set
+// ============================================================================
+
+void FRadixOpenSet::Reset()
+{
+	for (TArray<FEntry>& Bucket : Buckets)
+	{
+		Bucket.Reset();
+	}
+	LastKey = 0;
+	Count = 0;
+}
+
+int32 FRadixOpenSet::Pop()
+{
+	check(Count > 0);
+
+	if (Buckets[0].Num() == 0)
+	{
+		// Advance LastKey to the smallest key in the first non-empty bucket. Every entry there
+		// now shares more leading bits with LastKey, so each moves to a strictly lower bucket.
+		int32 First = 1;
+		while (Buckets[First].Num() == 0)
+		{
+			++First;
+		}
+
+		TArray<FEntry>& Source = Buckets[First];
+		uint32 MinKey = MAX_uint32;
+		for (const FEntry& Entry : Source)
+		{
+			MinKey = FMath::Min(MinKey, Entry.Key);
+		}
+		LastKey = MinKey;
+
+		for (const FEntry& Entry : Source)
+		{
+			Buckets[BucketFor(Entry.Key)].Add(Entry);
+		}
+		Source.Reset();
+	}
+
+	Count--;
+	return Buckets[0].Pop(EAllowShrinking::No).CellIdx;
+}
+
+// ============================================================================
+// Workspace
+// ============================================================================
+
+void FPathfinderWorkspace::BeginSearch(int32 NumCells)
+{
+	if (Cells.Num() < NumCells)
+	{
+		// New entries get epoch 0, which never matches a live search
+		Cells.SetNumZeroed(NumCells);
+	}
+
+	if (++Epoch == 0)
+	{
+		// Wrapped after 2^32 searches: old stamps could alias the new epoch, so clear once
+		FMemory::Memzero(Cells.GetData(), Cells.Num() * sizeof(FCellState));
+		Epoch = 1;
+	}
+
+	OpenSet.Reset();
+	RadixOpenSet.Reset();
+}
+
+void FPathfinderWorkspace::NotifyCellChanged(const FDungeonGrid& Grid, const FIntVector& Coord)
+{
+	if (ChangeLog)
+	{
+		ChangeLog->Add(Coord);
+	}
+	CostField.UpdateCell(Grid, Coord);
+	StaircaseMasks.InvalidateAround(Grid, Coord);
+	if (ClusterGraph)
+	{
+		ClusterGraph->MarkDirty(Grid, Coord);
+	}
+}
+
+void FPathfinderWorkspace::NotifyCellsChanged(const FDungeonGrid& Grid, TArrayView<const FIntVector> Coords)
+{
+	if (ChangeLog)
+	{
+		ChangeLog->Append(Coords.GetData(), Coords.Num());
+	}
+	CostField.UpdateCells(Grid, Coords);
+	StaircaseMasks.InvalidateCells(Grid, Coords);
+	if (ClusterGraph)
+	{
+		ClusterGraph->MarkCellsDirty(Grid, Coords);
+	}
+}
+
+FPathfinderWorkspace& FPathfinderWorkspace::GetBackward()
+{
+	if (!Backward)
+	{
+		Backward = MakeUnique<FPathfinderWorkspace>();
+	}
+	return *Backward;
+}
+
+FHallwayClusterGraph& FPathfinderWorkspace::GetClusterGraph()
+{
+	if (!ClusterGraph)
+	{
+		ClusterGraph = MakeUnique<FHallwayClusterGraph>();
+	}
+	return *ClusterGraph;
+}
+
+// ============================================================================
+// Cost field
+// ============================================================================
+
+void FHallwayCostField::Bind(const FDungeonGrid& Grid)
+{
+	if (BoundRevision == Grid.GetRevision())
+	{
+		return;
+	}
+
+	BoundRevision = Grid.GetRevision();
+	const FIntVector GridSize = Grid.GridSize;
+
+	RoomBounds.Init(FPathSearchWindow(FIntVector(1, 0, 0), FIntVector::ZeroValue), 256);
+	Classes.SetNumUninitialized(Grid.Cells.Num());
+	int32 GridIdx = 0;
+	for (int32 Z = 0; Z < GridSize.Z; ++Z)
+	{
+		for (int32 Y = 0; Y < GridSize.Y; ++Y)
+		{
+			for (int32 X = 0; X < GridSize.X; ++X)
+			{
+				const ECostClass Class = ClassifyCell(Grid, FIntVector(X, Y, Z));
+				Classes[GridIdx++] = Class;
+				if (Class == ECostClass::Room)
+				{
+					IncludeInRoomBounds(Grid, FIntVector(X, Y, Z));
+				}
+			}
+		}
+	}
+}
+
+void FHallwayCostField::IncludeInRoomBounds(const FDungeonGrid& Grid, const FIntVector& Coord)
+{
+	FPathSearchWindow& Bounds = RoomBounds[Grid.GetCell(Coord).RoomIndex];
+	if (Bounds.Min.X > Bounds.Max.X)
+	{
+		Bounds = FPathSearchWindow(Coord, Coord);
+		return;
+	}
+	Bounds.Min = FIntVector(FMath::Min(Bounds.Min.X, Coord.X), FMath::Min(Bounds.Min.Y, Coord.Y), FMath::Min(Bounds.Min.Z, Coord.Z));
+	Bounds.Max = FIntVector(FMath::Max(Bounds.Max.X, Coord.X), FMath::Max(Bounds.Max.Y, Coord.Y), FMath::Max(Bounds.Max.Z, Coord.Z));
+}
+
+bool FHallwayCostField::GetRoomBounds(uint8 RoomIndex, FPathSearchWindow& OutBounds) const
+{
+	if (!RoomBounds.IsValidIndex(RoomIndex) || RoomBounds[RoomIndex].Min.X > RoomBounds[RoomIndex].Max.X)
+	{
+		return false;
+	}
+	OutBounds = RoomBounds[RoomIndex];
+	return true;
+}
+
+void FHallwayCostField::UpdateCell(const FDungeonGrid& Grid, const FIntVector& Coord)
+{
+	// Writers advance the revision before the change is reported, so a current field is at most
+	// one step behind. Any wider gap is an unreported edit (or another grid): leave it stale.
+	const uint64 Revision = Grid.GetRevision();
+	if (Classes.Num() == 0 || (Revision != BoundRevision && Revision != BoundRevision + 1))
+	{
+		return;
+	}
+	BoundRevision = Revision;
+
+	auto Reclassify = [this, &Grid](const FIntVector& Cell)
+	{
+		const ECostClass Class = ClassifyCell(Grid, Cell);
+		Classes[Grid.CellIndex(Cell)] = Class;
+		if (Class == ECostClass::Room)
+		{
+			IncludeInRoomBounds(Grid, Cell);
+		}
+	};
+
+	Reclassify(Coord);
+
+	const FIntVector Above(Coord.X, Coord.Y, Coord.Z + 1);
+	if (Grid.IsInBounds(Above))
+	{
+		Reclassify(Above);
+	}
+}
+
+void FHallwayCostField::UpdateCells(const FDungeonGrid& Grid, TArrayView<const FIntVector> Coords)
+{
+	if (Classes.Num() == 0)
+	{
+		return;
+	}
+
+	// The caller vouches that Coords is the whole change set, so the field is current afterwards
+	BoundRevision = Grid.GetRevision();
+	for (const FIntVector& Coord : Coords)
+	{
+		UpdateCell(Grid, Coord);
+	}
+}
+
+// ============================================================================
+// Staircase mask cache
+// ============================================================================
+
+void FStaircaseMaskCache::Bind(const FDungeonGrid& Grid, int32 InRiseToRun, int32 InHeadroomCells)
+{
+	if (BoundRevision == Grid.GetRevision() && RiseToRun == InRiseToRun && HeadroomCells == InHeadroomCells)
+	{
+		return;
+	}
+
+	BoundRevision = Grid.GetRevision();
+	GridSize = Grid.GridSize;
+	RiseToRun = InRiseToRun;
+	HeadroomCells = InHeadroomCells;
+
+	Masks.SetNumZeroed(Grid.Cells.Num());
+	Known.Init(false, Grid.Cells.Num());
+}
+
+void FStaircaseMaskCache::InvalidateAround(const FDungeonGrid& Grid, const FIntVector& Coord)
+{
+	// Same one-step rule as FHallwayCostField::UpdateCell
+	const uint64 Revision = Grid.GetRevision();
+	if (Known.Num() == 0 || (Revision != BoundRevision && Revision != BoundRevision + 1))
+	{
+		return;
+	}
+	BoundRevision = Revision;
+	ClearAround(Coord);
+}
+
+void FStaircaseMaskCache::InvalidateCells(const FDungeonGrid& Grid, TArrayView<const FIntVector> Coords)
+{
+	if (Known.Num() == 0)
+	{
+		return;
+	}
+
+	BoundRevision = Grid.GetRevision();
+	for (const FIntVector& Coord : Coords)
+	{
+		ClearAround(Coord);
+	}
+}
+
+void FStaircaseMaskCache::ClearAround(const FIntVector& Coord)
+{
+	// A staircase from Entry reads its body/headroom cells and their side neighbors (up to
+	// RiseToRun cells along its direction, one across) and its exit (RiseToRun+1 along), from
+	// Entry.Z-1 up to Entry.Z+HeadroomCells. Coord can therefore only affect entries in a plus
+	// shape around it, from HeadroomCells floors below to one floor above.
+	const int32 Reach = RiseToRun + 1;
+	const int32 MinZ = FMath::Max(Coord.Z - HeadroomCells, 0);
+	const int32 MaxZ = FMath::Min(Coord.Z + 1, GridSize.Z - 1);
+
+	auto ClearBox = [this, MinZ, MaxZ](int32 MinX, int32 MaxX, int32 MinY, int32 MaxY)
+	{
+		MinX = FMath::Max(MinX, 0);
+		MaxX = FMath::Min(MaxX, GridSize.X - 1);
+		MinY = FMath::Max(MinY, 0);
+		MaxY = FMath::Min(MaxY, GridSize.Y - 1);
+		for (int32 Z = MinZ; Z <= MaxZ; ++Z)
+		{
+			for (int32 Y = MinY; Y <= MaxY; ++Y)
+			{
+				const int32 RowStart = Y * GridSize.X + Z * GridSize.X * GridSize.Y;
+				for (int32 X = MinX; X <= MaxX; ++X)
+				{
+					Known[RowStart + X] = false;
+				}
+			}
+		}
+	};
+
+	ClearBox(Coord.X - Reach, Coord.X + Reach, Coord.Y - 1, Coord.Y + 1);
+	ClearBox(Coord.X - 1, Coord.X + 1, Coord.Y - Reach, Coord.Y + Reach);
+}
+
+// ============================================================================
+// Cluster graph
+// ============================================================================
+
+void FHallwayClusterGraph::Bind(const FDungeonGrid& Grid, const FDungeonGenerationParams& Params)
+{
+	const int32 InClusterSize = FMath::Clamp(Params.HierarchicalClusterSize, 4, 64);
+	if (BoundRevision == Grid.GetRevision() && ClusterSize == InClusterSize
+		&& RiseToRun == Params.StaircaseRiseToRun && HeadroomCells == Params.StaircaseHeadroom
+		&& HallwayCost == Params.HallwayMergeCostMultiplier && RoomCost == Params.RoomPassthroughCostMultiplier)
+	{
+		return;
+	}
+
+	BoundRevision = Grid.GetRevision();
+	GridSize = Grid.GridSize;
+	ClusterSize = InClusterSize;
+	ClustersX = FMath::DivideAndRoundUp(GridSize.X, ClusterSize);
+	ClustersY = FMath::DivideAndRoundUp(GridSize.Y, ClusterSize);
+	RiseToRun = Params.StaircaseRiseToRun;
+	HeadroomCells = Params.StaircaseHeadroom;
+	HallwayCost = Params.HallwayMergeCostMultiplier;
+	RoomCost = Params.RoomPassthroughCostMultiplier;
+
+	const int32 Count = ClustersX * ClustersY * GridSize.Z;
+	Nodes.Reset();
+	FreeNodes.Reset();
+	ClusterNodes.Reset();
+	ClusterNodes.SetNum(Count);
+	LinkNodes.Reset();
+	LinkNodes.SetNum(Count * NumLinkSlots);
+	DirtyClusters.Init(true, Count);
+	bAnyDirty = Count > 0;
+}
+
+void FHallwayClusterGraph::MarkDirty(const FDungeonGrid& Grid, const FIntVector& Coord)
+{
+	// Same one-step rule as FHallwayCostField::UpdateCell
+	const uint64 Revision = Grid.GetRevision();
+	if (DirtyClusters.Num() == 0 || (Revision != BoundRevision && Revision != BoundRevision + 1))
+	{
+		return;
+	}
+	BoundRevision = Revision;
+	MarkDirtyAround(Coord);
+}
+
+void FHallwayClusterGraph::MarkCellsDirty(const FDungeonGrid& Grid, TArrayView<const FIntVector> Coords)
+{
+	if (DirtyClusters.Num() == 0)
+	{
+		return;
+	}
+
+	BoundRevision = Grid.GetRevision();
+	for (const FIntVector& Coord : Coords)
+	{
+		MarkDirtyAround(Coord);
+	}
+}
+
+void FHallwayClusterGraph::MarkDirtyAround(const FIntVector& Coord)
+{
+	// Coord feeds the routes and border entrances of its own cluster, the entrances of the
+	// clusters beside it, and every staircase link whose body, headroom, side neighbors or exit
+	// reach it: up to RiseToRun+1 cells away, from HeadroomCells floors below to one floor above
+	// (that cell's cost class depends on what lies below).
+	const int32 Reach = RiseToRun + 1;
+	const int32 MinX = FMath::Max(Coord.X - Reach, 0) / ClusterSize;
+	const int32 MaxX = FMath::Min(Coord.X + Reach, GridSize.X - 1) / ClusterSize;
+	const int32 MinY = FMath::Max(Coord.Y - Reach, 0) / ClusterSize;
+	const int32 MaxY = FMath::Min(Coord.Y + Reach, GridSize.Y - 1) / ClusterSize;
+	const int32 MinZ = FMath::Max(Coord.Z - HeadroomCells, 0);
+	const int32 MaxZ = FMath::Min(Coord.Z + 1, GridSize.Z - 1);
+
+	for (int32 Z = MinZ; Z <= MaxZ; ++Z)
+	{
+		for (int32 Y = MinY; Y <= MaxY; ++Y)
+		{
+			for (int32 X = MinX; X <= MaxX; ++X)
+			{
+				DirtyClusters[X + Y * ClustersX + Z * ClustersX * ClustersY] = true;
+			}
+		}
+	}
+	bAnyDirty = true;
+}
+
+FPathSearchWindow FHallwayClusterGraph::ClusterBox(int32 Cluster) const
+{
+	const int32 FloorClusters = ClustersX * ClustersY;
+	const FIntVector Min(
+		(Cluster % ClustersX) * ClusterSize,
+		((Cluster % FloorClusters) / ClustersX) * ClusterSize,
+		Cluster / FloorClusters);
+	const FIntVector Max(
+		FMath::Min(Min.X + ClusterSize, GridSize.X) - 1,
+		FMath::Min(Min.Y + ClusterSize, GridSize.Y) - 1,
+		Min.Z);
+	return FPathSearchWindow(Min, Max);
+}
+
+int32 FHallwayClusterGraph::AddNode(const FIntVector& Cell, int32 Cluster)
+{
+	const int32 NodeIdx = FreeNodes.Num() > 0 ? FreeNodes.Pop(EAllowShrinking::No) : Nodes.AddDefaulted();
+	FNode& Node = Nodes[NodeIdx];
+	Node.Cell = Cell;
+	Node.Cluster = Cluster;
+	Node.Partner = INDEX_NONE;
+	Node.PartnerCost = 0.0f;
+	Node.bStaircase = false;
+	Node.Edges.Reset();
+
+	ClusterNodes[Cluster].Add(NodeIdx);
+	return NodeIdx;
+}
+
+void FHallwayClusterGraph::RemoveNode(int32 NodeIdx)
+{
+	FNode& Node = Nodes[NodeIdx];
+	ClusterNodes[Node.Cluster].RemoveSingle(NodeIdx);
+	Node.Cluster = INDEX_NONE;
+	Node.Partner = INDEX_NONE;
+	Node.Edges.Reset();
+
+	FreeNodes.Add(NodeIdx);
+}
+
+// ============================================================================
+// Staircase validation
+// ============================================================================
+
+uint8 FHallwayPathfinder::GetStaircaseMask(
+	const FDungeonGrid& Grid,
+	const FIntVector& Coord,
+	int32 RiseToRun,
+	int32 HeadroomCells,
+	FStaircaseMaskCache& Cache,
+	FPathfindStats& Stats)
+{
+	const int32 GridIdx = Grid.CellIndex(Coord);
+	if (Cache.IsKnown(GridIdx))
+	{
+		return Cache.GetMask(GridIdx);
+	}
+
+	uint8 Mask = 0;
+	for (int32 DirIdx = 0; DirIdx < UE_ARRAY_COUNT(HorizontalDirs); ++DirIdx)
+	{
+		for (int32 Rise : {+1, -1})
+		{
+			FIntVector ExitCell;
+			if (CanBuildStaircase(Grid, Coord, HorizontalDirs[DirIdx].DX, HorizontalDirs[DirIdx].DY, Rise,
+			                      RiseToRun, HeadroomCells, ExitCell))
+			{
+				Mask |= FStaircaseMaskCache::MoveBit(DirIdx, Rise);
+			}
+		}
+	}
+
+	Cache.SetMask(GridIdx, Mask);
+	Stats.StaircaseMaskMisses++;
+	return Mask;
+}
+
+bool FHallwayPathfinder::CanBuildStaircase(
+	const FDungeonGrid& Grid,
+	const FIntVector& Entry,
+	int32 DirX, int32 DirY,
+	int32 Rise,
+	int32 RiseToRun,
+	int32 HeadroomCells,
+	FIntVector& OutExit)
+{
+	// Body cells are on the lower floor, headroom above them (Z is up)
+	const int32 LowerZ = (Rise > 0) ? Entry.Z : Entry.Z - 1;
+	const int32 UpperZ = LowerZ + 1;
+
+	if (LowerZ < 0 || UpperZ >= Grid.GridSize.Z)
+	{
+		return false;
+	}
+
+	// Check body cells (RiseToRun cells on the lower floor, in the horizontal direction)
+	for (int32 i = 1; i <= RiseToRun; ++i)
+	{
+		const FIntVector BodyCell(Entry.X + DirX * i, Entry.Y + DirY * i, LowerZ);
+		if (!IsCellAvailableForStaircase(Grid, BodyCell))
+		{
+			return false;
+		}
+	}
+
+	// Check that body cells aren't adjacent to existing staircase zones.
+	// This prevents back-to-back and side-by-side staircase placement.
+	for (int32 i = 1; i <= RiseToRun; ++i)
+	{
+		const FIntVector BodyCell(Entry.X + DirX * i, Entry.Y + DirY * i, LowerZ);
+		for (const FHDir& HDir : HorizontalDirs)
+		{
+			const FIntVector Neighbor(BodyCell.X + HDir.DX, BodyCell.Y + HDir.DY, BodyCell.Z);
+			if (!Grid.IsInBounds(Neighbor)) continue;
+			const EDungeonCellType NType = Grid.GetCell(Neighbor).CellType;
+			if (NType == EDungeonCellType::Staircase || NType == EDungeonCellType::StaircaseHead)
+			{
+				return false;
+			}
+		}
+	}
+
+	// Check headroom cells above each body cell
+	for (int32 i = 1; i <= RiseToRun; ++i)
+	{
+		for (int32 h = 1; h <= HeadroomCells; ++h)
+		{
+			const FIntVector HeadCell(Entry.X + DirX * i, Entry.Y + DirY * i, LowerZ + h);
+			if (!Grid.IsInBounds(HeadCell))
+			{
+				// Headroom out of bounds on higher floors is OK (open sky)
+				continue;
+			}
+			if (!IsCellAvailableForStaircase(Grid, HeadCell))
+			{
+				return false;
+			}
+
+			// Headroom cells must not be cardinally adjacent to existing staircases
+			for (const FHDir& HDir : HorizontalDirs)
+			{
+				const FIntVector Adj(HeadCell.X + HDir.DX, HeadCell.Y + HDir.DY, HeadCell.Z);
+				if (!Grid.IsInBounds(Adj)) continue;
+				const EDungeonCellType AdjType = Grid.GetCell(Adj).CellType;
+				if (AdjType == EDungeonCellType::Staircase || AdjType == EDungeonCellType::StaircaseHead)
+				{
+					return false;
+				}
+			}
+		}
+	}
+
+	// Check exit cell (one step past the staircase on the target floor)
+	const int32 TargetZ = (Rise > 0) ? UpperZ : LowerZ;
+	OutExit = FIntVector(
+		Entry.X + DirX * (RiseToRun + 1),
+		Entry.Y + DirY * (RiseToRun + 1),
+		TargetZ);
+
+	if (!Grid.IsInBounds(OutExit))
+	{
+		return false;
+	}
+
+	// Exit cell must be available (Empty, Hallway, or dest room)
+	const FDungeonCell& ExitCell = Grid.GetCell(OutExit);
+	if (ExitCell.CellType != EDungeonCellType::Empty &&
+		ExitCell.CellType != EDungeonCellType::Hallway &&
+		ExitCell.CellType != EDungeonCellType::Room)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+// ============================================================================
+// A* Pathfinding
+// ============================================================================
+
+bool FHallwayPathfinder::FindPath(
+	const FDungeonGrid& Grid,
+	const FIntVector& Start,
+	const FIntVector& End,
+	const FDungeonGenerationParams& Params,
+	uint8 SourceRoomIdx,
+	uint8 DestRoomIdx,
+	TArray<FIntVector>& OutPath,
+	FPathfindStats* OutStats,
+	FPathfinderWorkspace* Workspace,
+	const FPathSearchWindow* Window)
+{
+	return FindPath(Grid, MakeArrayView(&Start, 1), MakeArrayView(&End, 1), Params,
+		SourceRoomIdx, DestRoomIdx, OutPath, OutStats, Workspace, Window);
+}
+
+bool FHallwayPathfinder::FindPath(
+	const FDungeonGrid& Grid,
+	TArrayView<const FIntVector> Starts,
+	TArrayView<const FIntVector> Goals,
+	const FDungeonGenerationParams& Params,
+	uint8 SourceRoomIdx,
+	uint8 DestRoomIdx,
+	TArray<FIntVector>& OutPath,
+	FPathfindStats* OutStats,
+	FPathfinderWorkspace* Workspace,
+	const FPathSearchWindow* Window)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(Dungeon_FindPath);
+
+	// Counters go to a local and are copied out once, so the hot loop never branches on OutStats
+	FPathfindStats Stats;
+	const double StartTime = FPlatformTime::Seconds();
+	ON_SCOPE_EXIT
+	{
+		if (OutStats)
+		{
+			Stats.WallTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+			Stats.bFoundPath = OutPath.Num() > 0;
+			*OutStats = Stats;
+		}
+	};
+
+	OutPath.Reset();
+
+	if (Starts.Num() == 0 || Goals.Num() == 0)
+	{
+		return false;
+	}
+
+	auto AllInside = [](TArrayView<const FIntVector> Cells, auto&& Inside)
+	{
+		for (const FIntVector& Cell : Cells)
+		{
+			if (!Inside(Cell)) return false;
+		}
+		return true;
+	};
+
+	auto InGrid = [&Grid](const FIntVector& Cell) { return Grid.IsInBounds(Cell); };
+	if (!AllInside(Starts, InGrid) || !AllInside(Goals, InGrid))
+	{
+		return false;
+	}
+
+	for (const FIntVector& Start : Starts)
+	{
+		if (Goals.Contains(Start))
+		{
+			OutPath.Add(Start);
+			return true;
+		}
+	}
+
+	FPathfinderWorkspace LocalWorkspace;
+	FPathfinderWorkspace& WS = Workspace ? *Workspace : LocalWorkspace;
+	WS.CostField.Bind(Grid);
+	WS.StaircaseMasks.Bind(Grid, Params.StaircaseRiseToRun, Params.StaircaseHeadroom);
+
+	if (Params.HallwaySearchMode == EDungeonHallwaySearch::Hierarchical)
+	{
+		if (FindPathHierarchical(Grid, Starts, Goals, Params, SourceRoomIdx, DestRoomIdx, WS, Stats, OutPath)
+			&& !HasStaircaseConflicts(Grid, OutPath, Params.StaircaseRiseToRun, Params.StaircaseHeadroom, WS))
+		{
+			return true;
+		}
+
+		// No abstract route, or its legs don't fit together — search the cells directly
+		OutPath.Reset();
+		Stats.HierarchicalFallbacks++;
+	}
+
+	// Short hallways gain nothing from a second frontier; only long ones go bidirectional.
+	// Distance is the gap between the two sets' bounding boxes (Manhattan for single cells).
+	const FPathSearchWindow StartBounds = BoundsOf(Starts);
+	const FPathSearchWindow GoalBounds = BoundsOf(Goals);
+	auto AxisGap = [](int32 MinA, int32 MaxA, int32 MinB, int32 MaxB) { return FMath::Max3(MinB - MaxA, MinA - MaxB, 0); };
+	const int32 Gap = AxisGap(StartBounds.Min.X, StartBounds.Max.X, GoalBounds.Min.X, GoalBounds.Max.X)
+		+ AxisGap(StartBounds.Min.Y, StartBounds.Max.Y, GoalBounds.Min.Y, GoalBounds.Max.Y)
+		+ AxisGap(StartBounds.Min.Z, StartBounds.Max.Z, GoalBounds.Min.Z, GoalBounds.Max.Z);
+	const bool bBidirectional = Params.HallwaySearchMode == EDungeonHallwaySearch::Bidirectional
+		&& Gap >= Params.BidirectionalMinDistance;
+	const bool bJumpPoints = Params.HallwaySearchMode == EDungeonHallwaySearch::JumpPoint;
+
+	auto Search = [&](const FPathSearchWindow& SearchWindow)
+	{
+		return bBidirectional
+			? FindPathBidirectionalInWindow(Grid, Starts, Goals, Params, SourceRoomIdx, DestRoomIdx, SearchWindow, WS, Stats, OutPath)
+			: FindPathInWindow(Grid, Starts, Goals, Params, SourceRoomIdx, DestRoomIdx, SearchWindow, bJumpPoints, WS, Stats, OutPath);
+	};
+
+	auto InWindow = [Window](const FIntVector& Cell) { return Window->Contains(Cell); };
+	if (Window && !Window->CoversGrid(Grid.GridSize)
+		&& AllInside(Starts, InWindow) && AllInside(Goals, InWindow))
+	{
+		if (Search(*Window))
+		{
+			return true;
+		}
+
+		// Window too tight (route blocked or detour needed) — retry unconstrained
+		Stats.WindowFallbacks++;
+	}
+
+	return Search(FPathSearchWindow::FullGrid(Grid.GridSize));
+}
+
+void FHallwayPathfinder::GetRoomBoundaryCells(const FDungeonRoom& Room, TArray<FIntVector>& OutCells)
+{
+	OutCells.Reset();
+	const FIntVector& Min = Room.Position;
+	const FIntVector Max = Room.Position + FIntVector(Room.Size.X - 1, Room.Size.Y - 1, 0);
+
+	for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+	{
+		for (int32 X = Min.X; X <= Max.X; ++X)
+		{
+			if (X == Min.X || X == Max.X || Y == Min.Y || Y == Max.Y)
+			{
+				OutCells.Add(FIntVector(X, Y, Min.Z));
+			}
+		}
+	}
+}
+
+bool FHallwayPathfinder::FindPathInWindow(
+	const FDungeonGrid& Grid,
+	TArrayView<const FIntVector> Starts,
+	TArrayView<const FIntVector> Goals,
+	const FDungeonGenerationParams& Params,
+	uint8 SourceRoomIdx,
+	uint8 DestRoomIdx,
+	const FPathSearchWindow& Window,
+	bool bJumpPoints,
+	FPathfinderWorkspace& WS,
+	FPathfindStats& Stats,
+	TArray<FIntVector>& OutPath,
+	TArrayView<const FIntVector> BlockedCells)
+{
+	// Pick a kernel once per search: single-floor windows never consider staircases, and the
+	// default 2:1 ratio with 2 cells of headroom gets its staircase loops unrolled
+	if (Window.Max.Z == Window.Min.Z)
+	{
+		return FindPathInWindowKernel<false, 0, 0>(Grid, Starts, Goals, Params, SourceRoomIdx, DestRoomIdx,
+			Window, bJumpPoints, WS, Stats, OutPath, BlockedCells);
+	}
+	if (Params.StaircaseRiseToRun == 2 && Params.StaircaseHeadroom == 2)
+	{
+		return FindPathInWindowKernel<true, 2, 2>(Grid, Starts, Goals, Params, SourceRoomIdx, DestRoomIdx,
+			Window, bJumpPoints, WS, Stats, OutPath, BlockedCells);
+	}
+	return FindPathInWindowKernel<true, 0, 0>(Grid, Starts, Goals, Params, SourceRoomIdx, DestRoomIdx,
+		Window, bJumpPoints, WS, Stats, OutPath, BlockedCells);
+}
+
+template <bool bMultiFloor, int32 FixedRiseToRun, int32 FixedHeadroom>
+bool FHallwayPathfinder::FindPathInWindowKernel(
+	const FDungeonGrid& Grid,
+	TArrayView<const FIntVector> Starts,
+	TArrayView<const FIntVector> Goals,
+	const FDungeonGenerationParams& Params,
+	uint8 SourceRoomIdx,
+	uint8 DestRoomIdx,
+	const FPathSearchWindow& Window,
+	bool bJumpPoints,
+	FPathfinderWorkspace& WS,
+	FPathfindStats& Stats,
+	TArray<FIntVector>& OutPath,
+	TArrayView<const FIntVector> BlockedCells)
+{
+	const int32 RiseToRun = FixedRiseToRun > 0 ? FixedRiseToRun : Params.StaircaseRiseToRun;
+	const int32 HeadroomCells = FixedHeadroom > 0 ? FixedHeadroom : Params.StaircaseHeadroom;
+
+	// Nodes (path cells and staircase exits) stay inside Window. Staircase reservations also
+	// touch headroom above the top floor and side neighbors one cell outside, so the workspace
+	// covers Window grown by that halo. For the full grid the halo clamps away and workspace
+	// indices equal grid indices.
+	const FPathSearchWindow Storage = FPathSearchWindow(
+		Window.Min - FIntVector(1, 1, 0),
+		Window.Max + FIntVector(1, 1, HeadroomCells)).ClampedTo(Grid.GridSize);
+
+	// Per-cell G/CameFrom/closed/staircase-reserved/goal state, reset in O(1) per search.
+	// Staircase reservations stop a second staircase stacking on one already planned by this search.
+	WS.BeginSearch(Storage.Num());
+	for (const FIntVector& Cell : BlockedCells)
+	{
+		if (Storage.Contains(Cell))
+		{
+			WS.SetStaircaseReserved(Storage.Index(Cell));
+		}
+	}
+
+	// The heuristic aims at the goals' bounding box; for a single goal that is plain Manhattan
+	const FPathSearchWindow GoalBounds = BoundsOf(Goals);
+	for (const FIntVector& Goal : Goals)
+	{
+		WS.SetGoal(Storage.Index(Goal));
+	}
+
+	// Open set: binary min-heap on float F, or radix heap on fixed-point F (bUseRadixOpenSet)
+	using FNode = FPathfinderWorkspace::FOpenNode;
+	auto HeapPred = [](const FNode& A, const FNode& B) { return A.FScore < B.FScore; };
+	const bool bRadix = Params.bUseRadixOpenSet;
+
+	auto OpenSetNum = [&WS, bRadix]()
+	{
+		return bRadix ? WS.RadixOpenSet.Num() : WS.OpenSet.Num();
+	};
+
+	auto PushOpen = [&](float FScore, int32 CellIdx)
+	{
+		if (bRadix)
+		{
+			WS.RadixOpenSet.Push(FScore, CellIdx);
+		}
+		else
+		{
+			WS.OpenSet.HeapPush(FNode{FScore, CellIdx}, HeapPred);
+		}
+		Stats.NodesPushed++;
+		Stats.PeakOpenSetSize = FMath::Max(Stats.PeakOpenSetSize, OpenSetNum());
+	};
+
+	auto PopOpen = [&]()
+	{
+		if (bRadix)
+		{
+			return WS.RadixOpenSet.Pop();
+		}
+		FNode Node;
+		WS.OpenSet.HeapPop(Node, HeapPred);
+		return Node.CellIdx;
+	};
+
+	for (const FIntVector& Start : Starts)
+	{
+		const int32 StartIdx = Storage.Index(Start);
+		WS.SetVisited(StartIdx, 0.0f, -1);
+		PushOpen(Heuristic(Start, GoalBounds, RiseToRun), StartIdx);
+	}
+
+	const FCellCostLookup Costs(Grid, WS.CostField, Params, SourceRoomIdx, DestRoomIdx);
+
+	FJumpScanner Scanner{Costs, Window, Storage, WS};
+	ON_SCOPE_EXIT
+	{
+		Stats.JumpScanCells += Scanner.CellsScanned;
+	};
+
+	while (OpenSetNum() > 0)
+	{
+		const int32 CurrentIdx = PopOpen();
+		Stats.NodesPopped++;
+
+		if (WS.IsGoal(CurrentIdx))
+		{
+			// Reconstruct path
+			int32 Idx = CurrentIdx;
+			while (Idx != -1)
+			{
+				const FIntVector Coord = Storage.Coord(Idx);
+
+				// Jump point edges skip straight runs on one floor; fill the skipped cells back in
+				if (OutPath.Num() > 0 && OutPath.Last().Z == Coord.Z)
+				{
+					const FIntVector Prev = OutPath.Last();
+					const FIntVector Step(FMath::Sign(Coord.X - Prev.X), FMath::Sign(Coord.Y - Prev.Y), 0);
+					for (FIntVector Fill = Prev + Step; Fill != Coord; Fill += Step)
+					{
+						OutPath.Add(Fill);
+					}
+				}
+
+				OutPath.Add(Coord);
+				Idx = WS.GetCameFrom(Idx);
+			}
+			Algo::Reverse(OutPath);
+			return true;
+		}
+
+		if (WS.IsClosed(CurrentIdx))
+		{
+			Stats.StalePops++;
+			continue;
+		}
+		WS.SetClosed(CurrentIdx);
+		const float CurrentG = WS.GetGScore(CurrentIdx);
+
+		// Decode current position
+		const FIntVector CurCoord = Storage.Coord(CurrentIdx);
+		if (WS.ExploredCells)
+		{
+			WS.ExploredCells->Add(Grid.CellIndex(CurCoord));
+		}
+		const int32 CurX = CurCoord.X;
+		const int32 CurY = CurCoord.Y;
+		const int32 CurZ = CurCoord.Z;
+
+		// --- Jump point moves (goal floor only) ---
+		// Off the goal floor a staircase may be worth starting from any cell, so those floors keep
+		// single-cell expansion.
+		const bool bJumpThisFloor = bJumpPoints && CurZ == GoalBounds.Min.Z && CurZ == GoalBounds.Max.Z;
+		if (bJumpThisFloor)
+		{
+			// Never jump straight back toward the parent — the parent already covered that run
+			const int32 ParentIdx = WS.GetCameFrom(CurrentIdx);
+			const FIntVector ParentCoord = ParentIdx != -1 ? Storage.Coord(ParentIdx) : CurCoord;
+			const int32 BackDX = ParentCoord.Z == CurZ ? FMath::Sign(ParentCoord.X - CurX) : 0;
+			const int32 BackDY = ParentCoord.Z == CurZ ? FMath::Sign(ParentCoord.Y - CurY) : 0;
+
+			for (const FHDir& Dir : HorizontalDirs)
+			{
+				if ((BackDX != 0 || BackDY != 0) && Dir.DX == BackDX && Dir.DY == BackDY) continue;
+
+				FIntVector JumpCoord;
+				int32 Steps = 0;
+				if (!Scanner.Jump(CurCoord, Dir.DX, Dir.DY, JumpCoord, Steps)) continue;
+
+				const int32 JumpIdx = Storage.Index(JumpCoord);
+				if (WS.IsClosed(JumpIdx)) continue;
+
+				// Steps-1 Empty cells at cost 1, then the landing cell at its own cost
+				const float LandCost = Costs.GetCost(JumpCoord);
+				const float TentativeG = CurrentG + static_cast<float>(Steps - 1) + FMath::Max(LandCost, 0.001f);
+				if (TentativeG < WS.GetGScore(JumpIdx))
+				{
+					WS.SetVisited(JumpIdx, TentativeG, CurrentIdx);
+					PushOpen(TentativeG + Heuristic(JumpCoord, GoalBounds, RiseToRun), JumpIdx);
+				}
+			}
+		}
+		// --- Same-floor cardinal moves (XY plane) ---
+		else
+		{
+			for (const FHDir& Dir : HorizontalDirs)
+			{
+				const FIntVector NeighborCoord(CurX + Dir.DX, CurY + Dir.DY, CurZ);
+				if (!Window.Contains(NeighborCoord)) continue;
+
+				const int32 NeighborIdx = Storage.Index(NeighborCoord);
+				if (WS.IsClosed(NeighborIdx)) continue;
+				if (WS.IsStaircaseReserved(NeighborIdx)) continue;
+
+				const float MoveCost = Costs.GetCost(NeighborCoord);
+				if (MoveCost < 0.0f) continue;
+
+				const float TentativeG = CurrentG + FMath::Max(MoveCost, 0.001f);
+				if (TentativeG < WS.GetGScore(NeighborIdx))
+				{
+					WS.SetVisited(NeighborIdx, TentativeG, CurrentIdx);
+					PushOpen(TentativeG + Heuristic(NeighborCoord, GoalBounds, RiseToRun), NeighborIdx);
+				}
+			}
+		}
+
+		// --- Staircase moves (4 directions × up/down along Z) ---
+		if constexpr (bMultiFloor)
+		{
+			const uint8 StairMask = GetStaircaseMask(Grid, CurCoord, RiseToRun, HeadroomCells, WS.StaircaseMasks, Stats);
+			for (int32 DirIdx = 0; DirIdx < UE_ARRAY_COUNT(HorizontalDirs); ++DirIdx)
+			{
+				const FHDir& Dir = HorizontalDirs[DirIdx];
+				for (int32 Rise : {+1, -1})
+				{
+					Stats.StaircaseProbes++;
+					if (!(StairMask & FStaircaseMaskCache::MoveBit(DirIdx, Rise)))
+					{
+						Stats.StaircaseRejections++;
+						continue;
+					}
+
+					const FIntVector ExitCell(
+						CurX + Dir.DX * (RiseToRun + 1), CurY + Dir.DY * (RiseToRun + 1), CurZ + Rise);
+					if (!Window.Contains(ExitCell)) continue;
+
+					const int32 ExitIdx = Storage.Index(ExitCell);
+					if (WS.IsClosed(ExitIdx)) continue;
+					if (WS.IsStaircaseReserved(ExitIdx)) continue;
+
+					const int32 StairLowerZ = (Rise > 0) ? CurZ : CurZ - 1;
+					if (IsStaircaseBlockedByReservation(Storage, WS, CurCoord, Dir.DX, Dir.DY,
+					                                    StairLowerZ, RiseToRun, HeadroomCells))
+					{
+						continue;
+					}
+
+					// Cost: traverse RiseToRun body cells + exit cell
+					const float StaircaseCost = static_cast<float>(RiseToRun + 1) * 5.0f;
+					const float ExitCellCost = Costs.GetCost(ExitCell);
+					if (ExitCellCost < 0.0f) continue;
+
+					const float TentativeG = CurrentG + StaircaseCost + FMath::Max(ExitCellCost, 0.001f);
+					if (TentativeG < WS.GetGScore(ExitIdx))
+					{
+						WS.SetVisited(ExitIdx, TentativeG, CurrentIdx);
+						PushOpen(TentativeG + Heuristic(ExitCell, GoalBounds, RiseToRun), ExitIdx);
+
+						ReserveStaircase(Storage, WS, CurCoord, Dir.DX, Dir.DY, StairLowerZ, RiseToRun, HeadroomCells);
+					}
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
+bool FHallwayPathfinder::FindPathBidirectionalInWindow(
+	const FDungeonGrid& Grid,
+	TArrayView<const FIntVector> Starts,
+	TArrayView<const FIntVector> Goals,
+	const FDungeonGenerationParams& Params,
+	uint8 SourceRoomIdx,
+	uint8 DestRoomIdx,
+	const FPathSearchWindow& Window,
+	FPathfinderWorkspace& WS,
+	FPathfindStats& Stats,
+	TArray<FIntVector>& OutPath)
+{
+	const int32 RiseToRun = Params.StaircaseRiseToRun;
+	const int32 HeadroomCells = Params.StaircaseHeadroom;
+	const float StaircaseCost = static_cast<float>(RiseToRun + 1) * 5.0f;
+	const bool bMultiFloor = Window.Max.Z > Window.Min.Z;
+
+	// Same storage halo as the unidirectional search (see FindPathInWindow)
+	const FPathSearchWindow Storage = FPathSearchWindow(
+		Window.Min - FIntVector(1, 1, 0),
+		Window.Max + FIntVector(1, 1, HeadroomCells)).ClampedTo(Grid.GridSize);
+
+	// Forward state + shared staircase reservations in WS; backward G/CameFrom in Bwd.
+	// Bwd's CameFrom points one step closer to the goals (the successor on the final path).
+	// Each side's goal stamps mark the other side's seeds: Fwd's are Goals, Bwd's are Starts.
+	FPathfinderWorkspace& Fwd = WS;
+	FPathfinderWorkspace& Bwd = WS.GetBackward();
+	Fwd.BeginSearch(Storage.Num());
+	Bwd.BeginSearch(Storage.Num());
+
+	using FNode = FPathfinderWorkspace::FOpenNode;
+	auto HeapPred = [](const FNode& A, const FNode& B) { return A.FScore < B.FScore; };
+
+	const FPathSearchWindow StartBounds = BoundsOf(Starts);
+	const FPathSearchWindow GoalBounds = BoundsOf(Goals);
+
+	// Forward search only ever checks the cost of cells it enters; start cells themselves are never entered
+	const FCellCostLookup Costs(Grid, Fwd.CostField, Params, SourceRoomIdx, DestRoomIdx);
+	auto EnterCost = [&Costs](const FIntVector& Coord)
+	{
+		return Costs.GetCost(Coord);
+	};
+
+	// Each end's region: its cells plus its free room and the ring around it (see FBidirectionalHeuristic)
+	auto EndRegion = [&Fwd](const FPathSearchWindow& Bounds, uint8 RoomIdx)
+	{
+		FPathSearchWindow Region = Bounds;
+		FPathSearchWindow Room;
+		if (RoomIdx != 0 && Fwd.CostField.GetRoomBounds(RoomIdx, Room))
+		{
+			Region.Min = FIntVector(FMath::Min(Region.Min.X, Room.Min.X - 1), FMath::Min(Region.Min.Y, Room.Min.Y - 1), FMath::Min(Region.Min.Z, Room.Min.Z));
+			Region.Max = FIntVector(FMath::Max(Region.Max.X, Room.Max.X + 1), FMath::Max(Region.Max.Y, Room.Max.Y + 1), FMath::Max(Region.Max.Z, Room.Max.Z));
+		}
+		return Region;
+	};
+	const FPathSearchWindow SourceRegion = EndRegion(StartBounds, SourceRoomIdx);
+	const FPathSearchWindow DestRegion = EndRegion(GoalBounds, DestRoomIdx);
+
+	// Cheapest cost of entering any cell outside the free rooms. Staircases cost 5 per cell they
+	// span, well above the heuristic's weight for the floor they climb.
+	const float MinStep = FMath::Max(
+		FMath::Min3(1.0f, Params.HallwayMergeCostMultiplier, Params.RoomPassthroughCostMultiplier), 0.001f);
+	const FBidirectionalHeuristic ToGoals(SourceRegion, DestRegion, MinStep, RiseToRun);
+	const FBidirectionalHeuristic ToStarts(DestRegion, SourceRegion, MinStep, RiseToRun);
+
+	for (const FIntVector& Start : Starts)
+	{
+		const int32 StartIdx = Storage.Index(Start);
+		Bwd.SetGoal(StartIdx);
+		Fwd.SetVisited(StartIdx, 0.0f, -1);
+		Fwd.OpenSet.HeapPush(FNode{ToGoals(Start), StartIdx}, HeapPred);
+	}
+	for (const FIntVector& Goal : Goals)
+	{
+		const int32 GoalIdx = Storage.Index(Goal);
+		Fwd.SetGoal(GoalIdx);
+		Bwd.SetVisited(GoalIdx, 0.0f, -1);
+		Bwd.OpenSet.HeapPush(FNode{ToStarts(Goal), GoalIdx}, HeapPred);
+	}
+	Stats.NodesPushed += Starts.Num() + Goals.Num();
+	Stats.PeakOpenSetSize = FMath::Max(Stats.PeakOpenSetSize, Starts.Num() + Goals.Num());
+
+	float BestCost = MAX_flt;
+	int32 MeetIdx = -1;
+
+	auto TryMeet = [&](int32 Idx)
+	{
+		const float GF = Fwd.GetGScore(Idx);
+		const float GB = Bwd.GetGScore(Idx);
+		if (GF < MAX_flt && GB < MAX_flt && GF + GB < BestCost)
+		{
+			BestCost = GF + GB;
+			MeetIdx = Idx;
+		}
+	};
+
+	auto Push = [&](FPathfinderWorkspace& Side, int32 Idx, const FIntVector& Coord, float G, int32 From, const FBidirectionalHeuristic& H)
+	{
+		Side.SetVisited(Idx, G, From);
+		Side.OpenSet.HeapPush(FNode{G + H(Coord), Idx}, HeapPred);
+		Stats.NodesPushed++;
+		Stats.PeakOpenSetSize = FMath::Max(Stats.PeakOpenSetSize, Fwd.OpenSet.Num() + Bwd.OpenSet.Num());
+		TryMeet(Idx);
+	};
+
+	// Both heuristics are consistent, so a path through any unexpanded node of either side costs at
+	// least that side's smallest f: once either frontier's minimum reaches the best meeting cost
+	// nothing better remains.
+	while (Fwd.OpenSet.Num() > 0 && Bwd.OpenSet.Num() > 0)
+	{
+		if (Fwd.OpenSet.HeapTop().FScore >= BestCost || Bwd.OpenSet.HeapTop().FScore >= BestCost)
+		{
+			break;
+		}
+
+		// Expand the smaller frontier (keeps the two wavefronts balanced)
+		const bool bForward = Fwd.OpenSet.Num() <= Bwd.OpenSet.Num();
+		FPathfinderWorkspace& Side = bForward ? Fwd : Bwd;
+
+		FNode Current;
+		Side.OpenSet.HeapPop(Current, HeapPred);
+		Stats.NodesPopped++;
+
+		if (Side.IsClosed(Current.CellIdx))
+		{
+			Stats.StalePops++;
+			continue;
+		}
+		Side.SetClosed(Current.CellIdx);
+
+		const float CurrentG = Side.GetGScore(Current.CellIdx);
+		const FIntVector CurCoord = Storage.Coord(Current.CellIdx);
+		if (WS.ExploredCells)
+		{
+			WS.ExploredCells->Add(Grid.CellIndex(CurCoord));
+		}
+
+		if (bForward)
+		{
+			// --- Forward: same moves as FindPathInWindow ---
+			for (const FHDir& Dir : HorizontalDirs)
+			{
+				const FIntVector NeighborCoord(CurCoord.X + Dir.DX, CurCoord.Y + Dir.DY, CurCoord.Z);
+				if (!Window.Contains(NeighborCoord)) continue;
+
+				const int32 NeighborIdx = Storage.Index(NeighborCoord);
+				if (Fwd.IsClosed(NeighborIdx)) continue;
+				if (Fwd.IsStaircaseReserved(NeighborIdx)) continue;
+
+				const float MoveCost = EnterCost(NeighborCoord);
+				if (MoveCost < 0.0f) continue;
+
+				const float TentativeG = CurrentG + FMath::Max(MoveCost, 0.001f);
+				if (TentativeG < Fwd.GetGScore(NeighborIdx))
+				{
+					Push(Fwd, NeighborIdx, NeighborCoord, TentativeG, Current.CellIdx, ToGoals);
+				}
+			}
+
+			if (!bMultiFloor) continue;
+
+			const uint8 StairMask = GetStaircaseMask(Grid, CurCoord, RiseToRun, HeadroomCells, Fwd.StaircaseMasks, Stats);
+			for (int32 DirIdx = 0; DirIdx < UE_ARRAY_COUNT(HorizontalDirs); ++DirIdx)
+			{
+				const FHDir& Dir = HorizontalDirs[DirIdx];
+				for (int32 Rise : {+1, -1})
+				{
+					Stats.StaircaseProbes++;
+					if (!(StairMask & FStaircaseMaskCache::MoveBit(DirIdx, Rise)))
+					{
+						Stats.StaircaseRejections++;
+						continue;
+					}
+
+					const FIntVector ExitCell(
+						CurCoord.X + Dir.DX * (RiseToRun + 1), CurCoord.Y + Dir.DY * (RiseToRun + 1), CurCoord.Z + Rise);
+					if (!Window.Contains(ExitCell)) continue;
+
+					const int32 ExitIdx = Storage.Index(ExitCell);
+					if (Fwd.IsClosed(ExitIdx)) continue;
+					if (Fwd.IsStaircaseReserved(ExitIdx)) continue;
+
+					const int32 StairLowerZ = (Rise > 0) ? CurCoord.Z : CurCoord.Z - 1;
+					if (IsStaircaseBlockedByReservation(Storage, Fwd, CurCoord, Dir.DX, Dir.DY,
+					                                    StairLowerZ, RiseToRun, HeadroomCells))
+					{
+						continue;
+					}
+
+					const float ExitCellCost = EnterCost(ExitCell);
+					if (ExitCellCost < 0.0f) continue;
+
+					const float TentativeG = CurrentG + StaircaseCost + FMath::Max(ExitCellCost, 0.001f);
+					if (TentativeG < Fwd.GetGScore(ExitIdx))
+					{
+						Push(Fwd, ExitIdx, ExitCell, TentativeG, Current.CellIdx, ToGoals);
+						ReserveStaircase(Storage, Fwd, CurCoord, Dir.DX, Dir.DY, StairLowerZ, RiseToRun, HeadroomCells);
+					}
+				}
+			}
+		}
+		else
+		{
+			// --- Backward: find predecessors P of Current. Every forward move into Current pays
+			// Current's entry cost, and P itself must have been enterable (unless it is a start cell).
+			const float CurrentCost = EnterCost(CurCoord);
+			if (CurrentCost < 0.0f) continue;
+			const float StepCost = FMath::Max(CurrentCost, 0.001f);
+
+			auto IsEnterable = [&](const FIntVector& Coord)
+			{
+				return Bwd.IsGoal(Storage.Index(Coord)) || EnterCost(Coord) >= 0.0f;
+			};
+
+			for (const FHDir& Dir : HorizontalDirs)
+			{
+				const FIntVector PrevCoord(CurCoord.X - Dir.DX, CurCoord.Y - Dir.DY, CurCoord.Z);
+				if (!Window.Contains(PrevCoord)) continue;
+
+				const int32 PrevIdx = Storage.Index(PrevCoord);
+				if (Bwd.IsClosed(PrevIdx)) continue;
+				if (Fwd.IsStaircaseReserved(PrevIdx)) continue;
+				if (!IsEnterable(PrevCoord)) continue;
+
+				const float TentativeG = CurrentG + StepCost;
+				if (TentativeG < Bwd.GetGScore(PrevIdx))
+				{
+					Push(Bwd, PrevIdx, PrevCoord, TentativeG, Current.CellIdx, ToStarts);
+				}
+			}
+
+			if (!bMultiFloor) continue;
+
+			// A staircase (Dir, Rise) from Entry lands RiseToRun+1 cells further along Dir, one floor
+			// up or down. Walk that backwards from Current (the exit) to find the entry.
+			if (Fwd.IsStaircaseReserved(Current.CellIdx)) continue;
+
+			for (int32 DirIdx = 0; DirIdx < UE_ARRAY_COUNT(HorizontalDirs); ++DirIdx)
 			{
-				return -1.0f;
+				const FHDir& Dir = HorizontalDirs[DirIdx];
+				for (int32 Rise : {+1, -1})
+				{
+					const FIntVector EntryCoord(
+						CurCoord.X - Dir.DX * (RiseToRun + 1),
+						CurCoord.Y - Dir.DY * (RiseToRun + 1),
+						CurCoord.Z - Rise);
+					if (!Window.Contains(EntryCoord)) continue;
+
+					const int32 EntryIdx = Storage.Index(EntryCoord);
+					if (Bwd.IsClosed(EntryIdx)) continue;
+					if (Fwd.IsStaircaseReserved(EntryIdx)) continue;
+
+					Stats.StaircaseProbes++;
+					const uint8 EntryMask = GetStaircaseMask(Grid, EntryCoord, RiseToRun, HeadroomCells, Fwd.StaircaseMasks, Stats);
+					if (!(EntryMask & FStaircaseMaskCache::MoveBit(DirIdx, Rise)))
+					{
+						Stats.StaircaseRejections++;
+						continue;
+					}
+
+					if (!IsEnterable(EntryCoord)) continue;
+
+					const int32 StairLowerZ = (Rise > 0) ? EntryCoord.Z : EntryCoord.Z - 1;
+					if (IsStaircaseBlockedByReservation(Storage, Fwd, EntryCoord, Dir.DX, Dir.DY,
+					                                    StairLowerZ, RiseToRun, HeadroomCells))
+					{
+						continue;
+					}
+
+					const float TentativeG = CurrentG + StaircaseCost + StepCost;
+					if (TentativeG < Bwd.GetGScore(EntryIdx))
+					{
+						Push(Bwd, EntryIdx, EntryCoord, TentativeG, Current.CellIdx, ToStarts);
+						ReserveStaircase(Storage, Fwd, EntryCoord, Dir.DX, Dir.DY, StairLowerZ, RiseToRun, HeadroomCells);
+					}
+				}
 			}
-			return 5.0f;
-		default:
-			return -1.0f; // Blocked (Staircase, StaircaseHead, Entrance)
 		}
 	}
 
-	bool IsCellAvailableForStaircase(const FDungeonGrid& Grid, const FIntVector& Coord)
+	if (MeetIdx == -1)
 	{
-		if (!Grid.IsInBounds(Coord)) return false;
-		const EDungeonCellType Type = Grid.GetCell(Coord).CellType;
-		// Only allow empty cells — existing hallways, staircases, and rooms are off-limits.
-		// This prevents new staircases from overlapping existing corridors.
-		return Type == EDungeonCellType::Empty;
+		return false;
 	}
 
-	float Heuristic(const FIntVector& A, const FIntVector& B, int32 RiseToRun)
+	// Start..Meet from the forward tree, then Meet's successors down to a goal from the backward tree
+	for (int32 Idx = MeetIdx; Idx != -1; Idx = Fwd.GetCameFrom(Idx))
 	{
-		const float Horizontal = static_cast<float>(FMath::Abs(A.X - B.X) + FMath::Abs(A.Y - B.Y));
-		const float Vertical = static_cast<float>(FMath::Abs(A.Z - B.Z)) * static_cast<float>(RiseToRun + 1);
-		return Horizontal + Vertical;
+		OutPath.Add(Storage.Coord(Idx));
+	}
+	Algo::Reverse(OutPath);
+
+	for (int32 Idx = Bwd.GetCameFrom(MeetIdx); Idx != -1; Idx = Bwd.GetCameFrom(Idx))
+	{
+		OutPath.Add(Storage.Coord(Idx));
 	}
+
+	return true;
 }
 
 // ============================================================================
-// Staircase validation
+// Hierarchical (HPA*) search
 // ============================================================================
 
-bool FHallwayPathfinder::CanBuildStaircase(
+void FHallwayPathfinder::UpdateClusterGraph(
 	const FDungeonGrid& Grid,
-	const FIntVector& Entry,
-	int32 DirX, int32 DirY,
-	int32 Rise,
-	int32 RiseToRun,
-	int32 HeadroomCells,
-	FIntVector& OutExit)
+	const FDungeonGenerationParams& Params,
+	FPathfinderWorkspace& WS,
+	FPathfindStats& Stats)
 {
-	// Body cells are on the lower floor, headroom above them (Z is up)
-	const int32 LowerZ = (Rise > 0) ? Entry.Z : Entry.Z - 1;
-	const int32 UpperZ = LowerZ + 1;
-
-	if (LowerZ < 0 || UpperZ >= Grid.GridSize.Z)
+	FHallwayClusterGraph& Graph = WS.GetClusterGraph();
+	if (!Graph.bAnyDirty)
 	{
-		return false;
+		return;
 	}
 
-	// Check body cells (RiseToRun cells on the lower floor, in the horizontal direction)
-	for (int32 i = 1; i <= RiseToRun; ++i)
+	TRACE_CPUPROFILER_EVENT_SCOPE(Dungeon_UpdateClusterGraph);
+
+	using FClusterGraph = FHallwayClusterGraph;
+	const int32 RiseToRun = Params.StaircaseRiseToRun;
+	const int32 HeadroomCells = Params.StaircaseHeadroom;
+	const float StaircaseCost = static_cast<float>(RiseToRun + 1) * 5.0f;
+
+	// The graph serves every hallway, so it prices rooms without any source/dest discount
+	// (room indices start at 1)
+	const FCellCostLookup Costs(Grid, WS.CostField, Params, 0, 0);
+
+	// Run of open border pairs long enough to get an entrance at each end instead of one in the
+	// middle (Botea et al.), so routes along the border don't detour through its center
+	static constexpr int32 LongEntranceRun = 6;
+
+	TBitArray<> NeedsEdges(false, Graph.NumClusters());
+
+	auto AddLink = [&Graph, &NeedsEdges](int32 LinkIdx, const FIntVector& A, const FIntVector& B, float CostAB, float CostBA, bool bStaircase)
 	{
-		const FIntVector BodyCell(Entry.X + DirX * i, Entry.Y + DirY * i, LowerZ);
-		if (!IsCellAvailableForStaircase(Grid, BodyCell))
-		{
-			return false;
-		}
-	}
+		const int32 NodeA = Graph.AddNode(A, Graph.ClusterOf(A));
+		const int32 NodeB = Graph.AddNode(B, Graph.ClusterOf(B));
+		Graph.Nodes[NodeA].Partner = NodeB;
+		Graph.Nodes[NodeA].PartnerCost = CostAB;
+		Graph.Nodes[NodeA].bStaircase = bStaircase;
+		Graph.Nodes[NodeB].Partner = NodeA;
+		Graph.Nodes[NodeB].PartnerCost = CostBA;
+		Graph.Nodes[NodeB].bStaircase = bStaircase;
+		Graph.LinkNodes[LinkIdx].Add(NodeA);
+		Graph.LinkNodes[LinkIdx].Add(NodeB);
+		NeedsEdges[Graph.Nodes[NodeA].Cluster] = true;
+		NeedsEdges[Graph.Nodes[NodeB].Cluster] = true;
+	};
 
-	// Check that body cells aren't adjacent to existing staircase zones.
-	// This prevents back-to-back and side-by-side staircase placement.
-	for (int32 i = 1; i <= RiseToRun; ++i)
+	// Length cells from First along Along, each paired with the cell one step Across
+	auto PlaceBorder = [&](int32 LinkIdx, const FIntVector& First, const FIntVector& Along, const FIntVector& Across, int32 Length)
 	{
-		const FIntVector BodyCell(Entry.X + DirX * i, Entry.Y + DirY * i, LowerZ);
-		for (const FHDir& HDir : HorizontalDirs)
+		auto AddTransition = [&](int32 At)
 		{
-			const FIntVector Neighbor(BodyCell.X + HDir.DX, BodyCell.Y + HDir.DY, BodyCell.Z);
-			if (!Grid.IsInBounds(Neighbor)) continue;
-			const EDungeonCellType NType = Grid.GetCell(Neighbor).CellType;
-			if (NType == EDungeonCellType::Staircase || NType == EDungeonCellType::StaircaseHead)
+			const FIntVector Inside = First + Along * At;
+			const FIntVector Outside = Inside + Across;
+			AddLink(LinkIdx, Inside, Outside,
+				FMath::Max(Costs.GetCost(Outside), 0.001f), FMath::Max(Costs.GetCost(Inside), 0.001f), false);
+		};
+
+		int32 RunBegin = INDEX_NONE;
+		for (int32 i = 0; i <= Length; ++i)
+		{
+			const FIntVector Inside = First + Along * i;
+			const bool bOpen = i < Length && Costs.GetCost(Inside) >= 0.0f && Costs.GetCost(Inside + Across) >= 0.0f;
+			if (bOpen)
 			{
-				return false;
+				RunBegin = RunBegin == INDEX_NONE ? i : RunBegin;
+				continue;
 			}
-		}
-	}
-
-	// Check headroom cells above each body cell
-	for (int32 i = 1; i <= RiseToRun; ++i)
-	{
-		for (int32 h = 1; h <= HeadroomCells; ++h)
-		{
-			const FIntVector HeadCell(Entry.X + DirX * i, Entry.Y + DirY * i, LowerZ + h);
-			if (!Grid.IsInBounds(HeadCell))
+			if (RunBegin == INDEX_NONE)
 			{
-				// Headroom out of bounds on higher floors is OK (open sky)
 				continue;
 			}
-			if (!IsCellAvailableForStaircase(Grid, HeadCell))
+
+			const int32 RunEnd = i - 1;
+			if (RunEnd - RunBegin + 1 >= LongEntranceRun)
 			{
-				return false;
+				AddTransition(RunBegin);
+				AddTransition(RunEnd);
+			}
+			else
+			{
+				AddTransition((RunBegin + RunEnd) / 2);
 			}
+			RunBegin = INDEX_NONE;
+		}
+	};
 
-			// Headroom cells must not be cardinally adjacent to existing staircases
-			for (const FHDir& HDir : HorizontalDirs)
+	// One staircase up per cluster, the legal one nearest a target point. Floors take turns
+	// between the cluster's four quadrant centers, so links on consecutive floors of a column
+	// don't stack one's body under the other's headroom. Both directions must be legal: the
+	// refined path may walk it either way.
+	auto PlaceStaircase = [&](int32 LinkIdx, const FPathSearchWindow& Box)
+	{
+		static constexpr int32 QuadrantX[] = {1, 3, 3, 1};
+		static constexpr int32 QuadrantY[] = {1, 1, 3, 3};
+		const int32 Quadrant = Box.Min.Z % 4;
+		const FIntVector Center = Box.Min + FIntVector(
+			Box.Size().X * QuadrantX[Quadrant] / 4, Box.Size().Y * QuadrantY[Quadrant] / 4, 0);
+		int32 BestDistance = MAX_int32;
+		FIntVector BestEntry = FIntVector::ZeroValue;
+		FIntVector BestExit = FIntVector::ZeroValue;
+
+		for (int32 Y = Box.Min.Y; Y <= Box.Max.Y; ++Y)
+		{
+			for (int32 X = Box.Min.X; X <= Box.Max.X; ++X)
 			{
-				const FIntVector Adj(HeadCell.X + HDir.DX, HeadCell.Y + HDir.DY, HeadCell.Z);
-				if (!Grid.IsInBounds(Adj)) continue;
-				const EDungeonCellType AdjType = Grid.GetCell(Adj).CellType;
-				if (AdjType == EDungeonCellType::Staircase || AdjType == EDungeonCellType::StaircaseHead)
+				const int32 Distance = FMath::Abs(X - Center.X) + FMath::Abs(Y - Center.Y);
+				const FIntVector Entry(X, Y, Box.Min.Z);
+				if (Distance >= BestDistance || Costs.GetCost(Entry) < 0.0f) continue;
+
+				const uint8 Mask = GetStaircaseMask(Grid, Entry, RiseToRun, HeadroomCells, WS.StaircaseMasks, Stats);
+				for (int32 DirIdx = 0; DirIdx < UE_ARRAY_COUNT(HorizontalDirs); ++DirIdx)
 				{
-					return false;
+					if (!(Mask & FStaircaseMaskCache::MoveBit(DirIdx, +1))) continue;
+
+					const FIntVector Exit(
+						X + HorizontalDirs[DirIdx].DX * (RiseToRun + 1),
+						Y + HorizontalDirs[DirIdx].DY * (RiseToRun + 1),
+						Box.Min.Z + 1);
+					if (!Box.Contains(FIntVector(Exit.X, Exit.Y, Box.Min.Z))) continue;
+					if (Costs.GetCost(Exit) < 0.0f) continue;
+
+					// DirIdx ^ 1 is the opposite direction (+X/-X, +Y/-Y)
+					const uint8 ExitMask = GetStaircaseMask(Grid, Exit, RiseToRun, HeadroomCells, WS.StaircaseMasks, Stats);
+					if (!(ExitMask & FStaircaseMaskCache::MoveBit(DirIdx ^ 1, -1))) continue;
+
+					BestDistance = Distance;
+					BestEntry = Entry;
+					BestExit = Exit;
+					break;
 				}
 			}
 		}
-	}
 
-	// Check exit cell (one step past the staircase on the target floor)
-	const int32 TargetZ = (Rise > 0) ? UpperZ : LowerZ;
-	OutExit = FIntVector(
-		Entry.X + DirX * (RiseToRun + 1),
-		Entry.Y + DirY * (RiseToRun + 1),
-		TargetZ);
+		if (BestDistance != MAX_int32)
+		{
+			AddLink(LinkIdx, BestEntry, BestExit,
+				StaircaseCost + FMath::Max(Costs.GetCost(BestExit), 0.001f),
+				StaircaseCost + FMath::Max(Costs.GetCost(BestEntry), 0.001f), true);
+		}
+	};
 
-	if (!Grid.IsInBounds(OutExit))
+	// A cell change only reaches links owned by dirty clusters: MarkDirty's reach is at least two
+	// cells, so an edit on a shared border also dirties the cluster that owns that border
+	for (TConstSetBitIterator<> It(Graph.DirtyClusters); It; ++It)
 	{
-		return false;
+		for (int32 Slot = 0; Slot < FClusterGraph::NumLinkSlots; ++Slot)
+		{
+			TArray<int32>& Links = Graph.LinkNodes[It.GetIndex() * FClusterGraph::NumLinkSlots + Slot];
+			for (int32 NodeIdx : Links)
+			{
+				NeedsEdges[Graph.Nodes[NodeIdx].Cluster] = true;
+				Graph.RemoveNode(NodeIdx);
+			}
+			Links.Reset();
+		}
 	}
 
-	// Exit cell must be available (Empty, Hallway, or dest room)
-	const FDungeonCell& ExitCell = Grid.GetCell(OutExit);
-	if (ExitCell.CellType != EDungeonCellType::Empty &&
-		ExitCell.CellType != EDungeonCellType::Hallway &&
-		ExitCell.CellType != EDungeonCellType::Room)
+	for (TConstSetBitIterator<> It(Graph.DirtyClusters); It; ++It)
 	{
-		return false;
+		const int32 Cluster = It.GetIndex();
+		const int32 LinkBase = Cluster * FClusterGraph::NumLinkSlots;
+		const FPathSearchWindow Box = Graph.ClusterBox(Cluster);
+		NeedsEdges[Cluster] = true;
+
+		if (Box.Max.X + 1 < Grid.GridSize.X)
+		{
+			PlaceBorder(LinkBase + FClusterGraph::EastBorder, FIntVector(Box.Max.X, Box.Min.Y, Box.Min.Z),
+				FIntVector(0, 1, 0), FIntVector(1, 0, 0), Box.Size().Y);
+		}
+		if (Box.Max.Y + 1 < Grid.GridSize.Y)
+		{
+			PlaceBorder(LinkBase + FClusterGraph::NorthBorder, FIntVector(Box.Min.X, Box.Max.Y, Box.Min.Z),
+				FIntVector(1, 0, 0), FIntVector(0, 1, 0), Box.Size().X);
+		}
+		if (Box.Min.Z + 1 < Grid.GridSize.Z)
+		{
+			PlaceStaircase(LinkBase + FClusterGraph::StaircaseUp, Box);
+		}
 	}
 
-	return true;
-}
+	// Edges: one Dijkstra flood per node over its cluster, read off at every other node
+	for (TConstSetBitIterator<> It(NeedsEdges); It; ++It)
+	{
+		const int32 Cluster = It.GetIndex();
+		const FPathSearchWindow Box = Graph.ClusterBox(Cluster);
+		const TArray<int32>& Members = Graph.ClusterNodes[Cluster];
+		Stats.ClustersRebuilt++;
 
-// ============================================================================
-// A* Pathfinding
-// ============================================================================
+		for (int32 FromIdx : Members)
+		{
+			const FIntVector From = Graph.Nodes[FromIdx].Cell;
+			FloodBox(Costs, Box, MakeArrayView(&From, 1), false, WS, Stats);
 
-bool FHallwayPathfinder::FindPath(
+			TArray<FClusterGraph::FEdge>& Edges = Graph.Nodes[FromIdx].Edges;
+			Edges.Reset();
+			for (int32 ToIdx : Members)
+			{
+				const float Cost = WS.GetGScore(Box.Index(Graph.Nodes[ToIdx].Cell));
+				if (ToIdx != FromIdx && Cost < MAX_flt)
+				{
+					Edges.Add(FClusterGraph::FEdge{ToIdx, Cost});
+				}
+			}
+		}
+	}
+
+	Graph.DirtyClusters.Init(false, Graph.NumClusters());
+	Graph.bAnyDirty = false;
+}
+
+bool FHallwayPathfinder::FindPathHierarchical(
 	const FDungeonGrid& Grid,
-	const FIntVector& Start,
-	const FIntVector& End,
-	const UDungeonConfiguration& Config,
+	TArrayView<const FIntVector> Starts,
+	TArrayView<const FIntVector> Goals,
+	const FDungeonGenerationParams& Params,
 	uint8 SourceRoomIdx,
 	uint8 DestRoomIdx,
+	FPathfinderWorkspace& WS,
+	FPathfindStats& Stats,
 	TArray<FIntVector>& OutPath)
 {
-	OutPath.Reset();
+	TRACE_CPUPROFILER_EVENT_SCOPE(Dungeon_FindPathHierarchical);
 
-	if (!Grid.IsInBounds(Start) || !Grid.IsInBounds(End))
+	FHallwayClusterGraph& Graph = WS.GetClusterGraph();
+	Graph.Bind(Grid, Params);
+	UpdateClusterGraph(Grid, Params, WS, Stats);
+
+	const FCellCostLookup Costs(Grid, WS.CostField, Params, SourceRoomIdx, DestRoomIdx);
+
+	// Starts and goals join the graph through the nodes of their own clusters
+	TMap<int32, TArray<FIntVector>> StartsByCluster;
+	TMap<int32, TArray<FIntVector>> GoalsByCluster;
+	for (const FIntVector& Start : Starts)
 	{
-		return false;
+		StartsByCluster.FindOrAdd(Graph.ClusterOf(Start)).Add(Start);
 	}
-
-	if (Start == End)
+	for (const FIntVector& Goal : Goals)
 	{
-		OutPath.Add(Start);
-		return true;
+		GoalsByCluster.FindOrAdd(Graph.ClusterOf(Goal)).Add(Goal);
 	}
 
-	const int32 TotalCells = Grid.GridSize.X * Grid.GridSize.Y * Grid.GridSize.Z;
-	const int32 RiseToRun = Config.StaircaseRiseToRun;
-	const int32 HeadroomCells = Config.StaircaseHeadroom;
-
-	// Flat arrays for O(1) lookup
-	TArray<float> GScore;
-	GScore.SetNum(TotalCells);
-	for (float& G : GScore) G = MAX_flt;
+	// Abstract A* over graph node slots, plus a virtual start and goal node after them
+	const int32 NumSlots = Graph.NumNodeSlots();
+	const int32 StartNode = NumSlots;
+	const int32 GoalNode = NumSlots + 1;
 
+	TArray<float> GScores;
+	GScores.Init(MAX_flt, NumSlots + 2);
 	TArray<int32> CameFrom;
-	CameFrom.SetNum(TotalCells);
-	for (int32& P : CameFrom) P = -1;
+	CameFrom.Init(INDEX_NONE, NumSlots + 2);
+	TBitArray<> Closed(false, NumSlots + 2);
+	TArray<float> CostToGoal;
+	CostToGoal.Init(MAX_flt, NumSlots);
 
-	TArray<bool> ClosedSet;
-	ClosedSet.SetNumZeroed(TotalCells);
+	for (const TPair<int32, TArray<FIntVector>>& Pair : GoalsByCluster)
+	{
+		const FPathSearchWindow Box = Graph.ClusterBox(Pair.Key);
+		FloodBox(Costs, Box, Pair.Value, true, WS, Stats);
+		for (int32 NodeIdx : Graph.GetClusterNodes(Pair.Key))
+		{
+			CostToGoal[NodeIdx] = WS.GetGScore(Box.Index(Graph.GetNode(NodeIdx).Cell));
+		}
+	}
 
-	// Tracks cells claimed by staircase body/headroom during pathfinding.
-	// Prevents a second staircase from stacking on top of an already-planned one.
-	TArray<bool> StaircaseReserved;
-	StaircaseReserved.SetNumZeroed(TotalCells);
+	using FOpenNode = FPathfinderWorkspace::FOpenNode;
+	auto HeapPred = [](const FOpenNode& A, const FOpenNode& B) { return A.FScore < B.FScore; };
+	TArray<FOpenNode> OpenSet;
 
-	// Min-heap open set
-	struct FNode
+	const FPathSearchWindow GoalBounds = BoundsOf(Goals);
+	auto Relax = [&](int32 From, int32 To, float TentativeG)
 	{
-		float FScore;
-		int32 CellIdx;
+		if (Closed[To] || TentativeG >= GScores[To])
+		{
+			return false;
+		}
+		GScores[To] = TentativeG;
+		CameFrom[To] = From;
+		const float H = To == GoalNode ? 0.0f : Heuristic(Graph.GetNode(To).Cell, GoalBounds, Params.StaircaseRiseToRun);
+		OpenSet.HeapPush(FOpenNode{TentativeG + H, To}, HeapPred);
+		Stats.NodesPushed++;
+		return true;
 	};
-	auto HeapPred = [](const FNode& A, const FNode& B) { return A.FScore < B.FScore; };
-
-	const int32 StartIdx = Grid.CellIndex(Start);
-	const int32 EndIdx = Grid.CellIndex(End);
 
-	GScore[StartIdx] = 0.0f;
-
-	TArray<FNode> OpenSet;
-	OpenSet.HeapPush(FNode{Heuristic(Start, End, RiseToRun), StartIdx}, HeapPred);
-
-	while (OpenSet.Num() > 0)
+	// A start cluster that also holds goals may connect them directly, without leaving it
+	int32 DirectCluster = INDEX_NONE;
+	GScores[StartNode] = 0.0f;
+	for (const TPair<int32, TArray<FIntVector>>& Pair : StartsByCluster)
 	{
-		FNode Current;
-		OpenSet.HeapPop(Current, HeapPred);
+		const FPathSearchWindow Box = Graph.ClusterBox(Pair.Key);
+		FloodBox(Costs, Box, Pair.Value, false, WS, Stats);
+		for (int32 NodeIdx : Graph.GetClusterNodes(Pair.Key))
+		{
+			const float Cost = WS.GetGScore(Box.Index(Graph.GetNode(NodeIdx).Cell));
+			if (Cost < MAX_flt)
+			{
+				Relax(StartNode, NodeIdx, Cost);
+			}
+		}
 
-		if (Current.CellIdx == EndIdx)
+		if (const TArray<FIntVector>* ClusterGoals = GoalsByCluster.Find(Pair.Key))
 		{
-			// Reconstruct path
-			int32 Idx = EndIdx;
-			while (Idx != -1)
+			for (const FIntVector& Goal : *ClusterGoals)
 			{
-				const int32 X = Idx % Grid.GridSize.X;
-				const int32 Y = (Idx / Grid.GridSize.X) % Grid.GridSize.Y;
-				const int32 Z = Idx / (Grid.GridSize.X * Grid.GridSize.Y);
-				OutPath.Add(FIntVector(X, Y, Z));
-				Idx = CameFrom[Idx];
+				if (Relax(StartNode, GoalNode, WS.GetGScore(Box.Index(Goal))))
+				{
+					DirectCluster = Pair.Key;
+				}
 			}
-			Algo::Reverse(OutPath);
-			return true;
 		}
+	}
+
+	while (OpenSet.Num() > 0)
+	{
+		FOpenNode Top;
+		OpenSet.HeapPop(Top, HeapPred);
+		Stats.NodesPopped++;
 
-		if (ClosedSet[Current.CellIdx])
+		const int32 Current = Top.CellIdx;
+		if (Current == GoalNode)
+		{
+			break;
+		}
+		if (Closed[Current])
 		{
+			Stats.StalePops++;
 			continue;
 		}
-		ClosedSet[Current.CellIdx] = true;
+		Closed[Current] = true;
 
-		// Decode current position
-		const int32 CurX = Current.CellIdx % Grid.GridSize.X;
-		const int32 CurY = (Current.CellIdx / Grid.GridSize.X) % Grid.GridSize.Y;
-		const int32 CurZ = Current.CellIdx / (Grid.GridSize.X * Grid.GridSize.Y);
-		const FIntVector CurCoord(CurX, CurY, CurZ);
-
-		// --- Same-floor cardinal moves (XY plane) ---
-		for (const FHDir& Dir : HorizontalDirs)
+		const FHallwayClusterGraph::FNode& Node = Graph.GetNode(Current);
+		const float CurrentG = GScores[Current];
+		for (const FHallwayClusterGraph::FEdge& Edge : Node.Edges)
+		{
+			Relax(Current, Edge.To, CurrentG + Edge.Cost);
+		}
+		if (Node.Partner != INDEX_NONE)
+		{
+			Relax(Current, Node.Partner, CurrentG + Node.PartnerCost);
+		}
+		if (CostToGoal[Current] < MAX_flt)
 		{
-			const FIntVector NeighborCoord(CurX + Dir.DX, CurY + Dir.DY, CurZ);
-			if (!Grid.IsInBounds(NeighborCoord)) continue;
+			Relax(Current, GoalNode, CurrentG + CostToGoal[Current]);
+		}
+	}
+
+	if (CameFrom[GoalNode] == INDEX_NONE)
+	{
+		return false;
+	}
+
+	TArray<int32> Route;
+	for (int32 NodeIdx = GoalNode; NodeIdx != INDEX_NONE; NodeIdx = CameFrom[NodeIdx])
+	{
+		Route.Add(NodeIdx);
+	}
+	Algo::Reverse(Route);
 
-			const int32 NeighborIdx = Grid.CellIndex(NeighborCoord);
-			if (ClosedSet[NeighborIdx]) continue;
-			if (StaircaseReserved[NeighborIdx]) continue;
+	// The route's staircases claim their body and headroom cells up front, so no leg walks
+	// through one planned elsewhere on the route
+	TArray<FIntVector> StaircaseCells;
+	for (int32 i = 0; i + 1 < Route.Num(); ++i)
+	{
+		if (Route[i] >= NumSlots || Route[i + 1] >= NumSlots) continue;
 
-			const float MoveCost = GetCellCost(Grid, NeighborCoord, Config, SourceRoomIdx, DestRoomIdx);
-			if (MoveCost < 0.0f) continue;
+		const FIntVector& From = Graph.GetNode(Route[i]).Cell;
+		const FIntVector& To = Graph.GetNode(Route[i + 1]).Cell;
+		if (From.Z == To.Z) continue;
 
-			const float TentativeG = GScore[Current.CellIdx] + FMath::Max(MoveCost, 0.001f);
-			if (TentativeG < GScore[NeighborIdx])
+		const int32 DirX = FMath::Sign(To.X - From.X);
+		const int32 DirY = FMath::Sign(To.Y - From.Y);
+		const int32 LowerZ = FMath::Min(From.Z, To.Z);
+		for (int32 Step = 1; Step <= Params.StaircaseRiseToRun; ++Step)
+		{
+			for (int32 h = 0; h <= Params.StaircaseHeadroom; ++h)
 			{
-				GScore[NeighborIdx] = TentativeG;
-				CameFrom[NeighborIdx] = Current.CellIdx;
-				OpenSet.HeapPush(
-					FNode{TentativeG + Heuristic(NeighborCoord, End, RiseToRun), NeighborIdx}, HeapPred);
+				StaircaseCells.Add(FIntVector(From.X + DirX * Step, From.Y + DirY * Step, LowerZ + h));
 			}
 		}
+	}
 
-		// --- Staircase moves (4 directions × up/down along Z) ---
-		if (Grid.GridSize.Z > 1)
+	// Refine: every leg stays inside one cluster's floor, so plain A* there never plans a
+	// staircase; the route's staircase links supply those as single moves
+	TArray<FIntVector> Path;
+	TMap<FIntVector, int32> PathIndex;
+	TArray<FIntVector> Leg;
+	for (int32 i = 0; i + 1 < Route.Num(); ++i)
+	{
+		const int32 From = Route[i];
+		const int32 To = Route[i + 1];
+
+		const int32 Cluster = From == StartNode
+			? (To == GoalNode ? DirectCluster : Graph.GetNode(To).Cluster)
+			: Graph.GetNode(From).Cluster;
+		const TArrayView<const FIntVector> LegStarts = From == StartNode
+			? TArrayView<const FIntVector>(StartsByCluster[Cluster])
+			: MakeArrayView(&Graph.GetNode(From).Cell, 1);
+		const TArrayView<const FIntVector> LegGoals = To == GoalNode
+			? TArrayView<const FIntVector>(GoalsByCluster[Cluster])
+			: MakeArrayView(&Graph.GetNode(To).Cell, 1);
+
+		Leg.Reset();
+		if (From != StartNode && To != GoalNode && Graph.GetNode(To).Cluster != Cluster)
 		{
-			for (const FHDir& Dir : HorizontalDirs)
+			// Border step or staircase between partner nodes
+			Leg.Add(LegStarts[0]);
+			Leg.Add(LegGoals[0]);
+		}
+		else if (!FindPathInWindow(Grid, LegStarts, LegGoals, Params, SourceRoomIdx, DestRoomIdx,
+		                           Graph.ClusterBox(Cluster), false, WS, Stats, Leg, StaircaseCells))
+		{
+			return false;
+		}
+
+		// Legs share their end cells and, refined separately, can cross each other: on a revisit
+		// cut the path back to the first visit so it stays a simple path
+		for (const FIntVector& Cell : Leg)
+		{
+			if (const int32* Seen = PathIndex.Find(Cell))
 			{
-				for (int32 Rise : {+1, -1})
+				const int32 Keep = *Seen + 1;
+				for (int32 Cut = Keep; Cut < Path.Num(); ++Cut)
 				{
-					FIntVector ExitCell;
-					if (!CanBuildStaircase(Grid, CurCoord, Dir.DX, Dir.DY, Rise,
-					                       RiseToRun, HeadroomCells, ExitCell))
-					{
-						continue;
-					}
-
-					const int32 ExitIdx = Grid.CellIndex(ExitCell);
-					if (ClosedSet[ExitIdx]) continue;
-					if (StaircaseReserved[ExitIdx]) continue;
-
-					// Check that body/headroom cells don't overlap with an already-planned staircase
-					const int32 StairLowerZ = (Rise > 0) ? CurZ : CurZ - 1;
-					bool bOverlapsReserved = false;
-					for (int32 s = 1; s <= RiseToRun && !bOverlapsReserved; ++s)
-					{
-						const FIntVector BodyCell(CurX + Dir.DX * s, CurY + Dir.DY * s, StairLowerZ);
-						if (Grid.IsInBounds(BodyCell) && StaircaseReserved[Grid.CellIndex(BodyCell)])
-						{
-							bOverlapsReserved = true;
-						}
-						for (int32 h = 1; h <= HeadroomCells && !bOverlapsReserved; ++h)
-						{
-							const FIntVector HeadCell(CurX + Dir.DX * s, CurY + Dir.DY * s, StairLowerZ + h);
-							if (Grid.IsInBounds(HeadCell) && StaircaseReserved[Grid.CellIndex(HeadCell)])
-							{
-								bOverlapsReserved = true;
-							}
-						}
-					}
-					if (bOverlapsReserved) continue;
-
-					// Check that body AND headroom cells aren't adjacent to already-reserved cells.
-					// Prevents elbow/U-staircase connections through staircase sides
-					// within the same A* path (grid adjacency check only catches carved stairs).
-					bool bAdjacentToReserved = false;
-					for (int32 s = 1; s <= RiseToRun && !bAdjacentToReserved; ++s)
-					{
-						// Body cell adjacency
-						const FIntVector BodyCell(CurX + Dir.DX * s, CurY + Dir.DY * s, StairLowerZ);
-						for (const FHDir& AdjDir : HorizontalDirs)
-						{
-							const FIntVector Adj(BodyCell.X + AdjDir.DX, BodyCell.Y + AdjDir.DY, StairLowerZ);
-							if (Grid.IsInBounds(Adj) && StaircaseReserved[Grid.CellIndex(Adj)])
-							{
-								bAdjacentToReserved = true;
-								break;
-							}
-						}
-						// Headroom cell adjacency
-						for (int32 h = 1; h <= HeadroomCells && !bAdjacentToReserved; ++h)
-						{
-							const FIntVector HeadCell(CurX + Dir.DX * s, CurY + Dir.DY * s, StairLowerZ + h);
-							for (const FHDir& AdjDir : HorizontalDirs)
-							{
-								const FIntVector Adj(HeadCell.X + AdjDir.DX, HeadCell.Y + AdjDir.DY, HeadCell.Z);
-								if (Grid.IsInBounds(Adj) && StaircaseReserved[Grid.CellIndex(Adj)])
-								{
-									bAdjacentToReserved = true;
-									break;
-								}
-							}
-						}
-					}
-					if (bAdjacentToReserved) continue;
-
-					// Cost: traverse RiseToRun body cells + exit cell
-					const float StaircaseCost = static_cast<float>(RiseToRun + 1) * 5.0f;
-					const float ExitCellCost = GetCellCost(Grid, ExitCell, Config, SourceRoomIdx, DestRoomIdx);
-					if (ExitCellCost < 0.0f) continue;
-
-					const float TentativeG = GScore[Current.CellIdx] + StaircaseCost + FMath::Max(ExitCellCost, 0.001f);
-					if (TentativeG < GScore[ExitIdx])
-					{
-						GScore[ExitIdx] = TentativeG;
-						CameFrom[ExitIdx] = Current.CellIdx;
-						OpenSet.HeapPush(
-							FNode{TentativeG + Heuristic(ExitCell, End, RiseToRun), ExitIdx}, HeapPred);
-
-						// Reserve body and headroom cells for this staircase
-						for (int32 s = 1; s <= RiseToRun; ++s)
-						{
-							const FIntVector BodyCell(CurX + Dir.DX * s, CurY + Dir.DY * s, StairLowerZ);
-							if (Grid.IsInBounds(BodyCell))
-							{
-								StaircaseReserved[Grid.CellIndex(BodyCell)] = true;
-							}
-							for (int32 h = 1; h <= HeadroomCells; ++h)
-							{
-								const FIntVector HeadCell(CurX + Dir.DX * s, CurY + Dir.DY * s, StairLowerZ + h);
-								if (Grid.IsInBounds(HeadCell))
-								{
-									StaircaseReserved[Grid.CellIndex(HeadCell)] = true;
-								}
-							}
-						}
-
-					}
+					PathIndex.Remove(Path[Cut]);
 				}
+				Path.SetNum(Keep, EAllowShrinking::No);
+			}
+			else
+			{
+				PathIndex.Add(Cell, Path.Num());
+				Path.Add(Cell);
 			}
 		}
 	}
 
-	return false;
+	OutPath.Append(Path);
+	return true;
 }
 
 // ============================================================================
@@ -434,11 +2249,25 @@ void FHallwayPathfinder::CarveHallway(
 	uint8 HallwayIndex,
 	uint8 SourceRoomIdx,
 	uint8 DestRoomIdx,
-	const UDungeonConfiguration& Config,
-	TArray<FDungeonStaircase>& OutStaircases)
+	const FDungeonGenerationParams& Params,
+	TArray<FDungeonStaircase>& OutStaircases,
+	FPathfinderWorkspace* Workspace)
 {
-	const int32 RiseToRun = Config.StaircaseRiseToRun;
-	const int32 HeadroomCells = Config.StaircaseHeadroom;
+	TRACE_CPUPROFILER_EVENT_SCOPE(Dungeon_CarveHallway);
+
+	const int32 RiseToRun = Params.StaircaseRiseToRun;
+	const int32 HeadroomCells = Params.StaircaseHeadroom;
+	static const FDungeonCell StaircaseCellMask = FDungeonGrid::FieldMask(
+		&FDungeonCell::CellType, &FDungeonCell::HallwayIndex, &FDungeonCell::StaircaseDirection);
+
+	// Keep the workspace's cost field and staircase masks in step with every cell type change
+	auto MarkChanged = [&Grid, Workspace](const FIntVector& Coord)
+	{
+		if (Workspace)
+		{
+			Workspace->NotifyCellChanged(Grid, Coord);
+		}
+	};
 
 	for (int32 i = 0; i < Path.Num(); ++i)
 	{
@@ -473,23 +2302,39 @@ void FHallwayPathfinder::CarveHallway(
 				Staircase.RiseRunRatio = RiseToRun;
 				Staircase.HeadroomCells = HeadroomCells;
 
+				// The body is a straight run of RiseToRun cells on the lower floor, with the headroom
+				// shaft stacked directly above it
+				const int32 RunEndX = Prev.X + DirX * RiseToRun;
+				const int32 RunEndY = Prev.Y + DirY * RiseToRun;
+				const FIntVector RunMin(FMath::Min(Prev.X + DirX, RunEndX), FMath::Min(Prev.Y + DirY, RunEndY), LowerZ);
+				const FIntVector RunMax(FMath::Max(Prev.X + DirX, RunEndX) + 1, FMath::Max(Prev.Y + DirY, RunEndY) + 1, LowerZ + 1);
+
 				// Carve body cells on the lower floor
+				FDungeonCell BodyValue;
+				BodyValue.CellType = EDungeonCellType::Staircase;
+				BodyValue.HallwayIndex = HallwayIndex;
+				BodyValue.StaircaseDirection = Staircase.Direction;
+				Grid.FillBox(RunMin, RunMax, BodyValue, StaircaseCellMask);
 				for (int32 s = 1; s <= RiseToRun; ++s)
 				{
 					const FIntVector BodyCell(Prev.X + DirX * s, Prev.Y + DirY * s, LowerZ);
 					if (Grid.IsInBounds(BodyCell))
 					{
-						FDungeonCell& Cell = Grid.GetCell(BodyCell);
-						Cell.CellType = EDungeonCellType::Staircase;
-						Cell.HallwayIndex = HallwayIndex;
-						Cell.StaircaseDirection = Staircase.Direction;
 						Staircase.OccupiedCells.Add(BodyCell);
+						MarkChanged(BodyCell);
 					}
 				}
 
 				// Carve headroom cells above body (Z is up).
 				// Claim empty and hallway cells as StaircaseHead to reserve the shaft
 				// and prevent later staircases from overlapping.
+				FDungeonCell HeadValue = BodyValue;
+				HeadValue.CellType = EDungeonCellType::StaircaseHead;
+				Grid.FillBoxWhere(
+					FIntVector(RunMin.X, RunMin.Y, LowerZ + 1),
+					FIntVector(RunMax.X, RunMax.Y, LowerZ + 1 + HeadroomCells),
+					FDungeonGrid::CellTypeBit(EDungeonCellType::Empty) | FDungeonGrid::CellTypeBit(EDungeonCellType::Hallway),
+					HeadValue, StaircaseCellMask, MarkChanged);
 				for (int32 s = 1; s <= RiseToRun; ++s)
 				{
 					for (int32 h = 1; h <= HeadroomCells; ++h)
@@ -497,14 +2342,6 @@ void FHallwayPathfinder::CarveHallway(
 						const FIntVector HeadCell(Prev.X + DirX * s, Prev.Y + DirY * s, LowerZ + h);
 						if (Grid.IsInBounds(HeadCell))
 						{
-							FDungeonCell& HeadCellRef = Grid.GetCell(HeadCell);
-							if (HeadCellRef.CellType == EDungeonCellType::Empty
-								|| HeadCellRef.CellType == EDungeonCellType::Hallway)
-							{
-								HeadCellRef.CellType = EDungeonCellType::StaircaseHead;
-								HeadCellRef.HallwayIndex = HallwayIndex;
-								HeadCellRef.StaircaseDirection = Staircase.Direction;
-							}
 							Staircase.OccupiedCells.Add(HeadCell);
 						}
 					}
@@ -515,7 +2352,7 @@ void FHallwayPathfinder::CarveHallway(
 			}
 		}
 
-		FDungeonCell& Cell = Grid.GetCell(Coord);
+		const FDungeonCell& Cell = Grid.GetCell(Coord);
 
 		// Skip cells belonging to source/dest rooms (but mark doors at transitions)
 		if (Cell.CellType == EDungeonCellType::Room &&
@@ -535,18 +2372,24 @@ void FHallwayPathfinder::CarveHallway(
 		// Carve as hallway
 		if (Cell.CellType == EDungeonCellType::Empty)
 		{
-			Cell.CellType = EDungeonCellType::Hallway;
-			Cell.HallwayIndex = HallwayIndex;
+			FDungeonCell& Carved = Grid.GetCellForWrite(Coord);
+			Carved.CellType = EDungeonCellType::Hallway;
+			Carved.HallwayIndex = HallwayIndex;
+			MarkChanged(Coord);
 		}
 	}
 
-	// Door placement pass: mark room cells adjacent to hallway cells along the path
-	for (int32 i = 1; i < Path.Num() - 1; ++i)
+	// Door placement pass: mark room cells adjacent to hallway cells along the path.
+	// A boundary-to-boundary path starts and ends on its door cells, so its endpoints count too;
+	// a center-to-center path keeps its endpoints as room cells.
+	const int32 FirstDoorCandidate = Params.bMultiGoalHallwaySearch ? 0 : 1;
+	const int32 LastDoorCandidate = Params.bMultiGoalHallwaySearch ? Path.Num() - 1 : Path.Num() - 2;
+	for (int32 i = FirstDoorCandidate; i <= LastDoorCandidate; ++i)
 	{
 		const FIntVector& Coord = Path[i];
 		if (!Grid.IsInBounds(Coord)) continue;
 
-		FDungeonCell& Cell = Grid.GetCell(Coord);
+		const FDungeonCell& Cell = Grid.GetCell(Coord);
 		if (Cell.CellType != EDungeonCellType::Room) continue;
 		if (Cell.RoomIndex != SourceRoomIdx && Cell.RoomIndex != DestRoomIdx) continue;
 
@@ -558,8 +2401,10 @@ void FHallwayPathfinder::CarveHallway(
 
 		if (bPrevIsHallway || bNextIsHallway)
 		{
-			Cell.CellType = EDungeonCellType::Door;
-			Cell.HallwayIndex = HallwayIndex;
+			FDungeonCell& Door = Grid.GetCellForWrite(Coord);
+			Door.CellType = EDungeonCellType::Door;
+			Door.HallwayIndex = HallwayIndex;
+			MarkChanged(Coord);
 		}
 	}
 }
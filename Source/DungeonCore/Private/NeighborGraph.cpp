@@ -0,0 +1,455 @@
+#include "NeighborGraph.h"
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+namespace
+{
+	/** Points bucketed into a uniform grid of cubic cells: counting-sorted into flat arrays. */
+	struct FPointGrid
+	{
+		FVector Origin = FVector::ZeroVector;
+		double CellSize = 1.0;
+		FIntVector Dims = FIntVector(1, 1, 1);
+		TArray<int32> CellStart;  // Prefix offsets into Sorted, one past the last cell included
+		TArray<int32> Sorted;     // Point indices grouped by cell
+
+		void Build(const TArray<FVector>& Points)
+		{
+			const int32 NumPoints = Points.Num();
+			FVector Min = Points[0];
+			FVector Max = Points[0];
+			for (const FVector& P : Points)
+			{
+				Min = Min.ComponentMin(P);
+				Max = Max.ComponentMax(P);
+			}
+			Origin = Min;
+			const FVector Extent = Max - Min;
+
+			// Aim for about two points per cell over the axes the points actually spread along.
+			// An axis thinner than one cell adds nothing, so drop it and size again.
+			constexpr double PointsPerCell = 2.0;
+			bool bActive[3] = { Extent.X > 0.0, Extent.Y > 0.0, Extent.Z > 0.0 };
+			CellSize = 1.0;
+			for (int32 Pass = 0; Pass < 3; ++Pass)
+			{
+				double Volume = 1.0;
+				int32 NumActive = 0;
+				for (int32 Axis = 0; Axis < 3; ++Axis)
+				{
+					if (bActive[Axis])
+					{
+						Volume *= Extent[Axis];
+						++NumActive;
+					}
+				}
+				if (NumActive == 0)
+				{
+					break;
+				}
+				CellSize = FMath::Pow(Volume * PointsPerCell / NumPoints, 1.0 / NumActive);
+
+				bool bDropped = false;
+				for (int32 Axis = 0; Axis < 3; ++Axis)
+				{
+					if (bActive[Axis] && Extent[Axis] < CellSize)
+					{
+						bActive[Axis] = false;
+						bDropped = true;
+					}
+				}
+				if (!bDropped)
+				{
+					break;
+				}
+			}
+			if (!(CellSize > 0.0))
+			{
+				CellSize = 1.0;
+			}
+
+			Dims.X = static_cast<int32>(Extent.X / CellSize) + 1;
+			Dims.Y = static_cast<int32>(Extent.Y / CellSize) + 1;
+			Dims.Z = static_cast<int32>(Extent.Z / CellSize) + 1;
+
+			// Counting sort by cell
+			CellStart.Init(0, Dims.X * Dims.Y * Dims.Z + 1);
+			TArray<int32> PointCell;
+			PointCell.SetNumUninitialized(NumPoints);
+			for (int32 i = 0; i < NumPoints; ++i)
+			{
+				PointCell[i] = CellIndex(CellOf(Points[i]));
+				++CellStart[PointCell[i] + 1];
+			}
+			for (int32 c = 1; c < CellStart.Num(); ++c)
+			{
+				CellStart[c] += CellStart[c - 1];
+			}
+			Sorted.SetNumUninitialized(NumPoints);
+			TArray<int32> Cursor(CellStart.GetData(), CellStart.Num() - 1);
+			for (int32 i = 0; i < NumPoints; ++i)
+			{
+				Sorted[Cursor[PointCell[i]]++] = i;
+			}
+		}
+
+		FIntVector CellOf(const FVector& P) const
+		{
+			const FVector Local = (P - Origin) / CellSize;
+			return FIntVector(
+				FMath::Clamp(FMath::FloorToInt32(Local.X), 0, Dims.X - 1),
+				FMath::Clamp(FMath::FloorToInt32(Local.Y), 0, Dims.Y - 1),
+				FMath::Clamp(FMath::FloorToInt32(Local.Z), 0, Dims.Z - 1));
+		}
+
+		FORCEINLINE int32 CellIndex(const FIntVector& Cell) const
+		{
+			return Cell.X + Cell.Y * Dims.X + Cell.Z * Dims.X * Dims.Y;
+		}
+
+		/** Calls Visit(PointIdx) for every point in the cells [Min, Max] (inclusive, clamped). */
+		template<typename VisitorType>
+		void ForEachInBox(FIntVector Min, FIntVector Max, VisitorType&& Visit) const
+		{
+			Min = FIntVector(FMath::Max(Min.X, 0), FMath::Max(Min.Y, 0), FMath::Max(Min.Z, 0));
+			Max = FIntVector(FMath::Min(Max.X, Dims.X - 1), FMath::Min(Max.Y, Dims.Y - 1), FMath::Min(Max.Z, Dims.Z - 1));
+			if (Min.X > Max.X || Min.Y > Max.Y || Min.Z > Max.Z)
+			{
+				return;
+			}
+			for (int32 Z = Min.Z; Z <= Max.Z; ++Z)
+			{
+				for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+				{
+					const int32 RowBase = Y * Dims.X + Z * Dims.X * Dims.Y;
+					for (int32 c = CellStart[RowBase + Min.X]; c < CellStart[RowBase + Max.X + 1]; ++c)
+					{
+						Visit(Sorted[c]);
+					}
+				}
+			}
+		}
+
+		/**
+		 * Calls Visit(PointIdx) for the points in every cell at Chebyshev distance Ring from Center.
+		 * Any point in a cell further out is more than Ring * CellSize from a point inside Center.
+		 */
+		template<typename VisitorType>
+		void ForEachInRing(const FIntVector& Center, int32 Ring, VisitorType&& Visit) const
+		{
+			if (Ring == 0)
+			{
+				ForEachInBox(Center, Center, Visit);
+				return;
+			}
+			for (int32 DZ = -Ring; DZ <= Ring; ++DZ)
+			{
+				for (int32 DY = -Ring; DY <= Ring; ++DY)
+				{
+					const FIntVector Row(Center.X, Center.Y + DY, Center.Z + DZ);
+					if (FMath::Abs(DZ) == Ring || FMath::Abs(DY) == Ring)
+					{
+						ForEachInBox(Row - FIntVector(Ring, 0, 0), Row + FIntVector(Ring, 0, 0), Visit);
+					}
+					else
+					{
+						ForEachInBox(Row - FIntVector(Ring, 0, 0), Row - FIntVector(Ring, 0, 0), Visit);
+						ForEachInBox(Row + FIntVector(Ring, 0, 0), Row + FIntVector(Ring, 0, 0), Visit);
+					}
+				}
+			}
+		}
+
+		/** Rings needed from any cell to cover the whole grid. */
+		int32 MaxRing() const
+		{
+			return FMath::Max3(Dims.X, Dims.Y, Dims.Z);
+		}
+	};
+
+	/** (DistSq, Index) ordering with the index breaking ties, so results never depend on visit order. */
+	FORCEINLINE bool IsCloser(double DistSqA, int32 IndexA, double DistSqB, int32 IndexB)
+	{
+		return DistSqA < DistSqB || (DistSqA == DistSqB && IndexA < IndexB);
+	}
+
+	FORCEINLINE int64 PackEdge(int32 A, int32 B)
+	{
+		return (static_cast<int64>(FMath::Min(A, B)) << 32) | static_cast<uint32>(FMath::Max(A, B));
+	}
+
+	struct FDisjointSet
+	{
+		TArray<int32> Parent;
+
+		explicit FDisjointSet(int32 Num)
+		{
+			Parent.SetNumUninitialized(Num);
+			for (int32 i = 0; i < Num; ++i)
+			{
+				Parent[i] = i;
+			}
+		}
+
+		int32 Find(int32 X)
+		{
+			while (Parent[X] != X)
+			{
+				X = Parent[X] = Parent[Parent[X]];
+			}
+			return X;
+		}
+
+		/** Returns false if A and B were already joined. */
+		bool Union(int32 A, int32 B)
+		{
+			A = Find(A);
+			B = Find(B);
+			if (A == B)
+			{
+				return false;
+			}
+			Parent[FMath::Max(A, B)] = FMath::Min(A, B);
+			return true;
+		}
+	};
+
+	/** True if a point other than A and B rules out edge A-B under Pruning. */
+	bool HasWitness(const FPointGrid& Grid, const TArray<FVector>& Points, int32 A, int32 B, EDungeonNeighborPruning Pruning)
+	{
+		const FVector& PA = Points[A];
+		const FVector& PB = Points[B];
+		const FVector Mid = (PA + PB) * 0.5;
+		const double LengthSq = FVector::DistSquared(PA, PB);
+
+		// Gabriel witnesses lie within |AB| / 2 of the midpoint; the RNG lune within sqrt(3)/2 * |AB|
+		const double Reach = FMath::Sqrt(LengthSq) * (Pruning == EDungeonNeighborPruning::Gabriel ? 0.5 : 0.8660254037844387);
+		bool bFound = false;
+		Grid.ForEachInBox(Grid.CellOf(Mid - FVector(Reach)), Grid.CellOf(Mid + FVector(Reach)), [&](int32 C)
+		{
+			if (bFound || C == A || C == B)
+			{
+				return;
+			}
+			const FVector& PC = Points[C];
+			bFound = Pruning == EDungeonNeighborPruning::Gabriel
+				? FVector::DistSquared(PC, Mid) < LengthSq * 0.25
+				: FVector::DistSquared(PC, PA) < LengthSq && FVector::DistSquared(PC, PB) < LengthSq;
+		});
+		return bFound;
+	}
+}
+
+// ============================================================================
+// Build
+// ============================================================================
+
+void FNeighborGraph::Build(
+	const TArray<FVector>& Points,
+	int32 NeighborCount,
+	EDungeonNeighborPruning Pruning,
+	TArray<TPair<int32, int32>>& OutEdges)
+{
+	OutEdges.Reset();
+	const int32 NumPoints = Points.Num();
+
+	if (NumPoints < 2)
+	{
+		return;
+	}
+
+	const int32 K = FMath::Clamp(NeighborCount, 1, NumPoints - 1);
+
+	FPointGrid Grid;
+	Grid.Build(Points);
+
+	// k nearest neighbors per point: scan rings of cells outward until the k-th best is closer
+	// than anything the next ring could hold
+	struct FNeighbor
+	{
+		double DistSq;
+		int32 Index;
+	};
+	TArray<FNeighbor, TInlineAllocator<32>> Best;
+	TArray<int64> PackedEdges;
+	PackedEdges.Reserve(NumPoints * K);
+	for (int32 i = 0; i < NumPoints; ++i)
+	{
+		const FVector& P = Points[i];
+		const FIntVector Center = Grid.CellOf(P);
+		Best.Reset();
+
+		auto Consider = [&](int32 j)
+		{
+			if (j == i)
+			{
+				return;
+			}
+			const double DistSq = FVector::DistSquared(P, Points[j]);
+			if (Best.Num() == K && !IsCloser(DistSq, j, Best.Last().DistSq, Best.Last().Index))
+			{
+				return;
+			}
+			if (Best.Num() == K)
+			{
+				Best.Pop(EAllowShrinking::No);
+			}
+			int32 Slot = Best.Num();
+			while (Slot > 0 && IsCloser(DistSq, j, Best[Slot - 1].DistSq, Best[Slot - 1].Index))
+			{
+				--Slot;
+			}
+			Best.Insert(FNeighbor{ DistSq, j }, Slot);
+		};
+
+		for (int32 Ring = 0; Ring <= Grid.MaxRing(); ++Ring)
+		{
+			Grid.ForEachInRing(Center, Ring, Consider);
+			const double Cleared = Ring * Grid.CellSize;
+			if (Best.Num() == K && Best.Last().DistSq < Cleared * Cleared)
+			{
+				break;
+			}
+		}
+
+		for (const FNeighbor& Neighbor : Best)
+		{
+			PackedEdges.Add(PackEdge(i, Neighbor.Index));
+		}
+	}
+
+	PackedEdges.Sort();
+	int32 NumUnique = 0;
+	for (int32 i = 0; i < PackedEdges.Num(); ++i)
+	{
+		if (i == 0 || PackedEdges[i] != PackedEdges[i - 1])
+		{
+			PackedEdges[NumUnique++] = PackedEdges[i];
+		}
+	}
+	PackedEdges.SetNum(NumUnique, EAllowShrinking::No);
+
+	auto EdgeA = [](int64 Edge) { return static_cast<int32>(Edge >> 32); };
+	auto EdgeB = [](int64 Edge) { return static_cast<int32>(Edge & 0xFFFFFFFF); };
+
+	// Bridge separate clusters (Boruvka): join every component to its nearest outside point until
+	// one remains. Rarely more than a round or two, and only when clusters sit more than k apart.
+	{
+		FDisjointSet Components(NumPoints);
+		int32 NumComponents = NumPoints;
+		for (const int64 Edge : PackedEdges)
+		{
+			NumComponents -= Components.Union(EdgeA(Edge), EdgeB(Edge)) ? 1 : 0;
+		}
+
+		struct FBridge
+		{
+			double DistSq = TNumericLimits<double>::Max();
+			int32 From = INDEX_NONE;
+			int32 To = INDEX_NONE;
+		};
+		TArray<FBridge> ComponentBridge;
+		TArray<int32> Root;
+		Root.SetNumUninitialized(NumPoints);
+		while (NumComponents > 1)
+		{
+			ComponentBridge.Reset();
+			ComponentBridge.SetNum(NumPoints);
+			for (int32 i = 0; i < NumPoints; ++i)
+			{
+				Root[i] = Components.Find(i);
+			}
+
+			for (int32 i = 0; i < NumPoints; ++i)
+			{
+				FBridge& Bridge = ComponentBridge[Root[i]];
+				const FVector& P = Points[i];
+				const FIntVector Center = Grid.CellOf(P);
+				for (int32 Ring = 0; Ring <= Grid.MaxRing(); ++Ring)
+				{
+					// Nothing further out can beat this component's best bridge so far
+					const double Cleared = (Ring - 1) * Grid.CellSize;
+					if (Ring > 0 && Bridge.DistSq < Cleared * Cleared)
+					{
+						break;
+					}
+					Grid.ForEachInRing(Center, Ring, [&](int32 j)
+					{
+						if (Root[j] == Root[i])
+						{
+							return;
+						}
+						const double DistSq = FVector::DistSquared(P, Points[j]);
+						if (Bridge.From == INDEX_NONE || DistSq < Bridge.DistSq
+							|| (DistSq == Bridge.DistSq && PackEdge(i, j) < PackEdge(Bridge.From, Bridge.To)))
+						{
+							Bridge.DistSq = DistSq;
+							Bridge.From = i;
+							Bridge.To = j;
+						}
+					});
+				}
+			}
+
+			for (int32 i = 0; i < NumPoints; ++i)
+			{
+				const FBridge& Bridge = ComponentBridge[i];
+				if (Bridge.From != INDEX_NONE && Components.Union(Bridge.From, Bridge.To))
+				{
+					PackedEdges.Add(PackEdge(Bridge.From, Bridge.To));
+					--NumComponents;
+				}
+			}
+		}
+		PackedEdges.Sort();
+	}
+
+	// Prune, then put back the shortest pruned edges that reconnect whatever pruning split
+	if (Pruning != EDungeonNeighborPruning::None)
+	{
+		TArray<int64> Kept;
+		TArray<int64> Pruned;
+		Kept.Reserve(PackedEdges.Num());
+		for (const int64 Edge : PackedEdges)
+		{
+			(HasWitness(Grid, Points, EdgeA(Edge), EdgeB(Edge), Pruning) ? Pruned : Kept).Add(Edge);
+		}
+
+		FDisjointSet Components(NumPoints);
+		int32 NumComponents = NumPoints;
+		for (const int64 Edge : Kept)
+		{
+			NumComponents -= Components.Union(EdgeA(Edge), EdgeB(Edge)) ? 1 : 0;
+		}
+		if (NumComponents > 1)
+		{
+			Pruned.Sort([&](int64 L, int64 R)
+			{
+				const double LengthSqL = FVector::DistSquared(Points[EdgeA(L)], Points[EdgeB(L)]);
+				const double LengthSqR = FVector::DistSquared(Points[EdgeA(R)], Points[EdgeB(R)]);
+				return LengthSqL < LengthSqR || (LengthSqL == LengthSqR && L < R);
+			});
+			for (const int64 Edge : Pruned)
+			{
+				if (Components.Union(EdgeA(Edge), EdgeB(Edge)))
+				{
+					Kept.Add(Edge);
+					if (--NumComponents == 1)
+					{
+						break;
+					}
+				}
+			}
+			Kept.Sort();
+		}
+		PackedEdges = MoveTemp(Kept);
+	}
+
+	OutEdges.Reserve(PackedEdges.Num());
+	for (const int64 Edge : PackedEdges)
+	{
+		OutEdges.Add(TPair<int32, int32>(EdgeA(Edge), EdgeB(Edge)));
+	}
+}
@@ -1,34 +1,277 @@
 #include "RoomPlacement.h"
 #include "DungeonTypes.h"
 #include "DungeonSeed.h"
-#include "DungeonConfig.h"
+#include "DungeonGenerationParams.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogDungeonRooms, Log, All);
 
+namespace
+{
+	/** AABB overlap test: buffer on XY axes (hallway space), no buffer on Z (floors). */
+	FORCEINLINE bool DoRoomBoxesOverlap(
+		const FIntVector& Position,
+		const FIntVector& Size,
+		const FDungeonRoom& Other,
+		int32 Buffer)
+	{
+		const bool bOverlapX =
+			Position.X < (Other.Position.X + Other.Size.X + Buffer) &&
+			(Position.X + Size.X + Buffer) > Other.Position.X;
+
+		const bool bOverlapY =
+			Position.Y < (Other.Position.Y + Other.Size.Y + Buffer) &&
+			(Position.Y + Size.Y + Buffer) > Other.Position.Y;
+
+		const bool bOverlapZ =
+			Position.Z < (Other.Position.Z + Other.Size.Z) &&
+			(Position.Z + Size.Z) > Other.Position.Z;
+
+		return bOverlapX && bOverlapY && bOverlapZ;
+	}
+
+	/**
+	 * Poisson-disk acceleration grid: room indices bucketed by XY center in square cells of
+	 * Spacing / sqrt(2), so every room within Spacing of a point sits in the 5x5 cells around it.
+	 * Distances are 3D with floors scaled by FloorScale; only XY is bucketed since grids have few floors.
+	 */
+	struct FRoomCenterGrid
+	{
+		void Reset(const FIntVector& GridSize, float InSpacing, float InFloorScale)
+		{
+			Spacing = InSpacing;
+			FloorScale = InFloorScale;
+			CellSize = FMath::Max(Spacing / UE_SQRT_2, 1.0f);
+			CellsX = FMath::Max(FMath::CeilToInt(GridSize.X / CellSize), 1);
+			CellsY = FMath::Max(FMath::CeilToInt(GridSize.Y / CellSize), 1);
+			Cells.SetNum(CellsX * CellsY);
+			for (TArray<int32>& Cell : Cells)
+			{
+				Cell.Reset();
+			}
+		}
+
+		static FVector3f CenterOf(const FIntVector& Position, const FIntVector& Size, float FloorScale)
+		{
+			return FVector3f(
+				Position.X + Size.X * 0.5f,
+				Position.Y + Size.Y * 0.5f,
+				(Position.Z + Size.Z * 0.5f) * FloorScale);
+		}
+
+		void Add(int32 RoomIdx, const FVector3f& Center)
+		{
+			Cells[CellIndex(Center)].Add(RoomIdx);
+		}
+
+		/** True if no room in Rooms lies closer than Spacing to Center. */
+		bool IsClear(const FVector3f& Center, const TArray<FDungeonRoom>& Rooms) const
+		{
+			const int32 CX = FMath::Clamp(FMath::FloorToInt(Center.X / CellSize), 0, CellsX - 1);
+			const int32 CY = FMath::Clamp(FMath::FloorToInt(Center.Y / CellSize), 0, CellsY - 1);
+			const float SpacingSq = Spacing * Spacing;
+			for (int32 Y = FMath::Max(CY - 2, 0); Y <= FMath::Min(CY + 2, CellsY - 1); ++Y)
+			{
+				for (int32 X = FMath::Max(CX - 2, 0); X <= FMath::Min(CX + 2, CellsX - 1); ++X)
+				{
+					for (const int32 RoomIdx : Cells[X + Y * CellsX])
+					{
+						const FDungeonRoom& Room = Rooms[RoomIdx];
+						const FVector3f Delta = CenterOf(Room.Position, Room.Size, FloorScale) - Center;
+						if (Delta.X * Delta.X + Delta.Y * Delta.Y + Delta.Z * Delta.Z < SpacingSq)
+						{
+							return false;
+						}
+					}
+				}
+			}
+			return true;
+		}
+
+		int32 CellIndex(const FVector3f& Center) const
+		{
+			const int32 CX = FMath::Clamp(FMath::FloorToInt(Center.X / CellSize), 0, CellsX - 1);
+			const int32 CY = FMath::Clamp(FMath::FloorToInt(Center.Y / CellSize), 0, CellsY - 1);
+			return CX + CY * CellsX;
+		}
+
+		TArray<TArray<int32>> Cells;
+		float Spacing = 1.0f;
+		float FloorScale = 1.0f;
+		float CellSize = 1.0f;
+		int32 CellsX = 1;
+		int32 CellsY = 1;
+	};
+}
+
+// ============================================================================
+// Broadphase
+// ============================================================================
+
+void FRoomBroadphase::Reset(const FIntVector& GridSize, int32 InBucketSize, int32 InBuffer)
+{
+	BucketSize = FMath::Max(InBucketSize, 1);
+	Buffer = InBuffer;
+	BucketsX = FMath::Max(FMath::DivideAndRoundUp(GridSize.X, BucketSize), 1);
+	BucketsY = FMath::Max(FMath::DivideAndRoundUp(GridSize.Y, BucketSize), 1);
+
+	Buckets.SetNum(BucketsX * BucketsY);
+	for (TArray<int32>& Bucket : Buckets)
+	{
+		Bucket.Reset();
+	}
+}
+
+void FRoomBroadphase::GetBucketRange(const FIntVector& Min, const FIntVector& Extent, FIntPoint& OutMin, FIntPoint& OutMax) const
+{
+	// Two boxes overlap on an axis exactly when [Min, Min + Extent + Buffer) ranges share a cell
+	OutMin.X = FMath::Clamp(Min.X / BucketSize, 0, BucketsX - 1);
+	OutMin.Y = FMath::Clamp(Min.Y / BucketSize, 0, BucketsY - 1);
+	OutMax.X = FMath::Clamp((Min.X + FMath::Max(Extent.X + Buffer, 1) - 1) / BucketSize, 0, BucketsX - 1);
+	OutMax.Y = FMath::Clamp((Min.Y + FMath::Max(Extent.Y + Buffer, 1) - 1) / BucketSize, 0, BucketsY - 1);
+}
+
+void FRoomBroadphase::Add(int32 RoomIdx, const FDungeonRoom& Room)
+{
+	FIntPoint Min, Max;
+	GetBucketRange(Room.Position, Room.Size, Min, Max);
+	for (int32 BY = Min.Y; BY <= Max.Y; ++BY)
+	{
+		for (int32 BX = Min.X; BX <= Max.X; ++BX)
+		{
+			Buckets[BX + BY * BucketsX].Add(RoomIdx);
+		}
+	}
+}
+
+bool FRoomBroadphase::Overlaps(const FIntVector& Position, const FIntVector& Size, const TArray<FDungeonRoom>& Rooms) const
+{
+	// A room spanning several of these buckets is tested once per bucket; with buckets at least
+	// one room wide that is at most four times, cheaper than tracking which were already seen
+	FIntPoint Min, Max;
+	GetBucketRange(Position, Size, Min, Max);
+	for (int32 BY = Min.Y; BY <= Max.Y; ++BY)
+	{
+		for (int32 BX = Min.X; BX <= Max.X; ++BX)
+		{
+			for (const int32 RoomIdx : Buckets[BX + BY * BucketsX])
+			{
+				if (DoRoomBoxesOverlap(Position, Size, Rooms[RoomIdx], Buffer))
+				{
+					return true;
+				}
+			}
+		}
+	}
+	return false;
+}
+
+// ============================================================================
+// Occupancy summed-area table
+// ============================================================================
+
+void FRoomOccupancyTable::Reset(const FIntVector& InGridSize, int32 InBuffer)
+{
+	GridSize = InGridSize;
+	Buffer = InBuffer;
+	Table.Reset();
+	Table.SetNumZeroed((GridSize.X + 1) * (GridSize.Y + 1) * (GridSize.Z + 1));
+}
+
+void FRoomOccupancyTable::Add(const FDungeonRoom& Room)
+{
+	const FIntVector Min(
+		FMath::Clamp(Room.Position.X, 0, GridSize.X),
+		FMath::Clamp(Room.Position.Y, 0, GridSize.Y),
+		FMath::Clamp(Room.Position.Z, 0, GridSize.Z));
+	const FIntVector Max(
+		FMath::Clamp(Room.Position.X + Room.Size.X + Buffer, 0, GridSize.X),
+		FMath::Clamp(Room.Position.Y + Room.Size.Y + Buffer, 0, GridSize.Y),
+		FMath::Clamp(Room.Position.Z + Room.Size.Z, 0, GridSize.Z));
+	if (Min.X >= Max.X || Min.Y >= Max.Y || Min.Z >= Max.Z)
+	{
+		return;
+	}
+
+	// Every prefix box reaching past Min gains its overlap with the room: a product of the
+	// per-axis overlap lengths, which stop growing once the prefix passes Max
+	for (int32 Z = Min.Z + 1; Z <= GridSize.Z; ++Z)
+	{
+		const int64 LenZ = FMath::Min(Z, Max.Z) - Min.Z;
+		for (int32 Y = Min.Y + 1; Y <= GridSize.Y; ++Y)
+		{
+			const int64 LenYZ = LenZ * (FMath::Min(Y, Max.Y) - Min.Y);
+			int64* Row = &Table[TableIndex(0, Y, Z)];
+			for (int32 X = Min.X + 1; X <= GridSize.X; ++X)
+			{
+				Row[X] += LenYZ * (FMath::Min(X, Max.X) - Min.X);
+			}
+		}
+	}
+}
+
+int64 FRoomOccupancyTable::SumBox(const FIntVector& Min, const FIntVector& Max) const
+{
+	const int32 X0 = FMath::Clamp(Min.X, 0, GridSize.X);
+	const int32 Y0 = FMath::Clamp(Min.Y, 0, GridSize.Y);
+	const int32 Z0 = FMath::Clamp(Min.Z, 0, GridSize.Z);
+	const int32 X1 = FMath::Clamp(Max.X, X0, GridSize.X);
+	const int32 Y1 = FMath::Clamp(Max.Y, Y0, GridSize.Y);
+	const int32 Z1 = FMath::Clamp(Max.Z, Z0, GridSize.Z);
+
+	return Table[TableIndex(X1, Y1, Z1)]
+		- Table[TableIndex(X0, Y1, Z1)] - Table[TableIndex(X1, Y0, Z1)] - Table[TableIndex(X1, Y1, Z0)]
+		+ Table[TableIndex(X0, Y0, Z1)] + Table[TableIndex(X0, Y1, Z0)] + Table[TableIndex(X1, Y0, Z0)]
+		- Table[TableIndex(X0, Y0, Z0)];
+}
+
+bool FRoomOccupancyTable::Fits(const FIntVector& Position, const FIntVector& Size) const
+{
+	// Grown candidate vs grown rooms on XY (see FRoomBroadphase), plain extents on Z
+	return SumBox(Position, Position + FIntVector(Size.X + Buffer, Size.Y + Buffer, Size.Z)) == 0;
+}
+
+// ============================================================================
+// Placement
+// ============================================================================
+
 bool FRoomPlacement::PlaceRooms(
 	FDungeonGrid& Grid,
-	const UDungeonConfiguration& Config,
+	const FDungeonGenerationParams& Params,
 	FDungeonSeed& Seed,
 	TArray<FDungeonRoom>& OutRooms)
 {
 	FDungeonSeed RoomSeed = Seed.Fork(1);
 
-	for (int32 i = 0; i < Config.RoomCount; ++i)
+	if (Params.RoomPlacementMode == EDungeonRoomPlacement::SummedAreaTable)
+	{
+		return PlaceRoomsSummedArea(Grid, Params, RoomSeed, OutRooms);
+	}
+	if (Params.RoomPlacementMode == EDungeonRoomPlacement::PoissonDisk)
+	{
+		return PlaceRoomsPoissonDisk(Grid, Params, RoomSeed, OutRooms);
+	}
+
+	// Buckets as wide as the largest grown room, so each room lands in at most 2x2 of them
+	FRoomBroadphase Broadphase;
+	Broadphase.Reset(Params.GridSize,
+		FMath::Max(Params.MaxRoomSize.X, Params.MaxRoomSize.Y) + Params.RoomBuffer, Params.RoomBuffer);
+
+	for (int32 i = 0; i < Params.RoomCount; ++i)
 	{
 		bool bPlaced = false;
 
-		for (int32 Attempt = 0; Attempt < Config.MaxPlacementAttempts; ++Attempt)
+		for (int32 Attempt = 0; Attempt < Params.MaxPlacementAttempts; ++Attempt)
 		{
 			// Random size within configured bounds
-			const int32 SizeX = RoomSeed.RandRange(Config.MinRoomSize.X, Config.MaxRoomSize.X);
-			const int32 SizeY = RoomSeed.RandRange(Config.MinRoomSize.Y, Config.MaxRoomSize.Y);
-			const int32 SizeZ = RoomSeed.RandRange(Config.MinRoomSize.Z, Config.MaxRoomSize.Z);
+			const int32 SizeX = RoomSeed.RandRange(Params.MinRoomSize.X, Params.MaxRoomSize.X);
+			const int32 SizeY = RoomSeed.RandRange(Params.MinRoomSize.Y, Params.MaxRoomSize.Y);
+			const int32 SizeZ = RoomSeed.RandRange(Params.MinRoomSize.Z, Params.MaxRoomSize.Z);
 
 			// Valid position range (buffer from grid edges on XY, no buffer on Z)
-			const int32 MinPos = Config.RoomBuffer;
-			const int32 MaxPosX = Config.GridSize.X - SizeX - Config.RoomBuffer;
-			const int32 MaxPosY = Config.GridSize.Y - SizeY - Config.RoomBuffer;
-			const int32 MaxPosZ = Config.GridSize.Z - SizeZ;
+			const int32 MinPos = Params.RoomBuffer;
+			const int32 MaxPosX = Params.GridSize.X - SizeX - Params.RoomBuffer;
+			const int32 MaxPosY = Params.GridSize.Y - SizeY - Params.RoomBuffer;
+			const int32 MaxPosZ = Params.GridSize.Z - SizeZ;
 
 			if (MaxPosX < MinPos || MaxPosY < MinPos || MaxPosZ < 0)
 			{
@@ -42,18 +285,10 @@ bool FRoomPlacement::PlaceRooms(
 			const FIntVector Position(PosX, PosY, PosZ);
 			const FIntVector Size(SizeX, SizeY, SizeZ);
 
-			if (!DoesRoomOverlap(Position, Size, OutRooms, Config.RoomBuffer))
+			if (!Broadphase.Overlaps(Position, Size, OutRooms))
 			{
-				FDungeonRoom Room;
-				Room.RoomIndex = static_cast<uint8>(OutRooms.Num() + 1);
-				Room.RoomType = EDungeonRoomType::Generic;
-				Room.Position = Position;
-				Room.Size = Size;
-				Room.Center = Position + FIntVector(SizeX / 2, SizeY / 2, SizeZ / 2);
-				Room.FloorLevel = PosZ;
-
-				StampRoomToGrid(Grid, Room);
-				OutRooms.Add(Room);
+				const FDungeonRoom& Room = AddRoom(Grid, Position, Size, OutRooms);
+				Broadphase.Add(OutRooms.Num() - 1, Room);
 				bPlaced = true;
 				break;
 			}
@@ -63,59 +298,340 @@ bool FRoomPlacement::PlaceRooms(
 		{
 			UE_LOG(LogDungeonRooms, Warning,
 				TEXT("Failed to place room %d/%d after %d attempts"),
-				i + 1, Config.RoomCount, Config.MaxPlacementAttempts);
+				i + 1, Params.RoomCount, Params.MaxPlacementAttempts);
 		}
 	}
 
-	UE_LOG(LogDungeonRooms, Log, TEXT("Placed %d/%d rooms"), OutRooms.Num(), Config.RoomCount);
+	UE_LOG(LogDungeonRooms, Log, TEXT("Placed %d/%d rooms"), OutRooms.Num(), Params.RoomCount);
 	return OutRooms.Num() >= 2;
 }
 
-bool FRoomPlacement::DoesRoomOverlap(
-	const FIntVector& Position,
-	const FIntVector& Size,
-	const TArray<FDungeonRoom>& ExistingRooms,
-	int32 Buffer)
+bool FRoomPlacement::PlaceRoomsSummedArea(
+	FDungeonGrid& Grid,
+	const FDungeonGenerationParams& Params,
+	FDungeonSeed& RoomSeed,
+	TArray<FDungeonRoom>& OutRooms)
 {
-	for (const FDungeonRoom& Other : ExistingRooms)
+	FRoomOccupancyTable Occupancy;
+	Occupancy.Reset(Params.GridSize, Params.RoomBuffer);
+
+	// Rooms are only ever added, so a size that fits nowhere never fits again — and neither does
+	// any size at least as large on every axis. Remembering those keeps a full grid from
+	// rescanning every position on each of MaxPlacementAttempts draws.
+	TArray<FIntVector> DeadSizes;
+	auto IsDead = [&DeadSizes](const FIntVector& Size)
 	{
-		// AABB overlap test: buffer on XY axes (hallway space), no buffer on Z (floors)
-		const bool bOverlapX =
-			Position.X < (Other.Position.X + Other.Size.X + Buffer) &&
-			(Position.X + Size.X + Buffer) > Other.Position.X;
+		for (const FIntVector& Dead : DeadSizes)
+		{
+			if (Size.X >= Dead.X && Size.Y >= Dead.Y && Size.Z >= Dead.Z)
+			{
+				return true;
+			}
+		}
+		return false;
+	};
 
-		const bool bOverlapY =
-			Position.Y < (Other.Position.Y + Other.Size.Y + Buffer) &&
-			(Position.Y + Size.Y + Buffer) > Other.Position.Y;
+	// Random positions tried per size before falling back to a full scan. While the grid has room
+	// these almost always hit, so the scan only runs once free space gets scarce.
+	constexpr int32 RandomProbes = 16;
 
-		const bool bOverlapZ =
-			Position.Z < (Other.Position.Z + Other.Size.Z) &&
-			(Position.Z + Size.Z) > Other.Position.Z;
+	// Uniform pick among the fits for Size (same ranges as rejection sampling); false (and Size
+	// marked dead) if there are none
+	auto TryPlace = [&](const FIntVector& Size)
+	{
+		if (IsDead(Size))
+		{
+			return false;
+		}
 
-		if (bOverlapX && bOverlapY && bOverlapZ)
+		const int32 MinPos = Params.RoomBuffer;
+		const int32 MaxPosX = Params.GridSize.X - Size.X - Params.RoomBuffer;
+		const int32 MaxPosY = Params.GridSize.Y - Size.Y - Params.RoomBuffer;
+		const int32 MaxPosZ = Params.GridSize.Z - Size.Z;
+
+		// A uniform probe that fits is a uniform pick among the fits
+		const bool bInRange = MaxPosX >= MinPos && MaxPosY >= MinPos && MaxPosZ >= 0;
+		FIntVector Position;
+		bool bFound = false;
+		for (int32 Probe = 0; bInRange && Probe < RandomProbes && !bFound; ++Probe)
 		{
-			return true;
+			Position = FIntVector(
+				RoomSeed.RandRange(MinPos, MaxPosX), RoomSeed.RandRange(MinPos, MaxPosY), RoomSeed.RandRange(0, MaxPosZ));
+			bFound = Occupancy.Fits(Position, Size);
+		}
+
+		// Otherwise one pass over every position, keeping the k-th fit seen with probability 1/k
+		if (!bFound)
+		{
+			int32 NumFits = 0;
+			for (int32 Z = 0; Z <= MaxPosZ; ++Z)
+			{
+				for (int32 Y = MinPos; Y <= MaxPosY; ++Y)
+				{
+					for (int32 X = MinPos; X <= MaxPosX; ++X)
+					{
+						if (Occupancy.Fits(FIntVector(X, Y, Z), Size) && RoomSeed.RandRange(0, NumFits++) == 0)
+						{
+							Position = FIntVector(X, Y, Z);
+						}
+					}
+				}
+			}
+
+			if (NumFits == 0)
+			{
+				DeadSizes.Add(Size);
+				return false;
+			}
+		}
+
+		Occupancy.Add(AddRoom(Grid, Position, Size, OutRooms));
+		return true;
+	};
+
+	for (int32 i = 0; i < Params.RoomCount; ++i)
+	{
+		if (IsDead(Params.MinRoomSize))
+		{
+			UE_LOG(LogDungeonRooms, Warning,
+				TEXT("Grid full: no %dx%dx%d room fits after placing %d/%d rooms"),
+				Params.MinRoomSize.X, Params.MinRoomSize.Y, Params.MinRoomSize.Z, OutRooms.Num(), Params.RoomCount);
+			break;
+		}
+
+		bool bPlaced = false;
+		for (int32 Attempt = 0; Attempt < Params.MaxPlacementAttempts && !bPlaced; ++Attempt)
+		{
+			const int32 SizeX = RoomSeed.RandRange(Params.MinRoomSize.X, Params.MaxRoomSize.X);
+			const int32 SizeY = RoomSeed.RandRange(Params.MinRoomSize.Y, Params.MaxRoomSize.Y);
+			const int32 SizeZ = RoomSeed.RandRange(Params.MinRoomSize.Z, Params.MaxRoomSize.Z);
+			bPlaced = TryPlace(FIntVector(SizeX, SizeY, SizeZ));
+		}
+
+		// Every drawn size is too big for what is left; the smallest room may still fit
+		if (!bPlaced && !TryPlace(Params.MinRoomSize))
+		{
+			UE_LOG(LogDungeonRooms, Warning,
+				TEXT("Failed to place room %d/%d after %d attempts"),
+				i + 1, Params.RoomCount, Params.MaxPlacementAttempts);
 		}
 	}
-	return false;
+
+	UE_LOG(LogDungeonRooms, Log, TEXT("Placed %d/%d rooms"), OutRooms.Num(), Params.RoomCount);
+	return OutRooms.Num() >= 2;
 }
 
-void FRoomPlacement::StampRoomToGrid(FDungeonGrid& Grid, const FDungeonRoom& Room)
+bool FRoomPlacement::PlaceRoomsPoissonDisk(
+	FDungeonGrid& Grid,
+	const FDungeonGenerationParams& Params,
+	FDungeonSeed& RoomSeed,
+	TArray<FDungeonRoom>& OutRooms)
 {
-	for (int32 X = Room.Position.X; X < Room.Position.X + Room.Size.X; ++X)
+	// Candidates tried around an active room before it is retired (Bridson's k)
+	constexpr int32 CandidatesPerRoom = 30;
+	// Auto spacing shrinks by this much each time the active list runs dry short of RoomCount
+	constexpr float SpacingShrink = 0.8f;
+
+	const int32 Buffer = Params.RoomBuffer;
+	const bool bAutoSpacing = Params.RoomCenterSpacing <= 0.0f;
+	const float UsableArea = static_cast<float>(
+		FMath::Max(Params.GridSize.X - 2 * Buffer, 1) * FMath::Max(Params.GridSize.Y - 2 * Buffer, 1));
+
+	// One room per Spacing x Spacing square of floor to start with: spread out, and tightened
+	// below if Bridson fills the grid before placing every room
+	float Spacing = bAutoSpacing
+		? FMath::Sqrt(UsableArea / FMath::Max(Params.RoomCount, 1))
+		: Params.RoomCenterSpacing;
+
+	// A floor apart counts as far as a staircase between them runs (matches the A* heuristic)
+	const float FloorScale = static_cast<float>(Params.StaircaseRiseToRun + 1);
+
+	FRoomBroadphase Broadphase;
+	Broadphase.Reset(Params.GridSize,
+		FMath::Max(Params.MaxRoomSize.X, Params.MaxRoomSize.Y) + Buffer, Buffer);
+	FRoomCenterGrid Centers;
+	Centers.Reset(Params.GridSize, Spacing, FloorScale);
+	TArray<int32> Active;
+
+	auto DrawSize = [&Params, &RoomSeed]()
+	{
+		const int32 SizeX = RoomSeed.RandRange(Params.MinRoomSize.X, Params.MaxRoomSize.X);
+		const int32 SizeY = RoomSeed.RandRange(Params.MinRoomSize.Y, Params.MaxRoomSize.Y);
+		const int32 SizeZ = RoomSeed.RandRange(Params.MinRoomSize.Z, Params.MaxRoomSize.Z);
+		return FIntVector(SizeX, SizeY, SizeZ);
+	};
+
+	// Place a room at Position if it is in range (same ranges as rejection sampling), clear of
+	// every room, and at least Spacing from every center
+	auto TryAdd = [&](const FIntVector& Position, const FIntVector& Size)
+	{
+		if (Position.X < Buffer || Position.X > Params.GridSize.X - Size.X - Buffer
+			|| Position.Y < Buffer || Position.Y > Params.GridSize.Y - Size.Y - Buffer
+			|| Position.Z < 0 || Position.Z > Params.GridSize.Z - Size.Z)
+		{
+			return false;
+		}
+
+		const FVector3f Center = FRoomCenterGrid::CenterOf(Position, Size, FloorScale);
+		if (Broadphase.Overlaps(Position, Size, OutRooms) || !Centers.IsClear(Center, OutRooms))
+		{
+			return false;
+		}
+
+		const int32 RoomIdx = OutRooms.Num();
+		const FDungeonRoom& Room = AddRoom(Grid, Position, Size, OutRooms);
+		Broadphase.Add(RoomIdx, Room);
+		Centers.Add(RoomIdx, Center);
+		Active.Add(RoomIdx);
+		return true;
+	};
+
+	while (OutRooms.Num() < Params.RoomCount)
 	{
-		for (int32 Y = Room.Position.Y; Y < Room.Position.Y + Room.Size.Y; ++Y)
+		if (Active.Num() == 0)
 		{
-			for (int32 Z = Room.Position.Z; Z < Room.Position.Z + Room.Size.Z; ++Z)
+			if (OutRooms.Num() == 0)
 			{
-				if (Grid.IsInBounds(X, Y, Z))
+				// First room: plain random draws
+				bool bSeeded = false;
+				for (int32 Attempt = 0; Attempt < Params.MaxPlacementAttempts && !bSeeded; ++Attempt)
 				{
-					FDungeonCell& Cell = Grid.GetCell(X, Y, Z);
-					Cell.CellType = EDungeonCellType::Room;
-					Cell.RoomIndex = Room.RoomIndex;
-					Cell.FloorIndex = static_cast<uint8>(Z);
+					const FIntVector Size = DrawSize();
+					const FIntVector Position(
+						RoomSeed.RandRange(Buffer, Params.GridSize.X - Size.X - Buffer),
+						RoomSeed.RandRange(Buffer, Params.GridSize.Y - Size.Y - Buffer),
+						RoomSeed.RandRange(0, Params.GridSize.Z - Size.Z));
+					bSeeded = TryAdd(Position, Size);
 				}
+				if (!bSeeded)
+				{
+					break;
+				}
+				continue;
+			}
+
+			// Every room is surrounded at this spacing. A configured spacing is a hard minimum;
+			// an automatic one tightens and grows again from every room placed so far.
+			if (!bAutoSpacing || Spacing * SpacingShrink < 1.0f)
+			{
+				break;
+			}
+			Spacing *= SpacingShrink;
+			Centers.Reset(Params.GridSize, Spacing, FloorScale);
+			for (int32 RoomIdx = 0; RoomIdx < OutRooms.Num(); ++RoomIdx)
+			{
+				const FDungeonRoom& Room = OutRooms[RoomIdx];
+				Centers.Add(RoomIdx, FRoomCenterGrid::CenterOf(Room.Position, Room.Size, FloorScale));
+				Active.Add(RoomIdx);
 			}
+			continue;
 		}
+
+		const int32 ActiveSlot = RoomSeed.RandRange(0, Active.Num() - 1);
+		// By value: placing a room may reallocate OutRooms
+		const FVector3f ParentCenter = FRoomCenterGrid::CenterOf(
+			OutRooms[Active[ActiveSlot]].Position, OutRooms[Active[ActiveSlot]].Size, FloorScale);
+
+		bool bAdded = false;
+		for (int32 Candidate = 0; Candidate < CandidatesPerRoom && !bAdded; ++Candidate)
+		{
+			const FIntVector Size = DrawSize();
+
+			// Offset uniform over the [Spacing, 2 * Spacing] annulus, drawn by rejection from its
+			// bounding square (no trig, so every platform rounds the same)
+			const float OuterRadius = 2.0f * Spacing;
+			float DX = 0.0f;
+			float DY = 0.0f;
+			bool bInAnnulus = false;
+			for (int32 Draw = 0; Draw < 8 && !bInAnnulus; ++Draw)
+			{
+				DX = (RoomSeed.FRand() * 2.0f - 1.0f) * OuterRadius;
+				DY = (RoomSeed.FRand() * 2.0f - 1.0f) * OuterRadius;
+				const float DistSq = DX * DX + DY * DY;
+				bInAnnulus = DistSq >= Spacing * Spacing && DistSq <= OuterRadius * OuterRadius;
+			}
+			const int32 PosZ = RoomSeed.RandRange(0, FMath::Max(Params.GridSize.Z - Size.Z, 0));
+			if (!bInAnnulus)
+			{
+				continue;
+			}
+
+			const FIntVector Position(
+				FMath::FloorToInt(ParentCenter.X + DX - Size.X * 0.5f),
+				FMath::FloorToInt(ParentCenter.Y + DY - Size.Y * 0.5f),
+				PosZ);
+			bAdded = TryAdd(Position, Size);
+		}
+
+		if (!bAdded)
+		{
+			Active.RemoveAtSwap(ActiveSlot);
+		}
+	}
+
+	if (OutRooms.Num() < Params.RoomCount)
+	{
+		UE_LOG(LogDungeonRooms, Warning,
+			TEXT("Poisson-disk placement stopped at %d/%d rooms (center spacing %.2f)"),
+			OutRooms.Num(), Params.RoomCount, Spacing);
+	}
+
+	UE_LOG(LogDungeonRooms, Log, TEXT("Placed %d/%d rooms"), OutRooms.Num(), Params.RoomCount);
+	return OutRooms.Num() >= 2;
+}
+
+const FDungeonRoom& FRoomPlacement::AddRoom(
+	FDungeonGrid& Grid,
+	const FIntVector& Position,
+	const FIntVector& Size,
+	TArray<FDungeonRoom>& OutRooms)
+{
+	FDungeonRoom& Room = OutRooms.AddDefaulted_GetRef();
+	Room.RoomIndex = static_cast<uint8>(OutRooms.Num());
+	Room.RoomType = EDungeonRoomType::Generic;
+	Room.Position = Position;
+	Room.Size = Size;
+	Room.Center = Position + FIntVector(Size.X / 2, Size.Y / 2, Size.Z / 2);
+	Room.FloorLevel = Position.Z;
+
+	StampRoomToGrid(Grid, Room);
+	return Room;
+}
+
+bool FRoomPlacement::DoesRoomOverlap(
+	const FIntVector& Position,
+	const FIntVector& Size,
+	const TArray<FDungeonRoom>& ExistingRooms,
+	int32 Buffer)
+{
+	for (const FDungeonRoom& Other : ExistingRooms)
+	{
+		if (DoRoomBoxesOverlap(Position, Size, Other, Buffer))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void FRoomPlacement::StampRoomToGrid(FDungeonGrid& Grid, const FDungeonRoom& Room)
+{
+	static const FDungeonCell RoomMask = FDungeonGrid::FieldMask(
+		&FDungeonCell::CellType, &FDungeonCell::RoomIndex, &FDungeonCell::FloorIndex);
+
+	FDungeonCell RoomCell;
+	RoomCell.CellType = EDungeonCellType::Room;
+	RoomCell.RoomIndex = Room.RoomIndex;
+
+	// One slice per floor, since FloorIndex follows Z; FillBox clips each slice to the grid.
+	const int32 MinZ = FMath::Max(Room.Position.Z, 0);
+	const int32 MaxZ = FMath::Min(Room.Position.Z + Room.Size.Z, Grid.GridSize.Z);
+	for (int32 Z = MinZ; Z < MaxZ; ++Z)
+	{
+		RoomCell.FloorIndex = static_cast<uint8>(Z);
+		Grid.FillBox(
+			FIntVector(Room.Position.X, Room.Position.Y, Z),
+			FIntVector(Room.Position.X + Room.Size.X, Room.Position.Y + Room.Size.Y, Z + 1),
+			RoomCell, RoomMask);
 	}
 }
@@ -1,6 +1,6 @@
 // RoomSemantics.cpp — Entrance selection, graph analysis, and room type assignment
 #include "RoomSemantics.h"
-#include "DungeonConfig.h"
+#include "DungeonGenerationParams.h"
 #include "DungeonSeed.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogRoomSemantics, Log, All);
@@ -11,7 +11,7 @@ DEFINE_LOG_CATEGORY_STATIC(LogRoomSemantics, Log, All);
 
 int32 FRoomSemantics::SelectEntranceRoom(
 	const FDungeonResult& Result,
-	const UDungeonConfiguration& Config,
+	const FDungeonGenerationParams& Params,
 	FDungeonSeed& Seed)
 {
 	if (Result.Rooms.Num() == 0)
@@ -25,7 +25,7 @@ int32 FRoomSemantics::SelectEntranceRoom(
 	{
 		const FDungeonRoom& Room = Result.Rooms[i];
 
-		switch (Config.EntrancePlacement)
+		switch (Params.EntrancePlacement)
 		{
 		case EDungeonEntrancePlacement::BoundaryEdge:
 		{
@@ -62,7 +62,7 @@ int32 FRoomSemantics::SelectEntranceRoom(
 	{
 		UE_LOG(LogRoomSemantics, Warning,
 			TEXT("SelectEntranceRoom: No rooms match EntrancePlacement=%d, falling back to all rooms"),
-			static_cast<int32>(Config.EntrancePlacement));
+			static_cast<int32>(Params.EntrancePlacement));
 		for (int32 i = 0; i < Result.Rooms.Num(); ++i)
 		{
 			Candidates.Add(i);
@@ -206,7 +206,7 @@ TArray<FRoomSemanticContext> FRoomSemantics::ComputeGraphMetrics(FDungeonResult&
 
 void FRoomSemantics::AssignRoomTypes(
 	FDungeonResult& Result,
-	const UDungeonConfiguration& Config,
+	const FDungeonGenerationParams& Params,
 	const TArray<FRoomSemanticContext>& Contexts,
 	FDungeonSeed& Seed)
 {
@@ -225,7 +225,7 @@ void FRoomSemantics::AssignRoomTypes(
 	}
 
 	// Sort rules by priority descending (stable sort for determinism)
-	TArray<FDungeonRoomTypeRule> SortedRules = Config.RoomTypeRules;
+	TArray<FDungeonRoomTypeRule> SortedRules = Params.RoomTypeRules;
 	SortedRules.StableSort([](const FDungeonRoomTypeRule& A, const FDungeonRoomTypeRule& B)
 	{
 		return A.Priority > B.Priority;
@@ -332,7 +332,7 @@ void FRoomSemantics::AssignRoomTypes(
 		}
 
 		// Boss guarantee fallback: relax distance constraint if Boss rule failed
-		if (Rule.RoomType == EDungeonRoomType::Boss && Assigned == 0 && Config.bGuaranteeBossRoom)
+		if (Rule.RoomType == EDungeonRoomType::Boss && Assigned == 0 && Params.bGuaranteeBossRoom)
 		{
 			UE_LOG(LogRoomSemantics, Log,
 				TEXT("Boss rule matched 0 rooms with distance filter, relaxing constraints"));
@@ -372,7 +372,7 @@ void FRoomSemantics::AssignRoomTypes(
 	}
 
 	// Global boss guarantee: if no Boss rule existed at all but bGuaranteeBossRoom is true
-	if (Config.bGuaranteeBossRoom && !bBossAssigned)
+	if (Params.bGuaranteeBossRoom && !bBossAssigned)
 	{
 		UE_LOG(LogRoomSemantics, Log,
 			TEXT("No Boss rule in config, auto-assigning farthest main-path room as Boss"));
@@ -0,0 +1,422 @@
+// Test_DelaunayTetrahedralization.cpp — Unit tests for the incremental 3D Delaunay tetrahedralizer
+#include "Misc/AutomationTest.h"
+#include "Algo/Sort.h"
+#include "DelaunayTetrahedralization.h"
+#include "DungeonSeed.h"
+
+// ============================================================================
+// Test Helpers
+// ============================================================================
+
+namespace DelaunayTestHelpers
+{
+	double Orient(const FVector& A, const FVector& B, const FVector& C, const FVector& D)
+	{
+		return FVector::DotProduct(FVector::CrossProduct(B - A, C - A), D - A);
+	}
+
+	double Det3(const FVector& A, const FVector& B, const FVector& C)
+	{
+		return FVector::DotProduct(A, FVector::CrossProduct(B, C));
+	}
+
+	bool InSphere(const TArray<FVector>& Points, const int32 (&Tet)[4], const FVector& P)
+	{
+		const FVector A = Points[Tet[0]] - P;
+		const FVector B = Points[Tet[1]] - P;
+		const FVector C = Points[Tet[2]] - P;
+		const FVector D = Points[Tet[3]] - P;
+		const double Det =
+			  A.SizeSquared() * Det3(B, C, D)
+			- B.SizeSquared() * Det3(A, C, D)
+			+ C.SizeSquared() * Det3(A, B, D)
+			- D.SizeSquared() * Det3(A, B, C);
+		const double Orientation = Orient(Points[Tet[0]], Points[Tet[1]], Points[Tet[2]], Points[Tet[3]]);
+		return Orientation > 0.0 ? Det > 0.0 : (Orientation < 0.0 && Det < 0.0);
+	}
+
+	/**
+	 * Textbook Bowyer-Watson (every tet tested per insertion, boundary faces by counting) over the
+	 * same super-tetrahedron as the real implementation. Unique answer for points in general position.
+	 */
+	void ReferenceTetrahedralize(const TArray<FVector>& Points, TArray<TPair<int32, int32>>& OutEdges)
+	{
+		struct FTet { int32 V[4]; };
+
+		const int32 NumPoints = Points.Num();
+		FVector Min = Points[0];
+		FVector Max = Points[0];
+		for (const FVector& P : Points)
+		{
+			Min = Min.ComponentMin(P);
+			Max = Max.ComponentMax(P);
+		}
+		const FVector Center = (Min + Max) * 0.5f;
+		float Extent = FMath::Max3(Max.X - Min.X, Max.Y - Min.Y, Max.Z - Min.Z);
+		if (Extent < 1.0f) Extent = 100.0f;
+		Extent *= 3.0f;
+
+		TArray<FVector> AllPoints = Points;
+		AllPoints.Add(Center + FVector( Extent,  Extent,  Extent));
+		AllPoints.Add(Center + FVector( Extent, -Extent, -Extent));
+		AllPoints.Add(Center + FVector(-Extent, -Extent,  Extent));
+		AllPoints.Add(Center + FVector(-Extent,  Extent, -Extent));
+
+		TArray<FTet> Tets;
+		Tets.Add({ { NumPoints, NumPoints + 1, NumPoints + 2, NumPoints + 3 } });
+
+		for (int32 PointIdx = 0; PointIdx < NumPoints; ++PointIdx)
+		{
+			TMap<FIntVector, int32> FaceCount;
+			for (int32 t = Tets.Num() - 1; t >= 0; --t)
+			{
+				if (!InSphere(AllPoints, Tets[t].V, AllPoints[PointIdx]))
+				{
+					continue;
+				}
+				const int32* V = Tets[t].V;
+				const int32 Faces[4][3] = { { V[0], V[1], V[2] }, { V[0], V[1], V[3] }, { V[0], V[2], V[3] }, { V[1], V[2], V[3] } };
+				for (const auto& Face : Faces)
+				{
+					int32 Sorted[3] = { Face[0], Face[1], Face[2] };
+					Algo::Sort(Sorted);
+					++FaceCount.FindOrAdd(FIntVector(Sorted[0], Sorted[1], Sorted[2]), 0);
+				}
+				Tets.RemoveAtSwap(t);
+			}
+
+			for (const auto& Pair : FaceCount)
+			{
+				if (Pair.Value == 1)
+				{
+					Tets.Add({ { Pair.Key.X, Pair.Key.Y, Pair.Key.Z, PointIdx } });
+				}
+			}
+		}
+
+		TSet<TPair<int32, int32>> Unique;
+		for (const FTet& Tet : Tets)
+		{
+			for (int32 i = 0; i < 4; ++i)
+			{
+				for (int32 j = i + 1; j < 4; ++j)
+				{
+					if (Tet.V[i] < NumPoints && Tet.V[j] < NumPoints)
+					{
+						Unique.Add(TPair<int32, int32>(FMath::Min(Tet.V[i], Tet.V[j]), FMath::Max(Tet.V[i], Tet.V[j])));
+					}
+				}
+			}
+		}
+		OutEdges = Unique.Array();
+		OutEdges.Sort([](const TPair<int32, int32>& A, const TPair<int32, int32>& B)
+		{
+			return A.Key < B.Key || (A.Key == B.Key && A.Value < B.Value);
+		});
+	}
+
+	/** True if every point is reachable from point 0 over Edges. */
+	bool IsConnected(int32 NumPoints, const TArray<TPair<int32, int32>>& Edges)
+	{
+		TArray<int32> Parent;
+		Parent.SetNum(NumPoints);
+		for (int32 i = 0; i < NumPoints; ++i)
+		{
+			Parent[i] = i;
+		}
+		auto Find = [&Parent](int32 X)
+		{
+			while (Parent[X] != X)
+			{
+				X = Parent[X] = Parent[Parent[X]];
+			}
+			return X;
+		};
+
+		int32 Components = NumPoints;
+		for (const auto& Edge : Edges)
+		{
+			const int32 A = Find(Edge.Key);
+			const int32 B = Find(Edge.Value);
+			if (A != B)
+			{
+				Parent[A] = B;
+				--Components;
+			}
+		}
+		return Components == 1;
+	}
+
+	/**
+	 * GMalloc proxy that counts the allocations made by one thread while active. Everything is
+	 * forwarded to the allocator it wraps, so blocks may cross the install/uninstall boundary.
+	 */
+	class FCountingMalloc final : public FMalloc
+	{
+	public:
+		/** Wrap InInner and count allocations from the calling thread, starting from zero. */
+		void Install(FMalloc* InInner)
+		{
+			Inner = InInner;
+			ThreadId = FPlatformTLS::GetCurrentThreadId();
+			Count = 0;
+		}
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			CountIfActive();
+			return Inner->Malloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			CountIfActive();
+			return Inner->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override { Inner->Free(Original); }
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+		virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+		virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+		virtual const TCHAR* GetDescriptiveName() override { return TEXT("DungeonCountingMalloc"); }
+
+		bool bActive = false;
+		int32 Count = 0;
+
+	private:
+		void CountIfActive()
+		{
+			if (bActive && FPlatformTLS::GetCurrentThreadId() == ThreadId)
+			{
+				++Count;
+			}
+		}
+
+		FMalloc* Inner = nullptr;
+		uint32 ThreadId = 0;
+	};
+}
+
+// ============================================================================
+// Walk-based insertion finds the same mesh as textbook Bowyer-Watson
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDelaunayMatchesReference, "Dungeon.Delaunay.Tetrahedralize.MatchesBowyerWatsonReference",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDelaunayMatchesReference::RunTest(const FString& Parameters)
+{
+	FDungeonSeed Rng(31337);
+	int32 Mismatches = 0;
+	for (int32 Trial = 0; Trial < 40; ++Trial)
+	{
+		// Continuous coordinates: general position, so the Delaunay mesh is unique
+		const int32 NumPoints = Rng.RandRange(4, 80);
+		TArray<FVector> Points;
+		for (int32 i = 0; i < NumPoints; ++i)
+		{
+			Points.Add(FVector(Rng.FRand() * 60.0f, Rng.FRand() * 60.0f, Rng.FRand() * 12.0f));
+		}
+
+		TArray<TPair<int32, int32>> Edges;
+		TArray<TPair<int32, int32>> Expected;
+		FDelaunayTetrahedralization::Tetrahedralize(Points, Edges);
+		DelaunayTestHelpers::ReferenceTetrahedralize(Points, Expected);
+		if (Edges != Expected)
+		{
+			++Mismatches;
+			AddError(FString::Printf(TEXT("Trial %d (%d points): %d edges, reference %d"),
+				Trial, NumPoints, Edges.Num(), Expected.Num()));
+		}
+	}
+	TestEqual(TEXT("Edge sets differing from the reference"), Mismatches, 0);
+	return true;
+}
+
+// ============================================================================
+// Grid-snapped centers (many cospherical quadruples) still give a connected, clean edge list
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDelaunayGridAligned, "Dungeon.Delaunay.Tetrahedralize.GridAlignedConnected",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDelaunayGridAligned::RunTest(const FString& Parameters)
+{
+	FDungeonSeed Rng(4242);
+	for (int32 Trial = 0; Trial < 20; ++Trial)
+	{
+		const int32 NumPoints = Rng.RandRange(4, 255);
+		TSet<FIntVector> Unique;
+		TArray<FVector> Points;
+		while (Points.Num() < NumPoints)
+		{
+			const FIntVector Cell(Rng.RandRange(0, 40), Rng.RandRange(0, 40), Rng.RandRange(0, 4));
+			if (!Unique.Contains(Cell))
+			{
+				Unique.Add(Cell);
+				Points.Add(FVector(Cell));
+			}
+		}
+
+		TArray<TPair<int32, int32>> Edges;
+		FDelaunayTetrahedralization::Tetrahedralize(Points, Edges);
+
+		bool bSortedAndValid = true;
+		for (int32 i = 0; i < Edges.Num(); ++i)
+		{
+			const TPair<int32, int32>& Edge = Edges[i];
+			bSortedAndValid &= Edge.Key >= 0 && Edge.Key < Edge.Value && Edge.Value < NumPoints;
+			if (i > 0)
+			{
+				const TPair<int32, int32>& Prev = Edges[i - 1];
+				bSortedAndValid &= Prev.Key < Edge.Key || (Prev.Key == Edge.Key && Prev.Value < Edge.Value);
+			}
+		}
+		TestTrue(FString::Printf(TEXT("Trial %d: edges sorted, unique and in range"), Trial), bSortedAndValid);
+		TestTrue(FString::Printf(TEXT("Trial %d: %d points connected"), Trial, NumPoints),
+			DelaunayTestHelpers::IsConnected(NumPoints, Edges));
+
+		TArray<TPair<int32, int32>> Again;
+		FDelaunayTetrahedralization::Tetrahedralize(Points, Again);
+		TestTrue(FString::Printf(TEXT("Trial %d: deterministic"), Trial), Again == Edges);
+	}
+	return true;
+}
+
+// ============================================================================
+// Benchmark: walk-based insertion vs textbook Bowyer-Watson as the point count grows
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDelaunayBenchmark, "Dungeon.Delaunay.Benchmark.TetrahedralizeVsReference",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FDelaunayBenchmark::RunTest(const FString& Parameters)
+{
+	const int32 Counts[] = { 64, 255, 1000, 4000 };
+	for (const int32 NumPoints : Counts)
+	{
+		FDungeonSeed Rng(NumPoints);
+		TArray<FVector> Points;
+		for (int32 i = 0; i < NumPoints; ++i)
+		{
+			Points.Add(FVector(Rng.FRand() * 400.0f, Rng.FRand() * 400.0f, Rng.FRand() * 40.0f));
+		}
+
+		TArray<TPair<int32, int32>> Edges;
+		const double FastStart = FPlatformTime::Seconds();
+		FDelaunayTetrahedralization::Tetrahedralize(Points, Edges);
+		const double FastMs = (FPlatformTime::Seconds() - FastStart) * 1000.0;
+		AddInfo(FString::Printf(TEXT("%5d points: walk %.2fms (%d edges)"), NumPoints, FastMs, Edges.Num()));
+
+		// The quadratic reference gets slow fast; only run it where it finishes in reasonable time
+		if (NumPoints <= 1000)
+		{
+			TArray<TPair<int32, int32>> Expected;
+			const double RefStart = FPlatformTime::Seconds();
+			DelaunayTestHelpers::ReferenceTetrahedralize(Points, Expected);
+			const double RefMs = (FPlatformTime::Seconds() - RefStart) * 1000.0;
+			TestTrue(FString::Printf(TEXT("%d points match the reference"), NumPoints), Edges == Expected);
+			AddInfo(FString::Printf(TEXT("%5d points: reference %.2fms"), NumPoints, RefMs));
+		}
+	}
+	return true;
+}
+
+// ============================================================================
+// Single-floor centers go in as they are (no jitter): every point stays connected
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDelaunayCoplanar, "Dungeon.Delaunay.Tetrahedralize.CoplanarWithoutJitter",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDelaunayCoplanar::RunTest(const FString& Parameters)
+{
+	// A full lattice is as cocircular as inputs get
+	TArray<FVector> Lattice;
+	for (int32 Y = 0; Y < 6; ++Y)
+	{
+		for (int32 X = 0; X < 6; ++X)
+		{
+			Lattice.Add(FVector(X * 4, Y * 4, 2));
+		}
+	}
+
+	TArray<TPair<int32, int32>> Edges;
+	FDelaunayTetrahedralization::Tetrahedralize(Lattice, Edges);
+	TestTrue(TEXT("Lattice connected"), DelaunayTestHelpers::IsConnected(Lattice.Num(), Edges));
+
+	// Each lattice neighbor pair is a Delaunay edge under any tie-break
+	int32 MissingNeighbors = 0;
+	for (int32 i = 0; i < Lattice.Num(); ++i)
+	{
+		if (i % 6 < 5)
+		{
+			MissingNeighbors += Edges.Contains(TPair<int32, int32>(i, i + 1)) ? 0 : 1;
+		}
+		if (i + 6 < Lattice.Num())
+		{
+			MissingNeighbors += Edges.Contains(TPair<int32, int32>(i, i + 6)) ? 0 : 1;
+		}
+	}
+	TestEqual(TEXT("Lattice neighbors missing an edge"), MissingNeighbors, 0);
+
+	FDungeonSeed Rng(8);
+	for (int32 Trial = 0; Trial < 10; ++Trial)
+	{
+		TSet<FIntPoint> Unique;
+		TArray<FVector> Points;
+		const int32 NumPoints = Rng.RandRange(4, 120);
+		while (Points.Num() < NumPoints)
+		{
+			const FIntPoint Cell(Rng.RandRange(0, 30), Rng.RandRange(0, 30));
+			if (!Unique.Contains(Cell))
+			{
+				Unique.Add(Cell);
+				Points.Add(FVector(Cell.X, Cell.Y, 0.0));
+			}
+		}
+
+		FDelaunayTetrahedralization::Tetrahedralize(Points, Edges);
+		TestTrue(FString::Printf(TEXT("Trial %d: %d coplanar points connected"), Trial, NumPoints),
+			DelaunayTestHelpers::IsConnected(NumPoints, Edges));
+	}
+	return true;
+}
+
+// ============================================================================
+// Allocation count per call stays flat as the point count grows
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDelaunayAllocations, "Dungeon.Delaunay.Benchmark.AllocationsPerCall",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FDelaunayAllocations::RunTest(const FString& Parameters)
+{
+	const int32 Counts[] = { 255, 1000, 4000 };
+	for (const int32 NumPoints : Counts)
+	{
+		FDungeonSeed Rng(NumPoints);
+		TArray<FVector> Points;
+		for (int32 i = 0; i < NumPoints; ++i)
+		{
+			Points.Add(FVector(Rng.RandRange(0, 400), Rng.RandRange(0, 400), Rng.RandRange(0, 8)));
+		}
+
+		// Warm-up call sizes OutEdges and the thread's FMemStack pages, as earlier generations would
+		TArray<TPair<int32, int32>> Edges;
+		FDelaunayTetrahedralization::Tetrahedralize(Points, Edges);
+
+		// Never destroyed: another thread may still be inside it when GMalloc is restored
+		static DelaunayTestHelpers::FCountingMalloc* Counter = new DelaunayTestHelpers::FCountingMalloc();
+		FMalloc* const Previous = GMalloc;
+		Counter->Install(Previous);
+		GMalloc = Counter;
+		Counter->bActive = true;
+		const double Start = FPlatformTime::Seconds();
+		FDelaunayTetrahedralization::Tetrahedralize(Points, Edges);
+		const double Ms = (FPlatformTime::Seconds() - Start) * 1000.0;
+		Counter->bActive = false;
+		GMalloc = Previous;
+
+		// Only the up-front reservations too large for a stack page reach the heap, once per call
+		AddInfo(FString::Printf(TEXT("%5d points: %d heap allocations, %.2fms"), NumPoints, Counter->Count, Ms));
+		TestTrue(FString::Printf(TEXT("%d points: allocations per call bounded"), NumPoints), Counter->Count <= 32);
+	}
+	return true;
+}
@@ -0,0 +1,238 @@
+// Test_DelaunayTriangulation.cpp — Unit tests for the incremental 2D Delaunay triangulator
+#include "Misc/AutomationTest.h"
+#include "DelaunayTriangulation.h"
+#include "DungeonSeed.h"
+
+// ============================================================================
+// Test Helpers
+// ============================================================================
+
+namespace DelaunayTriangulationTestHelpers
+{
+	/**
+	 * Textbook Bowyer-Watson (every triangle tested per insertion, boundary edges by counting) over
+	 * the same super-triangle as the real implementation. Unique answer for points in general position.
+	 */
+	void ReferenceTriangulate(const TArray<FVector2D>& Points, TArray<TPair<int32, int32>>& OutEdges)
+	{
+		struct FTri { int32 V[3]; };
+
+		const int32 NumPoints = Points.Num();
+		FVector2D Min = Points[0];
+		FVector2D Max = Points[0];
+		for (const FVector2D& P : Points)
+		{
+			Min = FVector2D::Min(Min, P);
+			Max = FVector2D::Max(Max, P);
+		}
+		double DeltaMax = FMath::Max(Max.X - Min.X, Max.Y - Min.Y);
+		if (DeltaMax < 1.0) DeltaMax = 100.0;
+		const FVector2D Mid = (Min + Max) * 0.5;
+
+		TArray<FVector2D> AllPoints = Points;
+		AllPoints.Add(FVector2D(Mid.X - 2.0 * DeltaMax, Mid.Y - DeltaMax));
+		AllPoints.Add(FVector2D(Mid.X + 2.0 * DeltaMax, Mid.Y - DeltaMax));
+		AllPoints.Add(FVector2D(Mid.X, Mid.Y + 2.0 * DeltaMax));
+
+		TArray<FTri> Tris;
+		Tris.Add({ { NumPoints, NumPoints + 1, NumPoints + 2 } });
+
+		for (int32 PointIdx = 0; PointIdx < NumPoints; ++PointIdx)
+		{
+			const FVector2D& P = AllPoints[PointIdx];
+			TMap<FIntPoint, int32> EdgeCount;
+			for (int32 t = Tris.Num() - 1; t >= 0; --t)
+			{
+				const FVector2D A = AllPoints[Tris[t].V[0]] - P;
+				const FVector2D B = AllPoints[Tris[t].V[1]] - P;
+				const FVector2D C = AllPoints[Tris[t].V[2]] - P;
+				const double Det =
+					  A.SizeSquared() * (B.X * C.Y - C.X * B.Y)
+					+ B.SizeSquared() * (C.X * A.Y - A.X * C.Y)
+					+ C.SizeSquared() * (A.X * B.Y - B.X * A.Y);
+				const double Orientation = FVector2D::CrossProduct(B - A, C - A);
+				if (!(Orientation > 0.0 ? Det > 0.0 : (Orientation < 0.0 && Det < 0.0)))
+				{
+					continue;
+				}
+
+				const int32* V = Tris[t].V;
+				for (int32 i = 0; i < 3; ++i)
+				{
+					const int32 U = V[i];
+					const int32 W = V[(i + 1) % 3];
+					++EdgeCount.FindOrAdd(FIntPoint(FMath::Min(U, W), FMath::Max(U, W)), 0);
+				}
+				Tris.RemoveAtSwap(t);
+			}
+
+			for (const auto& Pair : EdgeCount)
+			{
+				if (Pair.Value == 1)
+				{
+					Tris.Add({ { Pair.Key.X, Pair.Key.Y, PointIdx } });
+				}
+			}
+		}
+
+		TSet<TPair<int32, int32>> Unique;
+		for (const FTri& Tri : Tris)
+		{
+			for (int32 i = 0; i < 3; ++i)
+			{
+				const int32 U = Tri.V[i];
+				const int32 W = Tri.V[(i + 1) % 3];
+				if (U < NumPoints && W < NumPoints)
+				{
+					Unique.Add(TPair<int32, int32>(FMath::Min(U, W), FMath::Max(U, W)));
+				}
+			}
+		}
+		OutEdges = Unique.Array();
+		OutEdges.Sort([](const TPair<int32, int32>& A, const TPair<int32, int32>& B)
+		{
+			return A.Key < B.Key || (A.Key == B.Key && A.Value < B.Value);
+		});
+	}
+
+	/** True if every point is reachable from point 0 over Edges. */
+	bool IsConnected(int32 NumPoints, const TArray<TPair<int32, int32>>& Edges)
+	{
+		TArray<TArray<int32>> Adjacency;
+		Adjacency.SetNum(NumPoints);
+		for (const auto& Edge : Edges)
+		{
+			Adjacency[Edge.Key].Add(Edge.Value);
+			Adjacency[Edge.Value].Add(Edge.Key);
+		}
+
+		TArray<bool> Visited;
+		Visited.Init(false, NumPoints);
+		TArray<int32> Stack = { 0 };
+		Visited[0] = true;
+		int32 Reached = 1;
+		while (Stack.Num() > 0)
+		{
+			for (const int32 Next : Adjacency[Stack.Pop()])
+			{
+				if (!Visited[Next])
+				{
+					Visited[Next] = true;
+					Stack.Add(Next);
+					++Reached;
+				}
+			}
+		}
+		return Reached == NumPoints;
+	}
+}
+
+// ============================================================================
+// Walk-based insertion finds the same mesh as textbook Bowyer-Watson
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDelaunayTriangulationMatchesReference, "Dungeon.Delaunay.Triangulate.MatchesBowyerWatsonReference",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDelaunayTriangulationMatchesReference::RunTest(const FString& Parameters)
+{
+	FDungeonSeed Rng(2024);
+	int32 Mismatches = 0;
+	for (int32 Trial = 0; Trial < 40; ++Trial)
+	{
+		// Continuous coordinates: general position, so the Delaunay mesh is unique
+		const int32 NumPoints = Rng.RandRange(3, 150);
+		TArray<FVector2D> Points;
+		for (int32 i = 0; i < NumPoints; ++i)
+		{
+			Points.Add(FVector2D(Rng.FRand() * 60.0f, Rng.FRand() * 60.0f));
+		}
+
+		TArray<TPair<int32, int32>> Edges;
+		TArray<TPair<int32, int32>> Expected;
+		FDelaunayTriangulation::Triangulate(Points, Edges);
+		DelaunayTriangulationTestHelpers::ReferenceTriangulate(Points, Expected);
+		if (Edges != Expected)
+		{
+			++Mismatches;
+			AddError(FString::Printf(TEXT("Trial %d (%d points): %d edges, reference %d"),
+				Trial, NumPoints, Edges.Num(), Expected.Num()));
+		}
+	}
+	TestEqual(TEXT("Edge sets differing from the reference"), Mismatches, 0);
+	return true;
+}
+
+// ============================================================================
+// Lattice, grid-snapped and collinear centers stay connected
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDelaunayTriangulationDegenerate, "Dungeon.Delaunay.Triangulate.DegenerateInputsConnected",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDelaunayTriangulationDegenerate::RunTest(const FString& Parameters)
+{
+	using namespace DelaunayTriangulationTestHelpers;
+
+	// A full lattice: every cell's four corners are cocircular
+	TArray<FVector2D> Lattice;
+	for (int32 Y = 0; Y < 8; ++Y)
+	{
+		for (int32 X = 0; X < 8; ++X)
+		{
+			Lattice.Add(FVector2D(X * 5, Y * 5));
+		}
+	}
+
+	TArray<TPair<int32, int32>> Edges;
+	FDelaunayTriangulation::Triangulate(Lattice, Edges);
+	TestTrue(TEXT("Lattice connected"), IsConnected(Lattice.Num(), Edges));
+
+	int32 MissingNeighbors = 0;
+	for (int32 i = 0; i < Lattice.Num(); ++i)
+	{
+		if (i % 8 < 7)
+		{
+			MissingNeighbors += Edges.Contains(TPair<int32, int32>(i, i + 1)) ? 0 : 1;
+		}
+		if (i + 8 < Lattice.Num())
+		{
+			MissingNeighbors += Edges.Contains(TPair<int32, int32>(i, i + 8)) ? 0 : 1;
+		}
+	}
+	TestEqual(TEXT("Lattice neighbors missing an edge"), MissingNeighbors, 0);
+
+	// Every point on one line: exactly the chain of consecutive points
+	TArray<FVector2D> Line;
+	for (int32 i = 0; i < 12; ++i)
+	{
+		Line.Add(FVector2D(7 + i * 3, 4 + i * 2));
+	}
+	FDelaunayTriangulation::Triangulate(Line, Edges);
+	TestEqual(TEXT("Collinear points give a chain"), Edges.Num(), Line.Num() - 1);
+	TestTrue(TEXT("Collinear points connected"), IsConnected(Line.Num(), Edges));
+
+	FDungeonSeed Rng(99);
+	for (int32 Trial = 0; Trial < 20; ++Trial)
+	{
+		TSet<FIntPoint> Unique;
+		TArray<FVector2D> Points;
+		const int32 NumPoints = Rng.RandRange(3, 255);
+		while (Points.Num() < NumPoints)
+		{
+			const FIntPoint Cell(Rng.RandRange(0, 40), Rng.RandRange(0, 40));
+			if (!Unique.Contains(Cell))
+			{
+				Unique.Add(Cell);
+				Points.Add(FVector2D(Cell.X, Cell.Y));
+			}
+		}
+
+		FDelaunayTriangulation::Triangulate(Points, Edges);
+		TestTrue(FString::Printf(TEXT("Trial %d: %d grid-snapped points connected"), Trial, NumPoints),
+			IsConnected(NumPoints, Edges));
+
+		TArray<TPair<int32, int32>> Again;
+		FDelaunayTriangulation::Triangulate(Points, Again);
+		TestTrue(FString::Printf(TEXT("Trial %d: deterministic"), Trial), Again == Edges);
+	}
+	return true;
+}
@@ -2,8 +2,10 @@
 #include "Misc/AutomationTest.h"
 #include "DungeonTypes.h"
 #include "DungeonConfig.h"
+#include "DungeonGenerationParams.h"
 #include "DungeonGenerator.h"
 #include "DungeonValidator.h"
+#include "Async/TaskGraphInterfaces.h"
 
 // ============================================================================
 // Test Helpers
@@ -121,7 +123,7 @@ bool FDungeonGenValidateSingleFloor::RunTest(const FString& Parameters)
 	FDungeonResult Result = Generator->Generate(Config, 42);
 	TestTrue(TEXT("Generation produced rooms"), Result.Rooms.Num() >= 2);
 
-	FDungeonValidationResult Validation = FDungeonValidator::ValidateAll(Result, *Config);
+	FDungeonValidationResult Validation = FDungeonValidator::ValidateAll(Result, FDungeonGenerationParams::FromConfig(*Config));
 	if (!Validation.bPassed)
 	{
 		AddError(FString::Printf(TEXT("Validation failed: %s"), *Validation.GetSummary()));
@@ -145,7 +147,7 @@ bool FDungeonGenValidateMultiFloor::RunTest(const FString& Parameters)
 	FDungeonResult Result = Generator->Generate(Config, 42);
 	TestTrue(TEXT("Generation produced rooms"), Result.Rooms.Num() >= 2);
 
-	FDungeonValidationResult Validation = FDungeonValidator::ValidateAll(Result, *Config);
+	FDungeonValidationResult Validation = FDungeonValidator::ValidateAll(Result, FDungeonGenerationParams::FromConfig(*Config));
 	if (!Validation.bPassed)
 	{
 		AddError(FString::Printf(TEXT("Validation failed: %s"), *Validation.GetSummary()));
@@ -176,7 +178,7 @@ bool FDungeonGenValidateLargeGrid::RunTest(const FString& Parameters)
 	FDungeonResult Result = Generator->Generate(Config, 99);
 	TestTrue(TEXT("Generation produced rooms"), Result.Rooms.Num() >= 2);
 
-	FDungeonValidationResult Validation = FDungeonValidator::ValidateAll(Result, *Config);
+	FDungeonValidationResult Validation = FDungeonValidator::ValidateAll(Result, FDungeonGenerationParams::FromConfig(*Config));
 	if (!Validation.bPassed)
 	{
 		AddError(FString::Printf(TEXT("Validation failed: %s"), *Validation.GetSummary()));
@@ -207,7 +209,7 @@ bool FDungeonGenValidateMinimalRooms::RunTest(const FString& Parameters)
 	FDungeonResult Result = Generator->Generate(Config, 55);
 	TestEqual(TEXT("Exactly 2 rooms placed"), Result.Rooms.Num(), 2);
 
-	FDungeonValidationResult Validation = FDungeonValidator::ValidateAll(Result, *Config);
+	FDungeonValidationResult Validation = FDungeonValidator::ValidateAll(Result, FDungeonGenerationParams::FromConfig(*Config));
 	if (!Validation.bPassed)
 	{
 		AddError(FString::Printf(TEXT("Validation failed: %s"), *Validation.GetSummary()));
@@ -304,6 +306,178 @@ bool FDungeonGenSeedZeroValid::RunTest(const FString& Parameters)
 	return true;
 }
 
+// ============================================================================
+// ASYNC TESTS
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDungeonGenAsyncMatchesSync, "Dungeon.Generation.Async.MatchesSync",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDungeonGenAsyncMatchesSync::RunTest(const FString& Parameters)
+{
+	UDungeonConfiguration* Config = DungeonGenerationTestHelpers::CreateMultiFloorConfig();
+	UDungeonGenerator* Generator = NewObject<UDungeonGenerator>();
+	Generator->AddToRoot();
+
+	FDungeonResult SyncResult = Generator->Generate(Config, 42);
+
+	TSharedPtr<FDungeonGenerationProgress> Progress = MakeShared<FDungeonGenerationProgress>();
+	FDungeonResult AsyncResult = UDungeonGenerator::GenerateAsync(Config, 42, Progress).Get();
+
+	TestTrue(TEXT("Async result identical to sync result"),
+		DungeonGenerationTestHelpers::AreDungeonResultsIdentical(SyncResult, AsyncResult));
+	TestTrue(TEXT("Progress reports Complete"), Progress->GetStage() == EDungeonGenerationStage::Complete);
+	TestFalse(TEXT("Not cancelled"), Progress->WasCancelled());
+
+	Generator->RemoveFromRoot();
+	DungeonGenerationTestHelpers::CleanupConfig(Config);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDungeonGenAsyncCancel, "Dungeon.Generation.Async.CancelReturnsEmptyResult",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDungeonGenAsyncCancel::RunTest(const FString& Parameters)
+{
+	UDungeonConfiguration* Config = DungeonGenerationTestHelpers::CreateDefaultConfig();
+
+	// Cancel before launch so the first checkpoint is guaranteed to observe it
+	TSharedPtr<FDungeonGenerationProgress> Progress = MakeShared<FDungeonGenerationProgress>();
+	Progress->Cancel();
+
+	FDungeonResult Result = UDungeonGenerator::GenerateAsync(Config, 42, Progress).Get();
+
+	TestTrue(TEXT("Progress reports cancelled"), Progress->WasCancelled());
+	TestEqual(TEXT("Cancelled result has no rooms"), Result.Rooms.Num(), 0);
+	TestEqual(TEXT("Cancelled result has no hallways"), Result.Hallways.Num(), 0);
+
+	DungeonGenerationTestHelpers::CleanupConfig(Config);
+	return true;
+}
+
+// ============================================================================
+// PARAMS ENTRY POINT TESTS
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDungeonGenFromParamsMatchesSync, "Dungeon.Generation.Params.MatchesSync",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDungeonGenFromParamsMatchesSync::RunTest(const FString& Parameters)
+{
+	UDungeonConfiguration* Config = DungeonGenerationTestHelpers::CreateMultiFloorConfig();
+	UDungeonGenerator* Generator = NewObject<UDungeonGenerator>();
+	Generator->AddToRoot();
+
+	const FDungeonGenerationParams Params = FDungeonGenerationParams::FromConfig(*Config);
+	FDungeonResult SyncResult = Generator->Generate(Config, 42);
+	FDungeonResult ParamsResult = UDungeonGenerator::GenerateFromParams(Params, 42);
+
+	TestTrue(TEXT("Params result identical to sync result"),
+		DungeonGenerationTestHelpers::AreDungeonResultsIdentical(SyncResult, ParamsResult));
+	TestEqual(TEXT("Result carries params hash"), SyncResult.ParamsHash, Params.GetStableHash());
+	TestEqual(TEXT("Both entry points record the same hash"), ParamsResult.ParamsHash, SyncResult.ParamsHash);
+
+	Generator->RemoveFromRoot();
+	DungeonGenerationTestHelpers::CleanupConfig(Config);
+	return true;
+}
+
+// ============================================================================
+// BATCH TESTS
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDungeonGenBatchMatchesSync, "Dungeon.Generation.Batch.MatchesSyncInSeedOrder",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDungeonGenBatchMatchesSync::RunTest(const FString& Parameters)
+{
+	UDungeonConfiguration* Config = DungeonGenerationTestHelpers::CreateDefaultConfig();
+	UDungeonGenerator* Generator = NewObject<UDungeonGenerator>();
+	Generator->AddToRoot();
+
+	const TArray<int64> Seeds = { 7, 42, 1001, 12345, 99, 3 };
+
+	FDungeonBatchStats Stats;
+	TArray<FDungeonResult> Batch = UDungeonGenerator::GenerateBatch(Config, Seeds, &Stats);
+
+	TestEqual(TEXT("One result per seed"), Batch.Num(), Seeds.Num());
+	TestEqual(TEXT("Stats count matches"), Stats.DungeonCount, Seeds.Num());
+	TestTrue(TEXT("Throughput reported"), Stats.DungeonsPerSecond > 0.0);
+
+	for (int32 i = 0; i < Seeds.Num() && i < Batch.Num(); ++i)
+	{
+		TestEqual(FString::Printf(TEXT("Result %d carries its seed"), i), Batch[i].Seed, Seeds[i]);
+
+		FDungeonResult Reference = Generator->Generate(Config, Seeds[i]);
+		TestTrue(FString::Printf(TEXT("Batch result %d identical to sync result"), i),
+			DungeonGenerationTestHelpers::AreDungeonResultsIdentical(Reference, Batch[i]));
+	}
+
+	Generator->RemoveFromRoot();
+	DungeonGenerationTestHelpers::CleanupConfig(Config);
+	return true;
+}
+
+// ============================================================================
+// TIMING TESTS
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDungeonGenStageTimings, "Dungeon.Generation.Timing.StageBreakdownConsistent",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDungeonGenStageTimings::RunTest(const FString& Parameters)
+{
+	UDungeonConfiguration* Config = DungeonGenerationTestHelpers::CreateMultiFloorConfig();
+	UDungeonGenerator* Generator = NewObject<UDungeonGenerator>();
+	Generator->AddToRoot();
+
+	FDungeonResult Result = Generator->Generate(Config, 42);
+	const FDungeonStageTimings& Timings = Result.StageTimings;
+
+	TestTrue(TEXT("Placement timed"), Timings.RoomPlacementMs >= 0.0);
+	TestTrue(TEXT("Carving timed"), Timings.HallwayCarvingMs > 0.0);
+	TestTrue(TEXT("Stage total positive"), Timings.GetTotalMs() > 0.0);
+	TestTrue(TEXT("Stages fit inside total generation time"),
+		Timings.GetTotalMs() <= Result.GenerationTimeMs + KINDA_SMALL_NUMBER);
+
+	Generator->RemoveFromRoot();
+	DungeonGenerationTestHelpers::CleanupConfig(Config);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDungeonGenPathfindStats, "Dungeon.Generation.Timing.PathfindStatsPerEdge",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDungeonGenPathfindStats::RunTest(const FString& Parameters)
+{
+	UDungeonConfiguration* Config = DungeonGenerationTestHelpers::CreateMultiFloorConfig();
+	UDungeonGenerator* Generator = NewObject<UDungeonGenerator>();
+	Generator->AddToRoot();
+
+	FDungeonResult Result = Generator->Generate(Config, 42);
+
+	TestEqual(TEXT("One stats entry per final edge"), Result.PathfindStats.Num(), Result.FinalEdges.Num());
+
+	int32 FoundCount = 0;
+	int32 SummedPops = 0;
+	for (const FPathfindStats& Stats : Result.PathfindStats)
+	{
+		TestTrue(TEXT("Pops never exceed pushes"), Stats.NodesPopped <= Stats.NodesPushed);
+		TestTrue(TEXT("Stale pops are a subset of pops"), Stats.StalePops <= Stats.NodesPopped);
+		TestTrue(TEXT("Rejections are a subset of probes"), Stats.StaircaseRejections <= Stats.StaircaseProbes);
+		FoundCount += Stats.bFoundPath ? 1 : 0;
+		SummedPops += Stats.NodesPopped;
+	}
+
+	TestEqual(TEXT("Found paths match carved hallways"), FoundCount, Result.Hallways.Num());
+	TestEqual(TEXT("Totals aggregate per-edge stats"), Result.PathfindTotals.NodesPopped, SummedPops);
+	TestTrue(TEXT("Multi-floor search probed staircases"), Result.PathfindTotals.StaircaseProbes > 0);
+
+	Generator->RemoveFromRoot();
+	DungeonGenerationTestHelpers::CleanupConfig(Config);
+	return true;
+}
+
 // ============================================================================
 // STRUCTURE TESTS
 // ============================================================================
@@ -418,7 +592,7 @@ bool FDungeonGenStress20Seeds::RunTest(const FString& Parameters)
 			continue;
 		}
 
-		FDungeonValidationResult Validation = FDungeonValidator::ValidateAll(Result, *Config);
+		FDungeonValidationResult Validation = FDungeonValidator::ValidateAll(Result, FDungeonGenerationParams::FromConfig(*Config));
 		if (Validation.bPassed)
 		{
 			PassCount++;
@@ -455,7 +629,7 @@ bool FDungeonGenStressTightGrid::RunTest(const FString& Parameters)
 	FDungeonResult Result = Generator->Generate(Config, 42);
 	TestTrue(TEXT("Tight grid produces rooms"), Result.Rooms.Num() >= 2);
 
-	FDungeonValidationResult Validation = FDungeonValidator::ValidateAll(Result, *Config);
+	FDungeonValidationResult Validation = FDungeonValidator::ValidateAll(Result, FDungeonGenerationParams::FromConfig(*Config));
 	if (!Validation.bPassed)
 	{
 		AddWarning(FString::Printf(TEXT("Tight grid validation: %s"), *Validation.GetSummary()));
@@ -467,3 +641,257 @@ bool FDungeonGenStressTightGrid::RunTest(const FString& Parameters)
 	DungeonGenerationTestHelpers::CleanupConfig(Config);
 	return true;
 }
+
+// ============================================================================
+// Multi-goal hallway search
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDungeonGenMultiGoalHallways, "Dungeon.Generation.Validation.MultiGoalHallwaysPass",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDungeonGenMultiGoalHallways::RunTest(const FString& Parameters)
+{
+	UDungeonConfiguration* Config = DungeonGenerationTestHelpers::CreateMultiFloorConfig();
+	Config->bMultiGoalHallwaySearch = true;
+	const FDungeonGenerationParams Params = FDungeonGenerationParams::FromConfig(*Config);
+
+	int32 PassCount = 0;
+	for (int64 Seed = 1; Seed <= 10; ++Seed)
+	{
+		const FDungeonResult Result = UDungeonGenerator::GenerateFromParams(Params, Seed);
+		if (FDungeonValidator::ValidateAll(Result, Params).bPassed)
+		{
+			PassCount++;
+		}
+
+		// Paths run between the rooms' edges, so both ends sit on a cell of the room they connect
+		for (const FDungeonHallway& Hallway : Result.Hallways)
+		{
+			const FDungeonCell& First = Result.Grid.GetCell(Hallway.PathCells[0]);
+			const FDungeonCell& Last = Result.Grid.GetCell(Hallway.PathCells.Last());
+			TestEqual(FString::Printf(TEXT("Seed %lld hallway %d starts in room A"), Seed, Hallway.HallwayIndex),
+				First.RoomIndex, Result.Rooms[Hallway.RoomA].RoomIndex);
+			TestEqual(FString::Printf(TEXT("Seed %lld hallway %d ends in room B"), Seed, Hallway.HallwayIndex),
+				Last.RoomIndex, Result.Rooms[Hallway.RoomB].RoomIndex);
+		}
+	}
+
+	TestTrue(FString::Printf(TEXT("%d/10 seeds passed validation"), PassCount), PassCount >= 9);
+
+	DungeonGenerationTestHelpers::CleanupConfig(Config);
+	return true;
+}
+
+// ============================================================================
+// Nearest-neighbor room graph
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDungeonGenNearestNeighborGraph, "Dungeon.Generation.Validation.NearestNeighborGraphPasses",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDungeonGenNearestNeighborGraph::RunTest(const FString& Parameters)
+{
+	UDungeonConfiguration* Config = DungeonGenerationTestHelpers::CreateMultiFloorConfig();
+	Config->RoomGraphMode = EDungeonRoomGraph::NearestNeighbors;
+	Config->NeighborCount = 4;
+
+	const EDungeonNeighborPruning Modes[] = {
+		EDungeonNeighborPruning::None, EDungeonNeighborPruning::Gabriel, EDungeonNeighborPruning::RelativeNeighborhood };
+	for (const EDungeonNeighborPruning Mode : Modes)
+	{
+		Config->NeighborPruning = Mode;
+		const FDungeonGenerationParams Params = FDungeonGenerationParams::FromConfig(*Config);
+
+		int32 PassCount = 0;
+		for (int64 Seed = 1; Seed <= 10; ++Seed)
+		{
+			const FDungeonResult Result = UDungeonGenerator::GenerateFromParams(Params, Seed);
+			if (FDungeonValidator::ValidateAll(Result, Params).bPassed)
+			{
+				PassCount++;
+			}
+
+			// The candidate graph is connected, so the spanning tree reaches every room
+			TestEqual(FString::Printf(TEXT("Pruning %d seed %lld: spanning tree covers every room"), static_cast<int32>(Mode), Seed),
+				Result.MSTEdges.Num(), Result.Rooms.Num() - 1);
+		}
+
+		TestTrue(FString::Printf(TEXT("Pruning %d: %d/10 seeds passed validation"), static_cast<int32>(Mode), PassCount), PassCount >= 9);
+	}
+
+	DungeonGenerationTestHelpers::CleanupConfig(Config);
+	return true;
+}
+
+// ============================================================================
+// Speculative hallway carving
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDungeonGenSpeculativeMatchesSequential, "Dungeon.Generation.Speculative.MatchesSequential",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDungeonGenSpeculativeMatchesSequential::RunTest(const FString& Parameters)
+{
+	UDungeonConfiguration* Config = DungeonGenerationTestHelpers::CreateMultiFloorConfig();
+	Config->RoomCount = 14;
+	Config->EdgeReadditionChance = 0.5f;
+
+	struct FVariant
+	{
+		const TCHAR* Name;
+		EDungeonHallwaySearch Mode;
+		bool bMultiGoal;
+		bool bBound;
+	};
+	const FVariant Variants[] = {
+		{ TEXT("A*"), EDungeonHallwaySearch::AStar, false, false },
+		{ TEXT("A* multi-goal bounded"), EDungeonHallwaySearch::AStar, true, true },
+		{ TEXT("Bidirectional"), EDungeonHallwaySearch::Bidirectional, false, false },
+	};
+
+	int32 TotalReruns = 0;
+	for (const FVariant& Variant : Variants)
+	{
+		Config->HallwaySearchMode = Variant.Mode;
+		Config->BidirectionalMinDistance = 8;
+		Config->bMultiGoalHallwaySearch = Variant.bMultiGoal;
+		Config->bBoundHallwaySearch = Variant.bBound;
+
+		Config->bSpeculativeHallwayCarving = false;
+		const FDungeonGenerationParams SequentialParams = FDungeonGenerationParams::FromConfig(*Config);
+		Config->bSpeculativeHallwayCarving = true;
+		Config->SpeculativeHallwayBatchSize = 4;
+		const FDungeonGenerationParams SpeculativeParams = FDungeonGenerationParams::FromConfig(*Config);
+
+		for (int64 Seed = 1; Seed <= 8; ++Seed)
+		{
+			const FDungeonResult Sequential = UDungeonGenerator::GenerateFromParams(SequentialParams, Seed);
+			const FDungeonResult Speculative = UDungeonGenerator::GenerateFromParams(SpeculativeParams, Seed);
+
+			TestTrue(FString::Printf(TEXT("%s seed %lld: speculative layout identical to sequential"), Variant.Name, Seed),
+				DungeonGenerationTestHelpers::AreDungeonResultsIdentical(Sequential, Speculative));
+			TestEqual(FString::Printf(TEXT("%s seed %lld: sequential carving never reruns"), Variant.Name, Seed),
+				Sequential.PathfindTotals.SpeculativeReruns, 0);
+			TotalReruns += Speculative.PathfindTotals.SpeculativeReruns;
+		}
+	}
+
+	// Rooms on a 30x30 grid sit close together, so some batches must have hit a dependency
+	TestTrue(TEXT("Dependent searches were re-run"), TotalReruns > 0);
+
+	DungeonGenerationTestHelpers::CleanupConfig(Config);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDungeonGenSpeculativeBenchmark, "Dungeon.Generation.Speculative.Benchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FDungeonGenSpeculativeBenchmark::RunTest(const FString& Parameters)
+{
+	UDungeonConfiguration* Config = DungeonGenerationTestHelpers::CreateMultiFloorConfig();
+	Config->GridSize = FIntVector(160, 160, 4);
+	Config->RoomCount = 120;
+	Config->MaxPlacementAttempts = 1000;
+	Config->EdgeReadditionChance = 0.25f;
+
+	const int32 BatchSizes[] = { 1, 8, 16 };
+	double BaselineMs = 0.0;
+	FDungeonResult Reference;
+
+	for (const int32 BatchSize : BatchSizes)
+	{
+		Config->bSpeculativeHallwayCarving = BatchSize > 1;
+		Config->SpeculativeHallwayBatchSize = FMath::Max(BatchSize, 2);
+		const FDungeonGenerationParams Params = FDungeonGenerationParams::FromConfig(*Config);
+
+		double CarvingMs = 0.0;
+		int32 Reruns = 0;
+		int32 Edges = 0;
+		for (int64 Seed = 1; Seed <= 3; ++Seed)
+		{
+			const FDungeonResult Result = UDungeonGenerator::GenerateFromParams(Params, Seed);
+			CarvingMs += Result.StageTimings.HallwayCarvingMs;
+			Reruns += Result.PathfindTotals.SpeculativeReruns;
+			Edges += Result.FinalEdges.Num();
+
+			if (Seed == 1)
+			{
+				if (BatchSize == 1)
+				{
+					Reference = Result;
+				}
+				else
+				{
+					TestTrue(FString::Printf(TEXT("Batch %d: layout identical to sequential"), BatchSize),
+						DungeonGenerationTestHelpers::AreDungeonResultsIdentical(Reference, Result));
+				}
+			}
+		}
+
+		if (BatchSize == 1)
+		{
+			BaselineMs = CarvingMs;
+		}
+		AddInfo(FString::Printf(TEXT("Batch %2d: carving %.2fms (%.2fx), %d/%d searches re-run, %d worker threads"),
+			BatchSize, CarvingMs, CarvingMs > 0.0 ? BaselineMs / CarvingMs : 0.0, Reruns, Edges,
+			FTaskGraphInterface::Get().GetNumWorkerThreads()));
+	}
+
+	DungeonGenerationTestHelpers::CleanupConfig(Config);
+	return true;
+}
+
+// ============================================================================
+// Room placement modes
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDungeonGenPoissonDiskBenchmark, "Dungeon.Generation.Placement.PoissonDiskVsRejectionBenchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FDungeonGenPoissonDiskBenchmark::RunTest(const FString& Parameters)
+{
+	UDungeonConfiguration* Config = DungeonGenerationTestHelpers::CreateMultiFloorConfig();
+	Config->GridSize = FIntVector(96, 96, 3);
+	Config->RoomCount = 48;
+	Config->MaxRoomSize = FIntVector(7, 7, 1);
+	Config->MaxPlacementAttempts = 500;
+
+	const EDungeonRoomPlacement Modes[] = { EDungeonRoomPlacement::RejectionSampling, EDungeonRoomPlacement::PoissonDisk };
+	for (const EDungeonRoomPlacement Mode : Modes)
+	{
+		Config->RoomPlacementMode = Mode;
+		const FDungeonGenerationParams Params = FDungeonGenerationParams::FromConfig(*Config);
+
+		int32 Rooms = 0;
+		int32 Hallways = 0;
+		int64 HallwayCells = 0;
+		double MSTLength = 0.0;
+		double CarvingMs = 0.0;
+		int64 Pops = 0;
+		int32 Passed = 0;
+		for (int64 Seed = 1; Seed <= 5; ++Seed)
+		{
+			const FDungeonResult Result = UDungeonGenerator::GenerateFromParams(Params, Seed);
+			Rooms += Result.Rooms.Num();
+			Hallways += Result.Hallways.Num();
+			for (const FDungeonHallway& Hallway : Result.Hallways)
+			{
+				HallwayCells += Hallway.PathCells.Num();
+			}
+			for (const auto& Edge : Result.MSTEdges)
+			{
+				MSTLength += FVector(Result.Rooms[Edge.Key].Center - Result.Rooms[Edge.Value].Center).Size();
+			}
+			CarvingMs += Result.StageTimings.HallwayCarvingMs;
+			Pops += Result.PathfindTotals.NodesPopped;
+			Passed += FDungeonValidator::ValidateAll(Result, Params).bPassed ? 1 : 0;
+		}
+
+		AddInfo(FString::Printf(TEXT("%-18s rooms %d, hallways %d, hallway cells %lld, MST length %.0f, A* pops %lld, carving %.2fms, %d/5 valid"),
+			Mode == EDungeonRoomPlacement::PoissonDisk ? TEXT("Poisson disk:") : TEXT("Rejection sampling:"),
+			Rooms, Hallways, HallwayCells, MSTLength, Pops, CarvingMs, Passed));
+	}
+
+	DungeonGenerationTestHelpers::CleanupConfig(Config);
+	return true;
+}
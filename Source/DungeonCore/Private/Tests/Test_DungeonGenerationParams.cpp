@@ -0,0 +1,167 @@
+// Test_DungeonGenerationParams.cpp — Unit tests for the config snapshot and its stable hash
+#include "Misc/AutomationTest.h"
+#include "DungeonConfig.h"
+#include "DungeonGenerationParams.h"
+
+// ============================================================================
+// Test Helpers
+// ============================================================================
+
+namespace DungeonParamsTestHelpers
+{
+	UDungeonConfiguration* CreateConfig()
+	{
+		UDungeonConfiguration* Config = NewObject<UDungeonConfiguration>();
+		Config->AddToRoot();
+		return Config;
+	}
+
+	void CleanupConfig(UDungeonConfiguration* Config)
+	{
+		if (Config)
+		{
+			Config->RemoveFromRoot();
+		}
+	}
+}
+
+// ============================================================================
+// Golden value — fails if the hash definition changes without a version bump
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDungeonParamsHashGolden, "Dungeon.Params.Hash.DefaultMatchesGolden",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDungeonParamsHashGolden::RunTest(const FString& Parameters)
+{
+	const FDungeonGenerationParams Params;
+	TestEqual(TEXT("Default params hash"), Params.GetStableHash(), 0xbaf648156a22f51cull);
+	return true;
+}
+
+// ============================================================================
+// Same config produces same hash
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDungeonParamsHashStable, "Dungeon.Params.Hash.SameConfigSameHash",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDungeonParamsHashStable::RunTest(const FString& Parameters)
+{
+	UDungeonConfiguration* Config = DungeonParamsTestHelpers::CreateConfig();
+
+	const uint64 HashA = FDungeonGenerationParams::FromConfig(*Config).GetStableHash();
+	const uint64 HashB = FDungeonGenerationParams::FromConfig(*Config).GetStableHash();
+	TestEqual(TEXT("Two snapshots of one config hash equal"), HashA, HashB);
+
+	// Seed settings are not generation parameters
+	Config->bUseFixedSeed = !Config->bUseFixedSeed;
+	Config->FixedSeed = 987654;
+	TestEqual(TEXT("Seed settings do not affect hash"),
+		FDungeonGenerationParams::FromConfig(*Config).GetStableHash(), HashA);
+
+	// Neither is speculative carving, which produces the same layout as sequential carving
+	Config->bSpeculativeHallwayCarving = !Config->bSpeculativeHallwayCarving;
+	Config->SpeculativeHallwayBatchSize = 32;
+	TestEqual(TEXT("Speculative carving settings do not affect hash"),
+		FDungeonGenerationParams::FromConfig(*Config).GetStableHash(), HashA);
+
+	DungeonParamsTestHelpers::CleanupConfig(Config);
+	return true;
+}
+
+// ============================================================================
+// Any generation field change produces a different hash
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDungeonParamsHashSensitive, "Dungeon.Params.Hash.FieldChangeChangesHash",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDungeonParamsHashSensitive::RunTest(const FString& Parameters)
+{
+	UDungeonConfiguration* Config = DungeonParamsTestHelpers::CreateConfig();
+	const FDungeonGenerationParams Base = FDungeonGenerationParams::FromConfig(*Config);
+	const uint64 BaseHash = Base.GetStableHash();
+
+	auto ExpectChanged = [this, BaseHash](const TCHAR* What, const FDungeonGenerationParams& Changed)
+	{
+		TestNotEqual(What, Changed.GetStableHash(), BaseHash);
+	};
+
+	FDungeonGenerationParams P = Base;
+	P.GridSize.Z += 1;
+	ExpectChanged(TEXT("GridSize"), P);
+
+	P = Base;
+	P.RoomCount += 1;
+	ExpectChanged(TEXT("RoomCount"), P);
+
+	P = Base;
+	P.RoomPlacementMode = EDungeonRoomPlacement::SummedAreaTable;
+	ExpectChanged(TEXT("RoomPlacementMode"), P);
+
+	P = Base;
+	P.RoomCenterSpacing = 6.0f;
+	ExpectChanged(TEXT("RoomCenterSpacing"), P);
+
+	P = Base;
+	P.RoomGraphMode = EDungeonRoomGraph::NearestNeighbors;
+	ExpectChanged(TEXT("RoomGraphMode"), P);
+
+	P = Base;
+	P.NeighborCount += 1;
+	ExpectChanged(TEXT("NeighborCount"), P);
+
+	P = Base;
+	P.NeighborPruning = EDungeonNeighborPruning::RelativeNeighborhood;
+	ExpectChanged(TEXT("NeighborPruning"), P);
+
+	P = Base;
+	P.EdgeReadditionChance += 0.01f;
+	ExpectChanged(TEXT("EdgeReadditionChance"), P);
+
+	P = Base;
+	P.bGuaranteeBossRoom = !P.bGuaranteeBossRoom;
+	ExpectChanged(TEXT("bGuaranteeBossRoom"), P);
+
+	P = Base;
+	P.EntrancePlacement = EDungeonEntrancePlacement::Any;
+	ExpectChanged(TEXT("EntrancePlacement"), P);
+
+	P = Base;
+	P.RoomTypeRules.Add(FDungeonRoomTypeRule());
+	ExpectChanged(TEXT("RoomTypeRules count"), P);
+
+	if (Base.RoomTypeRules.Num() > 0)
+	{
+		P = Base;
+		P.RoomTypeRules[0].Priority += 1;
+		ExpectChanged(TEXT("RoomTypeRules[0].Priority"), P);
+	}
+
+	DungeonParamsTestHelpers::CleanupConfig(Config);
+	return true;
+}
+
+// ============================================================================
+// Snapshot is independent of later asset edits
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDungeonParamsSnapshotIndependent, "Dungeon.Params.Snapshot.IndependentOfConfig",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDungeonParamsSnapshotIndependent::RunTest(const FString& Parameters)
+{
+	UDungeonConfiguration* Config = DungeonParamsTestHelpers::CreateConfig();
+	Config->RoomCount = 6;
+
+	const FDungeonGenerationParams Params = FDungeonGenerationParams::FromConfig(*Config);
+	const uint64 HashBefore = Params.GetStableHash();
+
+	Config->RoomCount = 12;
+	Config->RoomTypeRules.Empty();
+
+	TestEqual(TEXT("Snapshot keeps RoomCount"), Params.RoomCount, 6);
+	TestEqual(TEXT("Snapshot hash unchanged"), Params.GetStableHash(), HashBefore);
+	TestNotEqual(TEXT("New snapshot differs"),
+		FDungeonGenerationParams::FromConfig(*Config).GetStableHash(), HashBefore);
+
+	DungeonParamsTestHelpers::CleanupConfig(Config);
+	return true;
+}
@@ -2,6 +2,7 @@
 #include "Misc/AutomationTest.h"
 #include "DungeonTypes.h"
 #include "DungeonConfig.h"
+#include "DungeonGenerationParams.h"
 #include "DungeonValidator.h"
 
 // ============================================================================
@@ -64,41 +65,41 @@ namespace DungeonValidationTestHelpers
 		{
 			for (int32 X = 0; X <= 2; ++X)
 			{
-				FDungeonCell& Cell = Result.Grid.GetCell(X, Y, 0);
+				FDungeonCell& Cell = Result.Grid.GetCellForWrite(X, Y, 0);
 				const bool bBoundary = (X == 0 || X == 2 || Y == 0 || Y == 2);
 				Cell.CellType = bBoundary ? EDungeonCellType::RoomWall : EDungeonCellType::Room;
 				Cell.RoomIndex = 1;
 			}
 		}
 		// Mark entrance
-		Result.Grid.GetCell(1, 1, 0).CellType = EDungeonCellType::Entrance;
+		Result.Grid.GetCellForWrite(1, 1, 0).CellType = EDungeonCellType::Entrance;
 		// Door on east wall
-		Result.Grid.GetCell(2, 1, 0).CellType = EDungeonCellType::Door;
+		Result.Grid.GetCellForWrite(2, 1, 0).CellType = EDungeonCellType::Door;
 
 		// Stamp Room 1: (6,6,0) to (8,8,0)
 		for (int32 Y = 6; Y <= 8; ++Y)
 		{
 			for (int32 X = 6; X <= 8; ++X)
 			{
-				FDungeonCell& Cell = Result.Grid.GetCell(X, Y, 0);
+				FDungeonCell& Cell = Result.Grid.GetCellForWrite(X, Y, 0);
 				const bool bBoundary = (X == 6 || X == 8 || Y == 6 || Y == 8);
 				Cell.CellType = bBoundary ? EDungeonCellType::RoomWall : EDungeonCellType::Room;
 				Cell.RoomIndex = 2;
 			}
 		}
 		// Door on west wall
-		Result.Grid.GetCell(6, 7, 0).CellType = EDungeonCellType::Door;
+		Result.Grid.GetCellForWrite(6, 7, 0).CellType = EDungeonCellType::Door;
 
 		// Hallway: (3,1) → (5,1) then (5,2) → (5,7)
 		for (int32 X = 3; X <= 5; ++X)
 		{
-			FDungeonCell& Cell = Result.Grid.GetCell(X, 1, 0);
+			FDungeonCell& Cell = Result.Grid.GetCellForWrite(X, 1, 0);
 			Cell.CellType = EDungeonCellType::Hallway;
 			Cell.HallwayIndex = 1;
 		}
 		for (int32 Y = 2; Y <= 7; ++Y)
 		{
-			FDungeonCell& Cell = Result.Grid.GetCell(5, Y, 0);
+			FDungeonCell& Cell = Result.Grid.GetCellForWrite(5, Y, 0);
 			Cell.CellType = EDungeonCellType::Hallway;
 			Cell.HallwayIndex = 1;
 		}
@@ -237,7 +238,7 @@ bool FDungeonValidateBufferMaintained::RunTest(const FString& Parameters)
 	Config->RoomBuffer = 1;
 
 	TArray<FDungeonValidationIssue> Issues;
-	FDungeonValidator::ValidateRoomBuffer(Result, *Config, Issues);
+	FDungeonValidator::ValidateRoomBuffer(Result, FDungeonGenerationParams::FromConfig(*Config), Issues);
 	TestEqual(TEXT("Buffer maintained"), Issues.Num(), 0);
 
 	DungeonValidationTestHelpers::CleanupConfig(Config);
@@ -258,7 +259,7 @@ bool FDungeonValidateBufferViolation::RunTest(const FString& Parameters)
 	Config->RoomBuffer = 1;
 
 	TArray<FDungeonValidationIssue> Issues;
-	FDungeonValidator::ValidateRoomBuffer(Result, *Config, Issues);
+	FDungeonValidator::ValidateRoomBuffer(Result, FDungeonGenerationParams::FromConfig(*Config), Issues);
 	TestTrue(TEXT("Buffer violation detected"), Issues.Num() > 0);
 
 	DungeonValidationTestHelpers::CleanupConfig(Config);
@@ -279,7 +280,7 @@ bool FDungeonValidateBufferZeroAllowed::RunTest(const FString& Parameters)
 	Config->RoomBuffer = 0;
 
 	TArray<FDungeonValidationIssue> Issues;
-	FDungeonValidator::ValidateRoomBuffer(Result, *Config, Issues);
+	FDungeonValidator::ValidateRoomBuffer(Result, FDungeonGenerationParams::FromConfig(*Config), Issues);
 	TestEqual(TEXT("Zero buffer allows adjacent rooms"), Issues.Num(), 0);
 
 	DungeonValidationTestHelpers::CleanupConfig(Config);
@@ -317,7 +318,7 @@ bool FDungeonValidateReachOrphanRoom::RunTest(const FString& Parameters)
 	{
 		for (int32 X = 0; X <= 2; ++X)
 		{
-			FDungeonCell& Cell = Result.Grid.GetCell(X, Y, 0);
+			FDungeonCell& Cell = Result.Grid.GetCellForWrite(X, Y, 0);
 			const bool bBoundary = (X == 0 || X == 2 || Y == 7 || Y == 9);
 			Cell.CellType = bBoundary ? EDungeonCellType::RoomWall : EDungeonCellType::Room;
 			Cell.RoomIndex = 3;
@@ -339,8 +340,8 @@ bool FDungeonValidateReachOrphanHallway::RunTest(const FString& Parameters)
 	FDungeonResult Result = DungeonValidationTestHelpers::CreateSimpleResult();
 
 	// Add disconnected hallway cells in an unused area
-	Result.Grid.GetCell(9, 0, 0).CellType = EDungeonCellType::Hallway;
-	Result.Grid.GetCell(9, 1, 0).CellType = EDungeonCellType::Hallway;
+	Result.Grid.GetCellForWrite(9, 0, 0).CellType = EDungeonCellType::Hallway;
+	Result.Grid.GetCellForWrite(9, 1, 0).CellType = EDungeonCellType::Hallway;
 
 	TArray<FDungeonValidationIssue> Issues;
 	FDungeonValidator::ValidateReachability(Result, Issues);
@@ -389,40 +390,40 @@ bool FDungeonValidateReachMultiFloor::RunTest(const FString& Parameters)
 	{
 		for (int32 X = 0; X <= 2; ++X)
 		{
-			FDungeonCell& Cell = Result.Grid.GetCell(X, Y, 0);
+			FDungeonCell& Cell = Result.Grid.GetCellForWrite(X, Y, 0);
 			const bool bBoundary = (X == 0 || X == 2 || Y == 0 || Y == 2);
 			Cell.CellType = bBoundary ? EDungeonCellType::RoomWall : EDungeonCellType::Room;
 			Cell.RoomIndex = 1;
 		}
 	}
-	Result.Grid.GetCell(1, 1, 0).CellType = EDungeonCellType::Entrance;
-	Result.Grid.GetCell(2, 1, 0).CellType = EDungeonCellType::Door;
+	Result.Grid.GetCellForWrite(1, 1, 0).CellType = EDungeonCellType::Entrance;
+	Result.Grid.GetCellForWrite(2, 1, 0).CellType = EDungeonCellType::Door;
 
 	// Stamp Room 1
 	for (int32 Y = 0; Y <= 2; ++Y)
 	{
 		for (int32 X = 7; X <= 9; ++X)
 		{
-			FDungeonCell& Cell = Result.Grid.GetCell(X, Y, 1);
+			FDungeonCell& Cell = Result.Grid.GetCellForWrite(X, Y, 1);
 			const bool bBoundary = (X == 7 || X == 9 || Y == 0 || Y == 2);
 			Cell.CellType = bBoundary ? EDungeonCellType::RoomWall : EDungeonCellType::Room;
 			Cell.RoomIndex = 2;
 		}
 	}
-	Result.Grid.GetCell(7, 1, 1).CellType = EDungeonCellType::Door;
+	Result.Grid.GetCellForWrite(7, 1, 1).CellType = EDungeonCellType::Door;
 
 	// Hallway on floor 0: (3,1,0) to (5,1,0)
 	for (int32 X = 3; X <= 5; ++X)
 	{
-		Result.Grid.GetCell(X, 1, 0).CellType = EDungeonCellType::Hallway;
+		Result.Grid.GetCellForWrite(X, 1, 0).CellType = EDungeonCellType::Hallway;
 	}
 
 	// Staircase connecting floors: (5,1,0) → (5,1,1) vertical transition
-	Result.Grid.GetCell(5, 1, 0).CellType = EDungeonCellType::Staircase;
-	Result.Grid.GetCell(5, 1, 1).CellType = EDungeonCellType::Staircase;
+	Result.Grid.GetCellForWrite(5, 1, 0).CellType = EDungeonCellType::Staircase;
+	Result.Grid.GetCellForWrite(5, 1, 1).CellType = EDungeonCellType::Staircase;
 
 	// Hallway on floor 1: (6,1,1)
-	Result.Grid.GetCell(6, 1, 1).CellType = EDungeonCellType::Hallway;
+	Result.Grid.GetCellForWrite(6, 1, 1).CellType = EDungeonCellType::Hallway;
 
 	TArray<FDungeonValidationIssue> Issues;
 	FDungeonValidator::ValidateReachability(Result, Issues);
@@ -448,9 +449,9 @@ bool FDungeonValidateHeadroomClear::RunTest(const FString& Parameters)
 	Result.EntranceCell = FIntVector(1, 1, 0);
 
 	// Mark staircase cells
-	Result.Grid.GetCell(5, 1, 0).CellType = EDungeonCellType::Staircase;
-	Result.Grid.GetCell(5, 1, 1).CellType = EDungeonCellType::StaircaseHead;
-	Result.Grid.GetCell(5, 1, 2).CellType = EDungeonCellType::StaircaseHead;
+	Result.Grid.GetCellForWrite(5, 1, 0).CellType = EDungeonCellType::Staircase;
+	Result.Grid.GetCellForWrite(5, 1, 1).CellType = EDungeonCellType::StaircaseHead;
+	Result.Grid.GetCellForWrite(5, 1, 2).CellType = EDungeonCellType::StaircaseHead;
 
 	FDungeonStaircase Staircase;
 	Staircase.BottomCell = FIntVector(5, 1, 0);
@@ -480,10 +481,10 @@ bool FDungeonValidateHeadroomBlocked::RunTest(const FString& Parameters)
 	Result.EntranceCell = FIntVector(1, 1, 0);
 
 	// Staircase body on floor 0
-	Result.Grid.GetCell(5, 1, 0).CellType = EDungeonCellType::Staircase;
+	Result.Grid.GetCellForWrite(5, 1, 0).CellType = EDungeonCellType::Staircase;
 	// Room blocking headroom on floor 1
-	Result.Grid.GetCell(5, 1, 1).CellType = EDungeonCellType::Room;
-	Result.Grid.GetCell(5, 1, 1).RoomIndex = 1;
+	Result.Grid.GetCellForWrite(5, 1, 1).CellType = EDungeonCellType::Room;
+	Result.Grid.GetCellForWrite(5, 1, 1).RoomIndex = 1;
 
 	FDungeonStaircase Staircase;
 	Staircase.BottomCell = FIntVector(5, 1, 0);
@@ -566,7 +567,7 @@ bool FDungeonValidateEntranceWrongType::RunTest(const FString& Parameters)
 {
 	FDungeonResult Result = DungeonValidationTestHelpers::CreateSimpleResult();
 	// Change entrance cell type to Room instead of Entrance
-	Result.Grid.GetCell(1, 1, 0).CellType = EDungeonCellType::Room;
+	Result.Grid.GetCellForWrite(1, 1, 0).CellType = EDungeonCellType::Room;
 
 	TArray<FDungeonValidationIssue> Issues;
 	FDungeonValidator::ValidateEntrance(Result, Issues);
@@ -0,0 +1,229 @@
+// Test_GeometricPredicates.cpp — Unit tests for the exact orientation / in-sphere predicates
+#include "Misc/AutomationTest.h"
+#include "GeometricPredicates.h"
+#include "DungeonSeed.h"
+
+// ============================================================================
+// Test Helpers
+// ============================================================================
+
+namespace GeometricPredicatesTestHelpers
+{
+	/** Exact det[B-A, C-A, D-A] for integer points within +-2^17 (every intermediate fits in int64). */
+	int64 Orient3DInt(const FIntVector& A, const FIntVector& B, const FIntVector& C, const FIntVector& D)
+	{
+		const int64 ABX = B.X - A.X, ABY = B.Y - A.Y, ABZ = B.Z - A.Z;
+		const int64 ACX = C.X - A.X, ACY = C.Y - A.Y, ACZ = C.Z - A.Z;
+		const int64 ADX = D.X - A.X, ADY = D.Y - A.Y, ADZ = D.Z - A.Z;
+		return (ABY * ACZ - ABZ * ACY) * ADX + (ABZ * ACX - ABX * ACZ) * ADY + (ABX * ACY - ABY * ACX) * ADZ;
+	}
+
+	int32 Sign(double Value)
+	{
+		return Value > 0.0 ? 1 : (Value < 0.0 ? -1 : 0);
+	}
+
+	/** Integer points on the sphere x^2 + y^2 + z^2 = 9. */
+	const FVector SpherePoints[] = {
+		FVector(3, 0, 0), FVector(-3, 0, 0), FVector(0, 3, 0), FVector(0, -3, 0), FVector(0, 0, 3),
+		FVector(0, 0, -3), FVector(2, 2, 1), FVector(1, 2, 2), FVector(2, -1, 2), FVector(-2, 2, 1),
+		FVector(-1, -2, -2), FVector(2, 1, -2),
+	};
+}
+
+// ============================================================================
+// Orient3D gets the sign right on nearly coplanar points, where plain doubles round wrong
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGeometricPredicatesOrientExact, "Dungeon.Predicates.Orient3D.ExactOnNearCoplanar",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FGeometricPredicatesOrientExact::RunTest(const FString& Parameters)
+{
+	using namespace GeometricPredicatesTestHelpers;
+
+	FDungeonSeed Rng(77);
+	int32 Mismatches = 0;
+	int32 Coplanar = 0;
+	for (int32 Trial = 0; Trial < 20000; ++Trial)
+	{
+		// Four points on the plane z = SlopeX*x + SlopeY*y, the last nudged off it by at most 1
+		const int32 SlopeX = Rng.RandRange(-3, 3);
+		const int32 SlopeY = Rng.RandRange(-3, 3);
+		const int32 Range = 1 << 14;
+		FIntVector Int[4];
+		for (FIntVector& P : Int)
+		{
+			P.X = Rng.RandRange(-Range, Range);
+			P.Y = Rng.RandRange(-Range, Range);
+			P.Z = SlopeX * P.X + SlopeY * P.Y;
+		}
+		Int[3].Z += Rng.RandRange(-1, 1);
+
+		const int64 Expected = Orient3DInt(Int[0], Int[1], Int[2], Int[3]);
+		const int32 ExpectedSign = Expected > 0 ? 1 : (Expected < 0 ? -1 : 0);
+		const double Actual = FGeometricPredicates::Orient3D(FVector(Int[0]), FVector(Int[1]), FVector(Int[2]), FVector(Int[3]));
+		Mismatches += Sign(Actual) != ExpectedSign ? 1 : 0;
+		Coplanar += ExpectedSign == 0 ? 1 : 0;
+	}
+
+	TestEqual(TEXT("Orientation signs differing from exact integer arithmetic"), Mismatches, 0);
+	TestTrue(TEXT("Exactly coplanar cases were exercised"), Coplanar > 0);
+	return true;
+}
+
+// ============================================================================
+// InSphere is exactly zero on cospherical points and resolves tiny offsets, far from the origin
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGeometricPredicatesInSphereExact, "Dungeon.Predicates.InSphere.ExactOnCospherical",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FGeometricPredicatesInSphereExact::RunTest(const FString& Parameters)
+{
+	using namespace GeometricPredicatesTestHelpers;
+
+	const FVector Offsets[] = { FVector::ZeroVector, FVector(1.0e6 + 0.25, -3.0e5, 512.5), FVector(12345.678, 0.001, -99.5) };
+	for (const FVector& Offset : Offsets)
+	{
+		// A positively oriented tetrahedron on the sphere
+		FVector Tet[4] = { SpherePoints[0] + Offset, SpherePoints[2] + Offset, SpherePoints[4] + Offset, SpherePoints[1] + Offset };
+		if (FGeometricPredicates::Orient3D(Tet[0], Tet[1], Tet[2], Tet[3]) < 0.0)
+		{
+			Swap(Tet[2], Tet[3]);
+		}
+
+		for (int32 i = 5; i < UE_ARRAY_COUNT(SpherePoints); ++i)
+		{
+			const FVector OnSphere = SpherePoints[i] + Offset;
+			TestTrue(FString::Printf(TEXT("Cospherical point %d at offset %s"), i, *Offset.ToString()),
+				FGeometricPredicates::InSphere(Tet[0], Tet[1], Tet[2], Tet[3], OnSphere) == 0.0);
+
+			// Step a hair toward and away from the center
+			const FVector Inward = SpherePoints[i] * (1.0 - 1.0e-9) + Offset;
+			const FVector Outward = SpherePoints[i] * (1.0 + 1.0e-9) + Offset;
+			if (Inward != OnSphere)
+			{
+				TestTrue(TEXT("Inward nudge is inside"), FGeometricPredicates::InSphere(Tet[0], Tet[1], Tet[2], Tet[3], Inward) > 0.0);
+			}
+			if (Outward != OnSphere)
+			{
+				TestTrue(TEXT("Outward nudge is outside"), FGeometricPredicates::InSphere(Tet[0], Tet[1], Tet[2], Tet[3], Outward) < 0.0);
+			}
+		}
+	}
+	return true;
+}
+
+// ============================================================================
+// The perturbed test never ties on a real tetrahedron and agrees with InSphere off the sphere
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGeometricPredicatesPerturbed, "Dungeon.Predicates.InSphere.PerturbedNeverTies",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FGeometricPredicatesPerturbed::RunTest(const FString& Parameters)
+{
+	using namespace GeometricPredicatesTestHelpers;
+
+	TArray<FVector> Points;
+	for (const FVector& P : SpherePoints)
+	{
+		Points.Add(P);
+	}
+	Points.Add(FVector(0, 0, 0));
+	Points.Add(FVector(1, 1, 1));
+	Points.Add(FVector(5, 0, 0));
+
+	FDungeonSeed Rng(5);
+	int32 Ties = 0;
+	int32 Disagreements = 0;
+	int32 Cospherical = 0;
+	for (int32 Trial = 0; Trial < 5000; ++Trial)
+	{
+		int32 Idx[5];
+		for (int32 i = 0; i < 5; ++i)
+		{
+			bool bUnique;
+			do
+			{
+				Idx[i] = Rng.RandRange(0, Points.Num() - 1);
+				bUnique = true;
+				for (int32 j = 0; j < i; ++j)
+				{
+					bUnique &= Idx[j] != Idx[i];
+				}
+			} while (!bUnique);
+		}
+
+		if (FGeometricPredicates::Orient3D(Points[Idx[0]], Points[Idx[1]], Points[Idx[2]], Points[Idx[3]]) == 0.0)
+		{
+			continue;
+		}
+
+		const double Plain = FGeometricPredicates::InSphere(Points[Idx[0]], Points[Idx[1]], Points[Idx[2]], Points[Idx[3]], Points[Idx[4]]);
+		const int32 Perturbed = FGeometricPredicates::InSpherePerturbed(Points, Idx[0], Idx[1], Idx[2], Idx[3], Idx[4]);
+		Ties += Perturbed == 0 ? 1 : 0;
+		Cospherical += Plain == 0.0 ? 1 : 0;
+		Disagreements += (Plain != 0.0 && Sign(Plain) != Perturbed) ? 1 : 0;
+	}
+
+	TestEqual(TEXT("Perturbed ties on non-degenerate tetrahedra"), Ties, 0);
+	TestEqual(TEXT("Perturbed sign differing from a non-zero InSphere"), Disagreements, 0);
+	TestTrue(TEXT("Cospherical cases were exercised"), Cospherical > 0);
+	return true;
+}
+
+// ============================================================================
+// The 2D predicates: exact zero on cocircular points, never a tie once perturbed
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGeometricPredicatesInCircle, "Dungeon.Predicates.InCircle.ExactOnCocircular",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FGeometricPredicatesInCircle::RunTest(const FString& Parameters)
+{
+	// Integer points on the circle x^2 + y^2 = 25
+	const FVector2D Circle[] = {
+		FVector2D(5, 0), FVector2D(0, 5), FVector2D(-5, 0), FVector2D(0, -5), FVector2D(3, 4),
+		FVector2D(-4, 3), FVector2D(-3, -4), FVector2D(4, -3),
+	};
+
+	const FVector2D Offsets[] = { FVector2D::ZeroVector, FVector2D(1.0e6 + 0.25, -3.0e5), FVector2D(12345.678, 0.001) };
+	for (const FVector2D& Offset : Offsets)
+	{
+		// Counter-clockwise around the circle
+		const FVector2D A = Circle[0] + Offset, B = Circle[1] + Offset, C = Circle[2] + Offset;
+		TestTrue(TEXT("Counter-clockwise is positive"), FGeometricPredicates::Orient2D(A, B, C) > 0.0);
+		TestTrue(TEXT("Clockwise is negative"), FGeometricPredicates::Orient2D(A, C, B) < 0.0);
+
+		TArray<FVector2D> Points;
+		for (int32 i = 3; i < UE_ARRAY_COUNT(Circle); ++i)
+		{
+			const FVector2D OnCircle = Circle[i] + Offset;
+			TestTrue(FString::Printf(TEXT("Cocircular point %d at offset %s"), i, *Offset.ToString()),
+				FGeometricPredicates::InCircle(A, B, C, OnCircle) == 0.0);
+
+			const FVector2D Inward = Circle[i] * (1.0 - 1.0e-9) + Offset;
+			const FVector2D Outward = Circle[i] * (1.0 + 1.0e-9) + Offset;
+			if (Inward != OnCircle)
+			{
+				TestTrue(TEXT("Inward nudge is inside"), FGeometricPredicates::InCircle(A, B, C, Inward) > 0.0);
+			}
+			if (Outward != OnCircle)
+			{
+				TestTrue(TEXT("Outward nudge is outside"), FGeometricPredicates::InCircle(A, B, C, Outward) < 0.0);
+			}
+		}
+
+		// Perturbed: one answer, and the same answer whichever order the triangle is given in
+		for (const FVector2D& P : Circle)
+		{
+			Points.Add(P + Offset);
+		}
+		for (int32 D = 3; D < Points.Num(); ++D)
+		{
+			const int32 Perturbed = FGeometricPredicates::InCirclePerturbed(Points, 0, 1, 2, D);
+			TestTrue(TEXT("Perturbed never ties"), Perturbed != 0);
+			TestEqual(TEXT("Perturbed is invariant under rotating the triangle"),
+				FGeometricPredicates::InCirclePerturbed(Points, 1, 2, 0, D), Perturbed);
+		}
+	}
+	return true;
+}
@@ -0,0 +1,1305 @@
+// Test_HallwayPathfinder.cpp — Unit tests for FHallwayPathfinder on hand-built grids
+#include "Misc/AutomationTest.h"
+#include "DungeonTypes.h"
+#include "DungeonGenerationParams.h"
+#include "HallwayPathfinder.h"
+#include "DungeonSeed.h"
+
+// ============================================================================
+// Test Helpers
+// ============================================================================
+
+namespace HallwayPathfinderTestHelpers
+{
+	/** Empty grid with a blocking wall at X=WallX spanning Y=[0, WallLength) on every floor. */
+	FDungeonGrid CreateWalledGrid(const FIntVector& Size, int32 WallX, int32 WallLength)
+	{
+		FDungeonGrid Grid;
+		Grid.Initialize(Size);
+		for (int32 Z = 0; Z < Size.Z; ++Z)
+		{
+			for (int32 Y = 0; Y < WallLength && Y < Size.Y; ++Y)
+			{
+				// Staircase cells are impassable to the pathfinder
+				Grid.GetCellForWrite(WallX, Y, Z).CellType = EDungeonCellType::Staircase;
+			}
+		}
+		return Grid;
+	}
+
+	/** Every step is a cardinal move on one floor or a staircase jump that changes Z by one. */
+	bool IsPathContinuous(const TArray<FIntVector>& Path)
+	{
+		for (int32 i = 1; i < Path.Num(); ++i)
+		{
+			const FIntVector Delta = Path[i] - Path[i - 1];
+			const int32 Horizontal = FMath::Abs(Delta.X) + FMath::Abs(Delta.Y);
+			if (Delta.Z == 0 && Horizontal != 1) return false;
+			if (FMath::Abs(Delta.Z) > 1) return false;
+		}
+		return true;
+	}
+
+	/** Cost FindPath charges for a single-floor Path over Empty and Hallway cells (no rooms). */
+	float SingleFloorPathCost(const FDungeonGrid& Grid, const TArray<FIntVector>& Path, const FDungeonGenerationParams& Params)
+	{
+		float Cost = 0.0f;
+		for (int32 i = 1; i < Path.Num(); ++i)
+		{
+			Cost += Grid.GetCell(Path[i]).CellType == EDungeonCellType::Hallway
+				? FMath::Max(Params.HallwayMergeCostMultiplier, 0.001f)
+				: 1.0f;
+		}
+		return Cost;
+	}
+
+	struct FQuery
+	{
+		FIntVector Start;
+		FIntVector End;
+	};
+
+	/** Grid with random single-floor obstacle blocks (impassable Staircase cells), ~Density of floor area. */
+	FDungeonGrid CreateScatteredGrid(const FIntVector& Size, float Density, int64 Seed)
+	{
+		FDungeonGrid Grid;
+		Grid.Initialize(Size);
+		FDungeonSeed Rng(Seed);
+
+		const int32 BlockCount = FMath::RoundToInt(Size.X * Size.Y * Size.Z * Density / 9.0f);
+		for (int32 b = 0; b < BlockCount; ++b)
+		{
+			const int32 X0 = Rng.RandRange(0, Size.X - 3);
+			const int32 Y0 = Rng.RandRange(0, Size.Y - 3);
+			const int32 Z = Rng.RandRange(0, Size.Z - 1);
+			for (int32 Y = Y0; Y < Y0 + 3; ++Y)
+			{
+				for (int32 X = X0; X < X0 + 3; ++X)
+				{
+					Grid.GetCellForWrite(X, Y, Z).CellType = EDungeonCellType::Staircase;
+				}
+			}
+		}
+		return Grid;
+	}
+
+	/** Random empty cell in the given X range on any floor. */
+	FIntVector RandomEmptyCell(const FDungeonGrid& Grid, FDungeonSeed& Rng, int32 MinX, int32 MaxX)
+	{
+		for (;;)
+		{
+			const FIntVector Cell(
+				Rng.RandRange(MinX, MaxX),
+				Rng.RandRange(0, Grid.GridSize.Y - 1),
+				Rng.RandRange(0, Grid.GridSize.Z - 1));
+			if (Grid.GetCell(Cell).CellType == EDungeonCellType::Empty)
+			{
+				return Cell;
+			}
+		}
+	}
+
+	/**
+	 * Every live node of Graph as "cell > partner cell : cost | edge cell : cost ...", sorted, so
+	 * two graphs compare equal whatever node ids they happened to assign.
+	 */
+	TArray<FString> DescribeClusterGraph(const FHallwayClusterGraph& Graph)
+	{
+		TArray<FString> Lines;
+		for (int32 Cluster = 0; Cluster < Graph.NumClusters(); ++Cluster)
+		{
+			for (int32 NodeIdx : Graph.GetClusterNodes(Cluster))
+			{
+				const FHallwayClusterGraph::FNode& Node = Graph.GetNode(NodeIdx);
+
+				TArray<FString> Edges;
+				for (const FHallwayClusterGraph::FEdge& Edge : Node.Edges)
+				{
+					Edges.Add(FString::Printf(TEXT("%s:%.4f"), *Graph.GetNode(Edge.To).Cell.ToString(), Edge.Cost));
+				}
+				Edges.Sort();
+
+				Lines.Add(FString::Printf(TEXT("%s > %s:%.4f | %s"),
+					*Node.Cell.ToString(), *Graph.GetNode(Node.Partner).Cell.ToString(), Node.PartnerCost,
+					*FString::Join(Edges, TEXT(" "))));
+			}
+		}
+		Lines.Sort();
+		return Lines;
+	}
+}
+
+// ============================================================================
+// Open grid gives a Manhattan-length path
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHallwayPathOpenGrid, "Dungeon.Pathfinder.Basic.OpenGridShortestPath",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FHallwayPathOpenGrid::RunTest(const FString& Parameters)
+{
+	FDungeonGrid Grid;
+	Grid.Initialize(FIntVector(20, 20, 1));
+	const FDungeonGenerationParams Params;
+
+	TArray<FIntVector> Path;
+	const bool bFound = FHallwayPathfinder::FindPath(
+		Grid, FIntVector(0, 0, 0), FIntVector(10, 5, 0), Params, 0, 0, Path);
+
+	TestTrue(TEXT("Path found"), bFound);
+	TestEqual(TEXT("Path length is Manhattan distance + 1"), Path.Num(), 16);
+	TestTrue(TEXT("Path is continuous"), HallwayPathfinderTestHelpers::IsPathContinuous(Path));
+	return true;
+}
+
+// ============================================================================
+// Wall forces a detour
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHallwayPathWallDetour, "Dungeon.Pathfinder.Basic.WallForcesDetour",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FHallwayPathWallDetour::RunTest(const FString& Parameters)
+{
+	const FDungeonGrid Grid = HallwayPathfinderTestHelpers::CreateWalledGrid(FIntVector(20, 20, 1), 5, 15);
+	const FDungeonGenerationParams Params;
+
+	TArray<FIntVector> Path;
+	const bool bFound = FHallwayPathfinder::FindPath(
+		Grid, FIntVector(2, 2, 0), FIntVector(8, 2, 0), Params, 0, 0, Path);
+
+	TestTrue(TEXT("Path found"), bFound);
+	TestTrue(TEXT("Path is continuous"), HallwayPathfinderTestHelpers::IsPathContinuous(Path));
+	TestTrue(TEXT("Path goes around the wall"), Path.Num() > 7);
+	for (const FIntVector& Cell : Path)
+	{
+		TestFalse(TEXT("Path never enters the wall"), Cell.X == 5 && Cell.Y < 15);
+	}
+	return true;
+}
+
+// ============================================================================
+// Reused workspace gives the same paths as a fresh one
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHallwayPathWorkspaceReuse, "Dungeon.Pathfinder.Workspace.ReuseMatchesFresh",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FHallwayPathWorkspaceReuse::RunTest(const FString& Parameters)
+{
+	using HallwayPathfinderTestHelpers::FQuery;
+
+	const FDungeonGrid Grid = HallwayPathfinderTestHelpers::CreateWalledGrid(FIntVector(20, 20, 3), 8, 16);
+	const FDungeonGenerationParams Params;
+
+	const FQuery Queries[] = {
+		{ FIntVector(2, 2, 0), FIntVector(15, 3, 0) },
+		{ FIntVector(1, 18, 0), FIntVector(18, 1, 0) },
+		{ FIntVector(2, 2, 0), FIntVector(15, 15, 1) },
+		{ FIntVector(3, 10, 1), FIntVector(12, 10, 0) },
+		{ FIntVector(2, 2, 0), FIntVector(15, 3, 0) },
+	};
+
+	FPathfinderWorkspace Workspace;
+	for (int32 i = 0; i < UE_ARRAY_COUNT(Queries); ++i)
+	{
+		const FQuery& Query = Queries[i];
+
+		TArray<FIntVector> FreshPath;
+		const bool bFreshFound = FHallwayPathfinder::FindPath(
+			Grid, Query.Start, Query.End, Params, 0, 0, FreshPath);
+
+		TArray<FIntVector> ReusedPath;
+		const bool bReusedFound = FHallwayPathfinder::FindPath(
+			Grid, Query.Start, Query.End, Params, 0, 0, ReusedPath, nullptr, &Workspace);
+
+		TestEqual(FString::Printf(TEXT("Query %d: same found flag"), i), bReusedFound, bFreshFound);
+		TestTrue(FString::Printf(TEXT("Query %d: same path"), i), ReusedPath == FreshPath);
+	}
+	return true;
+}
+
+// ============================================================================
+// Windowed search finds short paths without touching the whole grid
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHallwayPathWindowShort, "Dungeon.Pathfinder.Window.ShortPathStaysInWindow",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FHallwayPathWindowShort::RunTest(const FString& Parameters)
+{
+	FDungeonGrid Grid;
+	Grid.Initialize(FIntVector(100, 100, 4));
+	const FDungeonGenerationParams Params;
+
+	const FIntVector Start(40, 40, 0);
+	const FIntVector End(46, 43, 0);
+	const FPathSearchWindow Window(FIntVector(38, 38, 0), FIntVector(48, 45, 1));
+
+	TArray<FIntVector> FullPath;
+	FPathfindStats FullStats;
+	FHallwayPathfinder::FindPath(Grid, Start, End, Params, 0, 0, FullPath, &FullStats);
+
+	TArray<FIntVector> WindowPath;
+	FPathfindStats WindowStats;
+	const bool bFound = FHallwayPathfinder::FindPath(
+		Grid, Start, End, Params, 0, 0, WindowPath, &WindowStats, nullptr, &Window);
+
+	TestTrue(TEXT("Path found"), bFound);
+	TestEqual(TEXT("No fallback needed"), WindowStats.WindowFallbacks, 0);
+	TestEqual(TEXT("Same length as unbounded search"), WindowPath.Num(), FullPath.Num());
+	for (const FIntVector& Cell : WindowPath)
+	{
+		TestTrue(TEXT("Path stays inside window"), Window.Contains(Cell));
+	}
+	TestTrue(TEXT("Window pushes no more nodes than full grid"), WindowStats.NodesPushed <= FullStats.NodesPushed);
+	return true;
+}
+
+// ============================================================================
+// Blocked window widens to the full grid
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHallwayPathWindowFallback, "Dungeon.Pathfinder.Window.BlockedWindowFallsBack",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FHallwayPathWindowFallback::RunTest(const FString& Parameters)
+{
+	// Wall at X=5 for Y<15 — the only way around is outside a window that ends at Y=8
+	const FDungeonGrid Grid = HallwayPathfinderTestHelpers::CreateWalledGrid(FIntVector(20, 20, 1), 5, 15);
+	const FDungeonGenerationParams Params;
+	const FPathSearchWindow Window(FIntVector(0, 0, 0), FIntVector(10, 8, 0));
+
+	TArray<FIntVector> Path;
+	FPathfindStats Stats;
+	const bool bFound = FHallwayPathfinder::FindPath(
+		Grid, FIntVector(2, 2, 0), FIntVector(8, 2, 0), Params, 0, 0, Path, &Stats, nullptr, &Window);
+
+	TestTrue(TEXT("Path found after widening"), bFound);
+	TestEqual(TEXT("One fallback recorded"), Stats.WindowFallbacks, 1);
+	TestTrue(TEXT("Path is continuous"), HallwayPathfinderTestHelpers::IsPathContinuous(Path));
+	return true;
+}
+
+// ============================================================================
+// Bidirectional search matches unidirectional on an open grid
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHallwayPathBidiOpenGrid, "Dungeon.Pathfinder.Bidirectional.OpenGridShortestPath",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FHallwayPathBidiOpenGrid::RunTest(const FString& Parameters)
+{
+	FDungeonGrid Grid;
+	Grid.Initialize(FIntVector(40, 40, 1));
+	FDungeonGenerationParams Params;
+	Params.HallwaySearchMode = EDungeonHallwaySearch::Bidirectional;
+	Params.BidirectionalMinDistance = 0;
+
+	TArray<FIntVector> Path;
+	const bool bFound = FHallwayPathfinder::FindPath(
+		Grid, FIntVector(1, 2, 0), FIntVector(35, 30, 0), Params, 0, 0, Path);
+
+	TestTrue(TEXT("Path found"), bFound);
+	TestEqual(TEXT("Path length is Manhattan distance + 1"), Path.Num(), 34 + 28 + 1);
+	TestTrue(TEXT("Path is continuous"), HallwayPathfinderTestHelpers::IsPathContinuous(Path));
+	TestEqual(TEXT("Starts at Start"), Path.Num() > 0 ? Path[0] : FIntVector(-1), FIntVector(1, 2, 0));
+	TestEqual(TEXT("Ends at End"), Path.Num() > 0 ? Path.Last() : FIntVector(-1), FIntVector(35, 30, 0));
+	return true;
+}
+
+// ============================================================================
+// Bidirectional search climbs floors via reversed staircase moves
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHallwayPathBidiMultiFloor, "Dungeon.Pathfinder.Bidirectional.CrossFloorPath",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FHallwayPathBidiMultiFloor::RunTest(const FString& Parameters)
+{
+	const FDungeonGrid Grid = HallwayPathfinderTestHelpers::CreateWalledGrid(FIntVector(30, 30, 4), 12, 20);
+	FDungeonGenerationParams Params;
+	Params.HallwaySearchMode = EDungeonHallwaySearch::Bidirectional;
+	Params.BidirectionalMinDistance = 0;
+
+	const FIntVector Start(2, 2, 0);
+	const FIntVector End(25, 5, 2);
+
+	TArray<FIntVector> Path;
+	const bool bFound = FHallwayPathfinder::FindPath(Grid, Start, End, Params, 0, 0, Path);
+
+	TestTrue(TEXT("Path found"), bFound);
+	TestTrue(TEXT("Path is continuous"), HallwayPathfinderTestHelpers::IsPathContinuous(Path));
+	TestEqual(TEXT("Starts at Start"), Path.Num() > 0 ? Path[0] : FIntVector(-1), Start);
+	TestEqual(TEXT("Ends at End"), Path.Num() > 0 ? Path.Last() : FIntVector(-1), End);
+
+	for (int32 i = 1; i < Path.Num(); ++i)
+	{
+		if (Path[i].Z != Path[i - 1].Z)
+		{
+			const FIntVector Delta = Path[i] - Path[i - 1];
+			TestEqual(TEXT("Staircase spans RiseToRun+1 cells"),
+				FMath::Abs(Delta.X) + FMath::Abs(Delta.Y), Params.StaircaseRiseToRun + 1);
+		}
+	}
+	return true;
+}
+
+// ============================================================================
+// Hallway cells cost less than a Manhattan step: bidirectional search must not stop early
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHallwayPathBidiCarvedCost, "Dungeon.Pathfinder.Bidirectional.CarvedHallwaysNoCostlierThanAStar",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FHallwayPathBidiCarvedCost::RunTest(const FString& Parameters)
+{
+	using namespace HallwayPathfinderTestHelpers;
+
+	FDungeonGenerationParams AStarParams;
+	FDungeonGenerationParams BidiParams;
+	BidiParams.HallwaySearchMode = EDungeonHallwaySearch::Bidirectional;
+	BidiParams.BidirectionalMinDistance = 0;
+
+	// An existing hallway off to the side of the straight route. Stopping on the unscaled
+	// Manhattan heuristic met the frontiers on a path costing 38; A* finds 37.
+	{
+		FDungeonGrid Grid;
+		Grid.Initialize(FIntVector(40, 20, 1));
+		for (int32 X = 10; X < 30; ++X)
+		{
+			Grid.GetCellForWrite(X, 10, 0).CellType = EDungeonCellType::Hallway;
+		}
+
+		TArray<FIntVector> AStarPath;
+		TArray<FIntVector> BidiPath;
+		FHallwayPathfinder::FindPath(Grid, FIntVector(2, 4, 0), FIntVector(37, 16, 0), AStarParams, 0, 0, AStarPath);
+		const bool bFound = FHallwayPathfinder::FindPath(Grid, FIntVector(2, 4, 0), FIntVector(37, 16, 0), BidiParams, 0, 0, BidiPath);
+
+		TestTrue(TEXT("Path found"), bFound);
+		TestTrue(TEXT("Path is continuous"), IsPathContinuous(BidiPath));
+		TestEqual(TEXT("Bidirectional cost equals A* cost"),
+			SingleFloorPathCost(Grid, BidiPath, BidiParams), SingleFloorPathCost(Grid, AStarPath, AStarParams), 1.0e-3f);
+	}
+
+	// Random pre-carved hallway runs: A* itself can overpay here, bidirectional never pays more
+	FDungeonSeed Rng(808);
+	for (int32 Trial = 0; Trial < 30; ++Trial)
+	{
+		FDungeonGrid Grid;
+		Grid.Initialize(FIntVector(40, 30, 1));
+		const int32 NumRuns = Rng.RandRange(2, 8);
+		for (int32 Run = 0; Run < NumRuns; ++Run)
+		{
+			const bool bAlongX = Rng.RandRange(0, 1) == 0;
+			const int32 Fixed = Rng.RandRange(0, bAlongX ? 29 : 39);
+			const int32 From = Rng.RandRange(0, bAlongX ? 39 : 29);
+			const int32 To = FMath::Min(From + Rng.RandRange(5, 30), bAlongX ? 40 : 30);
+			for (int32 i = From; i < To; ++i)
+			{
+				Grid.GetCellForWrite(bAlongX ? i : Fixed, bAlongX ? Fixed : i, 0).CellType = EDungeonCellType::Hallway;
+			}
+		}
+
+		const FIntVector Start(Rng.RandRange(0, 4), Rng.RandRange(0, 29), 0);
+		const FIntVector End(Rng.RandRange(35, 39), Rng.RandRange(0, 29), 0);
+
+		TArray<FIntVector> AStarPath;
+		TArray<FIntVector> BidiPath;
+		FHallwayPathfinder::FindPath(Grid, Start, End, AStarParams, 0, 0, AStarPath);
+		FHallwayPathfinder::FindPath(Grid, Start, End, BidiParams, 0, 0, BidiPath);
+
+		TestTrue(FString::Printf(TEXT("Trial %d: continuous"), Trial), IsPathContinuous(BidiPath));
+		TestTrue(FString::Printf(TEXT("Trial %d: bidirectional no costlier than A*"), Trial),
+			SingleFloorPathCost(Grid, BidiPath, BidiParams) <= SingleFloorPathCost(Grid, AStarPath, AStarParams) + 1.0e-3f);
+	}
+	return true;
+}
+
+// ============================================================================
+// Benchmark: bidirectional vs unidirectional on 100x100x8
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHallwayPathBidiBenchmark, "Dungeon.Pathfinder.Benchmark.BidirectionalVsAStar",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FHallwayPathBidiBenchmark::RunTest(const FString& Parameters)
+{
+	using HallwayPathfinderTestHelpers::FQuery;
+
+	const FIntVector GridSize(100, 100, 8);
+	const FDungeonGrid Grid = HallwayPathfinderTestHelpers::CreateScatteredGrid(GridSize, 0.15f, 1234);
+
+	// Long cross-dungeon edges: start in the left fifth, end in the right fifth
+	FDungeonSeed QuerySeed(99);
+	TArray<FQuery> Queries;
+	for (int32 i = 0; i < 40; ++i)
+	{
+		const FIntVector Start = HallwayPathfinderTestHelpers::RandomEmptyCell(Grid, QuerySeed, 0, 19);
+		const FIntVector End = HallwayPathfinderTestHelpers::RandomEmptyCell(Grid, QuerySeed, 80, 99);
+		Queries.Add(FQuery{Start, End});
+	}
+
+	FDungeonGenerationParams UniParams;
+	FDungeonGenerationParams BidiParams;
+	BidiParams.HallwaySearchMode = EDungeonHallwaySearch::Bidirectional;
+	BidiParams.BidirectionalMinDistance = 0;
+
+	FPathfinderWorkspace Workspace;
+	FPathfindStats UniTotals;
+	FPathfindStats BidiTotals;
+	int64 UniCells = 0;
+	int64 BidiCells = 0;
+
+	for (int32 i = 0; i < Queries.Num(); ++i)
+	{
+		const FQuery& Query = Queries[i];
+
+		TArray<FIntVector> UniPath;
+		FPathfindStats UniStats;
+		const bool bUniFound = FHallwayPathfinder::FindPath(
+			Grid, Query.Start, Query.End, UniParams, 0, 0, UniPath, &UniStats, &Workspace);
+
+		TArray<FIntVector> BidiPath;
+		FPathfindStats BidiStats;
+		const bool bBidiFound = FHallwayPathfinder::FindPath(
+			Grid, Query.Start, Query.End, BidiParams, 0, 0, BidiPath, &BidiStats, &Workspace);
+
+		TestEqual(FString::Printf(TEXT("Query %d: both searches agree a path exists"), i), bBidiFound, bUniFound);
+		TestTrue(FString::Printf(TEXT("Query %d: bidirectional path continuous"), i),
+			HallwayPathfinderTestHelpers::IsPathContinuous(BidiPath));
+
+		UniTotals += UniStats;
+		BidiTotals += BidiStats;
+		UniCells += UniPath.Num();
+		BidiCells += BidiPath.Num();
+	}
+
+	AddInfo(FString::Printf(TEXT("A*:            %.2fms, %d pops, %d pushes, %lld path cells"),
+		UniTotals.WallTimeMs, UniTotals.NodesPopped, UniTotals.NodesPushed, UniCells));
+	AddInfo(FString::Printf(TEXT("Bidirectional: %.2fms, %d pops, %d pushes, %lld path cells"),
+		BidiTotals.WallTimeMs, BidiTotals.NodesPopped, BidiTotals.NodesPushed, BidiCells));
+	return true;
+}
+
+// ============================================================================
+// Jump point search finds equally short paths with fewer pushes
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHallwayPathJumpPointMatchesAStar, "Dungeon.Pathfinder.JumpPoint.MatchesAStarLength",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FHallwayPathJumpPointMatchesAStar::RunTest(const FString& Parameters)
+{
+	using HallwayPathfinderTestHelpers::FQuery;
+
+	// Single floor of Empty + blocked cells only: every step costs 1, so both searches are optimal
+	const FDungeonGrid Grid = HallwayPathfinderTestHelpers::CreateScatteredGrid(FIntVector(60, 60, 1), 0.2f, 77);
+
+	FDungeonGenerationParams AStarParams;
+	FDungeonGenerationParams JumpParams;
+	JumpParams.HallwaySearchMode = EDungeonHallwaySearch::JumpPoint;
+
+	FDungeonSeed QuerySeed(5);
+	FPathfinderWorkspace Workspace;
+	int32 AStarPushes = 0;
+	int32 JumpPushes = 0;
+
+	for (int32 i = 0; i < 20; ++i)
+	{
+		const FIntVector Start = HallwayPathfinderTestHelpers::RandomEmptyCell(Grid, QuerySeed, 0, 59);
+		const FIntVector End = HallwayPathfinderTestHelpers::RandomEmptyCell(Grid, QuerySeed, 0, 59);
+
+		TArray<FIntVector> AStarPath;
+		FPathfindStats AStarStats;
+		const bool bAStarFound = FHallwayPathfinder::FindPath(
+			Grid, Start, End, AStarParams, 0, 0, AStarPath, &AStarStats, &Workspace);
+
+		TArray<FIntVector> JumpPath;
+		FPathfindStats JumpStats;
+		const bool bJumpFound = FHallwayPathfinder::FindPath(
+			Grid, Start, End, JumpParams, 0, 0, JumpPath, &JumpStats, &Workspace);
+
+		TestEqual(FString::Printf(TEXT("Query %d: same found flag"), i), bJumpFound, bAStarFound);
+		TestEqual(FString::Printf(TEXT("Query %d: same path length"), i), JumpPath.Num(), AStarPath.Num());
+		TestTrue(FString::Printf(TEXT("Query %d: jump path continuous"), i),
+			HallwayPathfinderTestHelpers::IsPathContinuous(JumpPath));
+
+		AStarPushes += AStarStats.NodesPushed;
+		JumpPushes += JumpStats.NodesPushed;
+	}
+
+	TestTrue(TEXT("Jump points push fewer nodes overall"), JumpPushes < AStarPushes);
+	AddInfo(FString::Printf(TEXT("A* pushes: %d, jump point pushes: %d"), AStarPushes, JumpPushes));
+	return true;
+}
+
+// ============================================================================
+// Jump point search still steps onto non-uniform cells one at a time
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHallwayPathJumpPointCrossesHallway, "Dungeon.Pathfinder.JumpPoint.CrossesHallwayCellByCell",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FHallwayPathJumpPointCrossesHallway::RunTest(const FString& Parameters)
+{
+	// An existing hallway runs along X=20 and crosses the straight route
+	FDungeonGrid Grid;
+	Grid.Initialize(FIntVector(40, 20, 1));
+	for (int32 Y = 0; Y < 20; ++Y)
+	{
+		Grid.GetCellForWrite(20, Y, 0).CellType = EDungeonCellType::Hallway;
+	}
+
+	FDungeonGenerationParams Params;
+	Params.HallwaySearchMode = EDungeonHallwaySearch::JumpPoint;
+
+	TArray<FIntVector> Path;
+	FPathfindStats Stats;
+	const bool bFound = FHallwayPathfinder::FindPath(
+		Grid, FIntVector(2, 5, 0), FIntVector(36, 5, 0), Params, 0, 0, Path, &Stats);
+
+	TestTrue(TEXT("Path found"), bFound);
+	TestTrue(TEXT("Path is continuous"), HallwayPathfinderTestHelpers::IsPathContinuous(Path));
+	TestEqual(TEXT("Straight route length"), Path.Num(), 35);
+	TestTrue(TEXT("Route crosses the hallway cell"), Path.Contains(FIntVector(20, 5, 0)));
+	TestTrue(TEXT("Scans covered cells that were never pushed"), Stats.JumpScanCells > 0);
+	return true;
+}
+
+// ============================================================================
+// Radix open set pops in key order and never below the last pop
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHallwayPathRadixOrder, "Dungeon.Pathfinder.RadixOpenSet.PopsInKeyOrder",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FHallwayPathRadixOrder::RunTest(const FString& Parameters)
+{
+	// CellIdx indexes Scores so each pop can be checked against the key it was pushed with
+	FDungeonSeed Rng(31);
+	TArray<float> Scores;
+	FRadixOpenSet OpenSet;
+	for (int32 i = 0; i < 500; ++i)
+	{
+		Scores.Add(Rng.FRand() * 400.0f);
+		OpenSet.Push(Scores.Last(), i);
+	}
+	TestEqual(TEXT("All entries counted"), OpenSet.Num(), 500);
+
+	uint32 LastKey = 0;
+	bool bOrdered = true;
+	for (int32 i = 0; i < 250; ++i)
+	{
+		const uint32 Key = FRadixOpenSet::Quantize(Scores[OpenSet.Pop()]);
+		bOrdered &= Key >= LastKey;
+		LastKey = Key;
+	}
+	TestTrue(TEXT("First half pops in non-decreasing key order"), bOrdered);
+
+	// A key below the last pop (inconsistent heuristic) is clamped up and comes out next
+	Scores.Add(0.0f);
+	OpenSet.Push(0.0f, Scores.Num() - 1);
+	TestEqual(TEXT("Late low key pops first"), OpenSet.Pop(), Scores.Num() - 1);
+
+	while (OpenSet.Num() > 0)
+	{
+		const uint32 Key = FRadixOpenSet::Quantize(Scores[OpenSet.Pop()]);
+		bOrdered &= Key >= LastKey;
+		LastKey = Key;
+	}
+	TestTrue(TEXT("Remaining pops stay ordered"), bOrdered);
+
+	OpenSet.Reset();
+	OpenSet.Push(1.0f, 7);
+	TestEqual(TEXT("Reset set is reusable"), OpenSet.Pop(), 7);
+	return true;
+}
+
+// ============================================================================
+// Radix open set finds paths as short as the binary heap
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHallwayPathRadixMatchesHeap, "Dungeon.Pathfinder.RadixOpenSet.MatchesHeapLength",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FHallwayPathRadixMatchesHeap::RunTest(const FString& Parameters)
+{
+	// Uniform step costs: F scores are whole numbers, so quantization is exact and both are optimal
+	const FDungeonGrid Grid = HallwayPathfinderTestHelpers::CreateScatteredGrid(FIntVector(60, 60, 1), 0.2f, 41);
+
+	FDungeonGenerationParams HeapParams;
+	FDungeonGenerationParams RadixParams;
+	RadixParams.bUseRadixOpenSet = true;
+
+	FDungeonSeed QuerySeed(8);
+	FPathfinderWorkspace Workspace;
+
+	for (int32 i = 0; i < 20; ++i)
+	{
+		const FIntVector Start = HallwayPathfinderTestHelpers::RandomEmptyCell(Grid, QuerySeed, 0, 59);
+		const FIntVector End = HallwayPathfinderTestHelpers::RandomEmptyCell(Grid, QuerySeed, 0, 59);
+
+		TArray<FIntVector> HeapPath;
+		const bool bHeapFound = FHallwayPathfinder::FindPath(
+			Grid, Start, End, HeapParams, 0, 0, HeapPath, nullptr, &Workspace);
+
+		TArray<FIntVector> RadixPath;
+		const bool bRadixFound = FHallwayPathfinder::FindPath(
+			Grid, Start, End, RadixParams, 0, 0, RadixPath, nullptr, &Workspace);
+
+		TestEqual(FString::Printf(TEXT("Query %d: same found flag"), i), bRadixFound, bHeapFound);
+		TestEqual(FString::Printf(TEXT("Query %d: same path length"), i), RadixPath.Num(), HeapPath.Num());
+		TestTrue(FString::Printf(TEXT("Query %d: radix path continuous"), i),
+			HallwayPathfinderTestHelpers::IsPathContinuous(RadixPath));
+	}
+	return true;
+}
+
+// ============================================================================
+// Benchmark: radix open set vs binary heap on 100x100x8
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHallwayPathRadixBenchmark, "Dungeon.Pathfinder.Benchmark.RadixVsHeap",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FHallwayPathRadixBenchmark::RunTest(const FString& Parameters)
+{
+	const FDungeonGrid Grid = HallwayPathfinderTestHelpers::CreateScatteredGrid(FIntVector(100, 100, 8), 0.15f, 1234);
+
+	FDungeonGenerationParams HeapParams;
+	FDungeonGenerationParams RadixParams;
+	RadixParams.bUseRadixOpenSet = true;
+
+	FDungeonSeed QuerySeed(99);
+	FPathfinderWorkspace Workspace;
+	FPathfindStats HeapTotals;
+	FPathfindStats RadixTotals;
+
+	for (int32 i = 0; i < 40; ++i)
+	{
+		const FIntVector Start = HallwayPathfinderTestHelpers::RandomEmptyCell(Grid, QuerySeed, 0, 19);
+		const FIntVector End = HallwayPathfinderTestHelpers::RandomEmptyCell(Grid, QuerySeed, 80, 99);
+
+		TArray<FIntVector> Path;
+		FPathfindStats HeapStats;
+		const bool bHeapFound = FHallwayPathfinder::FindPath(
+			Grid, Start, End, HeapParams, 0, 0, Path, &HeapStats, &Workspace);
+
+		FPathfindStats RadixStats;
+		const bool bRadixFound = FHallwayPathfinder::FindPath(
+			Grid, Start, End, RadixParams, 0, 0, Path, &RadixStats, &Workspace);
+
+		TestEqual(FString::Printf(TEXT("Query %d: both open sets agree a path exists"), i), bRadixFound, bHeapFound);
+
+		HeapTotals += HeapStats;
+		RadixTotals += RadixStats;
+	}
+
+	AddInfo(FString::Printf(TEXT("Binary heap: %.2fms, %d pops, %d pushes, peak %d"),
+		HeapTotals.WallTimeMs, HeapTotals.NodesPopped, HeapTotals.NodesPushed, HeapTotals.PeakOpenSetSize));
+	AddInfo(FString::Printf(TEXT("Radix heap:  %.2fms, %d pops, %d pushes, peak %d"),
+		RadixTotals.WallTimeMs, RadixTotals.NodesPopped, RadixTotals.NodesPushed, RadixTotals.PeakOpenSetSize));
+	return true;
+}
+
+// ============================================================================
+// Benchmark: specialized search kernels (flat, fixed 2:1 staircases) vs the generic one
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHallwayPathKernelBenchmark, "Dungeon.Pathfinder.Benchmark.KernelSpecializations",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FHallwayPathKernelBenchmark::RunTest(const FString& Parameters)
+{
+	struct FCase
+	{
+		const TCHAR* Name;
+		FIntVector GridSize;
+		int32 RiseToRun;
+		int32 Headroom;
+	};
+	const FCase Cases[] = {
+		{ TEXT("Flat <false,0,0>   "), FIntVector(100, 100, 1), 2, 2 },
+		{ TEXT("2:1/2 <true,2,2>   "), FIntVector(100, 100, 8), 2, 2 },
+		{ TEXT("Generic <true,0,0> "), FIntVector(100, 100, 8), 2, 3 },
+	};
+
+	for (const FCase& Case : Cases)
+	{
+		const FDungeonGrid Grid = HallwayPathfinderTestHelpers::CreateScatteredGrid(Case.GridSize, 0.15f, 1234);
+		FDungeonGenerationParams Params;
+		Params.StaircaseRiseToRun = Case.RiseToRun;
+		Params.StaircaseHeadroom = Case.Headroom;
+
+		FDungeonSeed QuerySeed(99);
+		FPathfinderWorkspace Workspace;
+		FPathfindStats Totals;
+		for (int32 i = 0; i < 40; ++i)
+		{
+			const FIntVector Start = HallwayPathfinderTestHelpers::RandomEmptyCell(Grid, QuerySeed, 0, 19);
+			const FIntVector End = HallwayPathfinderTestHelpers::RandomEmptyCell(Grid, QuerySeed, 80, 99);
+
+			TArray<FIntVector> Path;
+			FPathfindStats Stats;
+			FHallwayPathfinder::FindPath(Grid, Start, End, Params, 0, 0, Path, &Stats, &Workspace);
+			TestTrue(FString::Printf(TEXT("%s query %d: path continuous"), Case.Name, i),
+				HallwayPathfinderTestHelpers::IsPathContinuous(Path));
+			Totals += Stats;
+		}
+
+		AddInfo(FString::Printf(TEXT("%s %.2fms, %d pops, %.1fns/pop"), Case.Name, Totals.WallTimeMs, Totals.NodesPopped,
+			Totals.NodesPopped > 0 ? Totals.WallTimeMs * 1.0e6 / Totals.NodesPopped : 0.0));
+	}
+	return true;
+}
+
+// ============================================================================
+// Cached staircase masks survive carving: reused workspace still matches a fresh one
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHallwayPathStairMaskCarve, "Dungeon.Pathfinder.StaircaseMask.CarveInvalidationMatchesFresh",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FHallwayPathStairMaskCarve::RunTest(const FString& Parameters)
+{
+	using HallwayPathfinderTestHelpers::FQuery;
+
+	FDungeonGrid Grid = HallwayPathfinderTestHelpers::CreateWalledGrid(FIntVector(30, 30, 4), 12, 20);
+	const FDungeonGenerationParams Params;
+
+	// Each hallway climbs floors, and later ones have to route around earlier staircases
+	const FQuery Queries[] = {
+		{ FIntVector(2, 2, 0), FIntVector(25, 5, 2) },
+		{ FIntVector(3, 8, 0), FIntVector(24, 8, 1) },
+		{ FIntVector(2, 25, 2), FIntVector(26, 3, 0) },
+		{ FIntVector(5, 5, 1), FIntVector(20, 24, 3) },
+		{ FIntVector(2, 2, 0), FIntVector(25, 5, 2) },
+	};
+
+	FPathfinderWorkspace Workspace;
+	for (int32 i = 0; i < UE_ARRAY_COUNT(Queries); ++i)
+	{
+		const FQuery& Query = Queries[i];
+
+		TArray<FIntVector> FreshPath;
+		const bool bFreshFound = FHallwayPathfinder::FindPath(
+			Grid, Query.Start, Query.End, Params, 0, 0, FreshPath);
+
+		TArray<FIntVector> CachedPath;
+		const bool bCachedFound = FHallwayPathfinder::FindPath(
+			Grid, Query.Start, Query.End, Params, 0, 0, CachedPath, nullptr, &Workspace);
+
+		TestEqual(FString::Printf(TEXT("Query %d: same found flag"), i), bCachedFound, bFreshFound);
+		TestTrue(FString::Printf(TEXT("Query %d: same path"), i), CachedPath == FreshPath);
+
+		if (bCachedFound)
+		{
+			TArray<FDungeonStaircase> Staircases;
+			FHallwayPathfinder::CarveHallway(
+				Grid, CachedPath, static_cast<uint8>(i + 1), 0, 0, Params, Staircases, &Workspace);
+		}
+	}
+	return true;
+}
+
+// ============================================================================
+// Repeating a search on an unchanged grid reuses every cached mask
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHallwayPathStairMaskReuse, "Dungeon.Pathfinder.StaircaseMask.ReuseSkipsRecompute",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FHallwayPathStairMaskReuse::RunTest(const FString& Parameters)
+{
+	const FDungeonGrid Grid = HallwayPathfinderTestHelpers::CreateWalledGrid(FIntVector(30, 30, 4), 12, 20);
+	const FDungeonGenerationParams Params;
+	FPathfinderWorkspace Workspace;
+
+	TArray<FIntVector> Path;
+	FPathfindStats FirstStats;
+	FHallwayPathfinder::FindPath(Grid, FIntVector(2, 2, 0), FIntVector(25, 5, 2), Params, 0, 0, Path, &FirstStats, &Workspace);
+
+	FPathfindStats SecondStats;
+	FHallwayPathfinder::FindPath(Grid, FIntVector(2, 2, 0), FIntVector(25, 5, 2), Params, 0, 0, Path, &SecondStats, &Workspace);
+
+	TestTrue(TEXT("First search builds masks"), FirstStats.StaircaseMaskMisses > 0);
+	TestEqual(TEXT("Second search builds none"), SecondStats.StaircaseMaskMisses, 0);
+	TestEqual(TEXT("Probe counts unchanged"), SecondStats.StaircaseProbes, FirstStats.StaircaseProbes);
+	return true;
+}
+
+// ============================================================================
+// Masks are dropped after an edit nobody reported
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHallwayPathStairMaskUnreported, "Dungeon.Pathfinder.StaircaseMask.UnreportedEditMatchesFresh",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FHallwayPathStairMaskUnreported::RunTest(const FString& Parameters)
+{
+	FDungeonGrid Grid = HallwayPathfinderTestHelpers::CreateWalledGrid(FIntVector(30, 30, 4), 12, 20);
+	const FDungeonGenerationParams Params;
+	const FIntVector Start(2, 2, 0);
+	const FIntVector End(25, 5, 2);
+	FPathfinderWorkspace Workspace;
+
+	TArray<FIntVector> FirstPath;
+	FHallwayPathfinder::FindPath(Grid, Start, End, Params, 0, 0, FirstPath, nullptr, &Workspace);
+
+	// Block the entry cell of every staircase the first path took, without telling the workspace
+	for (int32 i = 1; i < FirstPath.Num(); ++i)
+	{
+		if (FirstPath[i].Z != FirstPath[i - 1].Z && FirstPath[i - 1] != Start)
+		{
+			Grid.GetCellForWrite(FirstPath[i - 1]).CellType = EDungeonCellType::Staircase;
+		}
+	}
+
+	TArray<FIntVector> FreshPath;
+	const bool bFreshFound = FHallwayPathfinder::FindPath(Grid, Start, End, Params, 0, 0, FreshPath);
+	TArray<FIntVector> CachedPath;
+	const bool bCachedFound = FHallwayPathfinder::FindPath(Grid, Start, End, Params, 0, 0, CachedPath, nullptr, &Workspace);
+
+	TestEqual(TEXT("Same found flag"), bCachedFound, bFreshFound);
+	TestTrue(TEXT("Same path"), CachedPath == FreshPath);
+	TestTrue(TEXT("Path avoids the blocked entries"), CachedPath != FirstPath);
+	return true;
+}
+
+// ============================================================================
+// Shared cost field honours each search's own source/dest rooms
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHallwayPathCostFieldOverride, "Dungeon.Pathfinder.CostField.RoomOverrideMatchesFresh",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FHallwayPathCostFieldOverride::RunTest(const FString& Parameters)
+{
+	// Three two-floor rooms in a row; the middle one sits across the straight route
+	FDungeonGrid Grid;
+	Grid.Initialize(FIntVector(30, 12, 2));
+	auto AddRoom = [&Grid](uint8 RoomIndex, int32 MinX, int32 MaxX)
+	{
+		for (int32 Z = 0; Z < 2; ++Z)
+		{
+			for (int32 Y = 2; Y <= 9; ++Y)
+			{
+				for (int32 X = MinX; X <= MaxX; ++X)
+				{
+					const bool bWall = X == MinX || X == MaxX || Y == 2 || Y == 9;
+					FDungeonCell& Cell = Grid.GetCellForWrite(X, Y, Z);
+					Cell.CellType = bWall ? EDungeonCellType::RoomWall : EDungeonCellType::Room;
+					Cell.RoomIndex = RoomIndex;
+				}
+			}
+		}
+	};
+	AddRoom(1, 1, 6);
+	AddRoom(2, 12, 17);
+	AddRoom(3, 23, 28);
+
+	const FDungeonGenerationParams Params;
+	struct FRoomQuery
+	{
+		FIntVector Start;
+		FIntVector End;
+		uint8 SourceRoomIdx;
+		uint8 DestRoomIdx;
+	};
+	const FRoomQuery Queries[] = {
+		{ FIntVector(3, 5, 0), FIntVector(26, 5, 0), 1, 3 },
+		{ FIntVector(3, 5, 0), FIntVector(15, 5, 0), 1, 2 },
+		{ FIntVector(14, 6, 0), FIntVector(26, 6, 0), 2, 3 },
+		{ FIntVector(3, 5, 0), FIntVector(26, 5, 0), 0, 0 },
+		{ FIntVector(3, 5, 0), FIntVector(26, 5, 0), 1, 3 },
+	};
+
+	FPathfinderWorkspace Workspace;
+	for (int32 i = 0; i < UE_ARRAY_COUNT(Queries); ++i)
+	{
+		const FRoomQuery& Query = Queries[i];
+
+		TArray<FIntVector> FreshPath;
+		const bool bFreshFound = FHallwayPathfinder::FindPath(
+			Grid, Query.Start, Query.End, Params, Query.SourceRoomIdx, Query.DestRoomIdx, FreshPath);
+
+		TArray<FIntVector> ReusedPath;
+		const bool bReusedFound = FHallwayPathfinder::FindPath(
+			Grid, Query.Start, Query.End, Params, Query.SourceRoomIdx, Query.DestRoomIdx, ReusedPath, nullptr, &Workspace);
+
+		TestEqual(FString::Printf(TEXT("Query %d: same found flag"), i), bReusedFound, bFreshFound);
+		TestTrue(FString::Printf(TEXT("Query %d: same path"), i), ReusedPath == FreshPath);
+
+		bool bAvoidsRoomAirspace = true;
+		for (const FIntVector& Cell : ReusedPath)
+		{
+			bAvoidsRoomAirspace &= !(Cell.Z == 1 && Grid.GetCell(Cell).CellType == EDungeonCellType::Room);
+		}
+		TestTrue(FString::Printf(TEXT("Query %d: never enters upper room cells"), i), bAvoidsRoomAirspace);
+	}
+	return true;
+}
+
+// ============================================================================
+// Cost field follows the grid revision, not the grid's address
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHallwayPathCostFieldRevision, "Dungeon.Pathfinder.CostField.UnreportedEditMatchesFresh",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FHallwayPathCostFieldRevision::RunTest(const FString& Parameters)
+{
+	const FDungeonGenerationParams Params;
+	const FIntVector Start(2, 2, 0);
+	const FIntVector End(27, 9, 0);
+	FPathfinderWorkspace Workspace;
+
+	auto CompareWithFresh = [this, &Params, &Start, &End, &Workspace](const FDungeonGrid& Grid, const TCHAR* What)
+	{
+		TArray<FIntVector> FreshPath;
+		FHallwayPathfinder::FindPath(Grid, Start, End, Params, 0, 0, FreshPath);
+		TArray<FIntVector> ReusedPath;
+		FHallwayPathfinder::FindPath(Grid, Start, End, Params, 0, 0, ReusedPath, nullptr, &Workspace);
+		TestTrue(FString::Printf(TEXT("%s: same path"), What), ReusedPath == FreshPath);
+	};
+
+	FDungeonGrid Grid;
+	Grid.Initialize(FIntVector(30, 12, 1));
+	CompareWithFresh(Grid, TEXT("Empty grid"));
+
+	// Carve a cheap hallway row without telling the workspace
+	for (int32 X = 4; X < 26; ++X)
+	{
+		Grid.GetCellForWrite(X, 6, 0).CellType = EDungeonCellType::Hallway;
+	}
+	CompareWithFresh(Grid, TEXT("Unreported GetCell writes"));
+
+	FDungeonCell Wall;
+	Wall.CellType = EDungeonCellType::Staircase;
+	Grid.FillBox(FIntVector(14, 0, 0), FIntVector(15, 10, 1), Wall);
+	CompareWithFresh(Grid, TEXT("Unreported FillBox"));
+
+	// Same-sized grids built in turn on the stack tend to share an address
+	for (int32 WallX = 8; WallX < 24; WallX += 5)
+	{
+		FDungeonGrid StackGrid = HallwayPathfinderTestHelpers::CreateWalledGrid(FIntVector(30, 12, 1), WallX, 9);
+		CompareWithFresh(StackGrid, *FString::Printf(TEXT("Stack grid with wall at %d"), WallX));
+	}
+	return true;
+}
+
+// ============================================================================
+// Multi-goal search runs boundary to boundary and skips the room interiors
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHallwayPathMultiGoal, "Dungeon.Pathfinder.MultiGoal.BoundaryToBoundary",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FHallwayPathMultiGoal::RunTest(const FString& Parameters)
+{
+	FDungeonGrid Grid;
+	Grid.Initialize(FIntVector(40, 20, 1));
+
+	FDungeonRoom RoomA;
+	RoomA.RoomIndex = 1;
+	RoomA.Position = FIntVector(2, 4, 0);
+	RoomA.Size = FIntVector(7, 9, 1);
+
+	FDungeonRoom RoomB;
+	RoomB.RoomIndex = 2;
+	RoomB.Position = FIntVector(28, 6, 0);
+	RoomB.Size = FIntVector(8, 7, 1);
+
+	for (const FDungeonRoom* Room : {&RoomA, &RoomB})
+	{
+		for (int32 Y = Room->Position.Y; Y < Room->Position.Y + Room->Size.Y; ++Y)
+		{
+			for (int32 X = Room->Position.X; X < Room->Position.X + Room->Size.X; ++X)
+			{
+				FDungeonCell& Cell = Grid.GetCellForWrite(X, Y, 0);
+				Cell.CellType = EDungeonCellType::Room;
+				Cell.RoomIndex = Room->RoomIndex;
+			}
+		}
+	}
+
+	TArray<FIntVector> StartCells;
+	TArray<FIntVector> GoalCells;
+	FHallwayPathfinder::GetRoomBoundaryCells(RoomA, StartCells);
+	FHallwayPathfinder::GetRoomBoundaryCells(RoomB, GoalCells);
+	TestEqual(TEXT("Room A perimeter size"), StartCells.Num(), 2 * (7 + 9) - 4);
+
+	FDungeonGenerationParams Params;
+	Params.bMultiGoalHallwaySearch = true;
+
+	TArray<FIntVector> Path;
+	FPathfindStats Stats;
+	const bool bFound = FHallwayPathfinder::FindPath(
+		Grid, StartCells, GoalCells, Params, RoomA.RoomIndex, RoomB.RoomIndex, Path, &Stats);
+
+	TestTrue(TEXT("Path found"), bFound);
+	TestTrue(TEXT("Path is continuous"), HallwayPathfinderTestHelpers::IsPathContinuous(Path));
+	TestTrue(TEXT("Starts on room A's boundary"), Path.Num() > 0 && StartCells.Contains(Path[0]));
+	TestTrue(TEXT("Ends on room B's boundary"), Path.Num() > 0 && GoalCells.Contains(Path.Last()));
+	TestEqual(TEXT("Straight across the gap"), Path.Num(), 28 - (2 + 7 - 1) + 1);
+
+	const FIntVector CenterA = RoomA.Position + FIntVector(RoomA.Size.X / 2, RoomA.Size.Y / 2, 0);
+	const FIntVector CenterB = RoomB.Position + FIntVector(RoomB.Size.X / 2, RoomB.Size.Y / 2, 0);
+	TArray<FIntVector> CenterPath;
+	FPathfindStats CenterStats;
+	FHallwayPathfinder::FindPath(
+		Grid, CenterA, CenterB, Params, RoomA.RoomIndex, RoomB.RoomIndex, CenterPath, &CenterStats);
+
+	TestTrue(TEXT("Shorter than center to center"), Path.Num() < CenterPath.Num());
+	AddInfo(FString::Printf(TEXT("Boundary pops: %d, center pops: %d"), Stats.NodesPopped, CenterStats.NodesPopped));
+
+	// Carving puts a door on each endpoint
+	TArray<FDungeonStaircase> Staircases;
+	FHallwayPathfinder::CarveHallway(Grid, Path, 1, RoomA.RoomIndex, RoomB.RoomIndex, Params, Staircases);
+	TestEqual(TEXT("Door at start"), Grid.GetCell(Path[0]).CellType, EDungeonCellType::Door);
+	TestEqual(TEXT("Door at end"), Grid.GetCell(Path.Last()).CellType, EDungeonCellType::Door);
+	return true;
+}
+
+// ============================================================================
+// Center-to-center carving leaves the path's endpoints as room cells
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHallwayPathCenterEndpoints, "Dungeon.Pathfinder.MultiGoal.CenterPathKeepsEndpointRooms",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FHallwayPathCenterEndpoints::RunTest(const FString& Parameters)
+{
+	// Two rooms one cell deep, so each center cell touches the hallway directly
+	FDungeonGrid Grid;
+	Grid.Initialize(FIntVector(20, 5, 1));
+	for (const TPair<int32, uint8>& Room : { TPair<int32, uint8>(2, 1), TPair<int32, uint8>(15, 2) })
+	{
+		for (int32 X = Room.Key; X < Room.Key + 2; ++X)
+		{
+			FDungeonCell& Cell = Grid.GetCellForWrite(X, 2, 0);
+			Cell.CellType = EDungeonCellType::Room;
+			Cell.RoomIndex = Room.Value;
+		}
+	}
+
+	const FDungeonGenerationParams Params;
+	const FIntVector CenterA(3, 2, 0);
+	const FIntVector CenterB(16, 2, 0);
+	TArray<FIntVector> Path;
+	TestTrue(TEXT("Path found"), FHallwayPathfinder::FindPath(Grid, CenterA, CenterB, Params, 1, 2, Path));
+
+	TArray<FDungeonStaircase> Staircases;
+	FHallwayPathfinder::CarveHallway(Grid, Path, 1, 1, 2, Params, Staircases);
+	TestEqual(TEXT("Start center stays a room cell"), Grid.GetCell(CenterA).CellType, EDungeonCellType::Room);
+	TestEqual(TEXT("End center stays a room cell"), Grid.GetCell(CenterB).CellType, EDungeonCellType::Room);
+	TestEqual(TEXT("Door where the hallway enters room B"), Grid.GetCell(15, 2, 0).CellType, EDungeonCellType::Door);
+	return true;
+}
+
+// ============================================================================
+// Hierarchical search climbs floors through staircase links and stays legal
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHallwayPathHierarchicalCrossFloor, "Dungeon.Pathfinder.Hierarchical.CrossFloorPath",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FHallwayPathHierarchicalCrossFloor::RunTest(const FString& Parameters)
+{
+	const FDungeonGrid Grid = HallwayPathfinderTestHelpers::CreateWalledGrid(FIntVector(48, 48, 4), 12, 20);
+	FDungeonGenerationParams Params;
+	Params.HallwaySearchMode = EDungeonHallwaySearch::Hierarchical;
+	Params.HierarchicalClusterSize = 16;
+	FPathfinderWorkspace Workspace;
+
+	// Same floor first: every leg is plain A* inside one cluster, so refinement can't fail
+	TArray<FIntVector> FlatPath;
+	FPathfindStats FlatStats;
+	const bool bFlatFound = FHallwayPathfinder::FindPath(
+		Grid, FIntVector(2, 2, 0), FIntVector(41, 37, 0), Params, 0, 0, FlatPath, &FlatStats, &Workspace);
+
+	TestTrue(TEXT("Same-floor path found"), bFlatFound);
+	TestTrue(TEXT("Same-floor path is continuous"), HallwayPathfinderTestHelpers::IsPathContinuous(FlatPath));
+	TestEqual(TEXT("Same-floor path refined without falling back"), FlatStats.HierarchicalFallbacks, 0);
+	TestEqual(TEXT("First search builds every cluster"), FlatStats.ClustersRebuilt, 3 * 3 * 4);
+
+	const FIntVector Start(2, 2, 0);
+	const FIntVector End(41, 37, 2);
+
+	TArray<FIntVector> Path;
+	FPathfindStats Stats;
+	const bool bFound = FHallwayPathfinder::FindPath(Grid, Start, End, Params, 0, 0, Path, &Stats, &Workspace);
+
+	TestTrue(TEXT("Path found"), bFound);
+	TestTrue(TEXT("Path is continuous"), HallwayPathfinderTestHelpers::IsPathContinuous(Path));
+	TestEqual(TEXT("Starts at Start"), Path.Num() > 0 ? Path[0] : FIntVector(-1), Start);
+	TestEqual(TEXT("Ends at End"), Path.Num() > 0 ? Path.Last() : FIntVector(-1), End);
+	TestEqual(TEXT("Unchanged grid reuses the graph"), Stats.ClustersRebuilt, 0);
+	AddInfo(FString::Printf(TEXT("Cross-floor fallbacks: %d"), Stats.HierarchicalFallbacks));
+
+	TSet<FIntVector> Visited;
+	for (int32 i = 0; i < Path.Num(); ++i)
+	{
+		bool bAlreadyInSet = false;
+		Visited.Add(Path[i], &bAlreadyInSet);
+		TestFalse(TEXT("No cell visited twice"), bAlreadyInSet);
+
+		if (i > 0 && Path[i].Z != Path[i - 1].Z)
+		{
+			const FIntVector Delta = Path[i] - Path[i - 1];
+			TestEqual(TEXT("Staircase spans RiseToRun+1 cells"),
+				FMath::Abs(Delta.X) + FMath::Abs(Delta.Y), Params.StaircaseRiseToRun + 1);
+		}
+	}
+	return true;
+}
+
+// ============================================================================
+// Incremental cluster graph updates match a graph built from scratch
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHallwayPathHierarchicalIncremental, "Dungeon.Pathfinder.Hierarchical.IncrementalMatchesRebuild",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FHallwayPathHierarchicalIncremental::RunTest(const FString& Parameters)
+{
+	using HallwayPathfinderTestHelpers::FQuery;
+
+	FDungeonGrid Grid = HallwayPathfinderTestHelpers::CreateWalledGrid(FIntVector(40, 40, 4), 12, 20);
+	FDungeonGenerationParams Params;
+	Params.HallwaySearchMode = EDungeonHallwaySearch::Hierarchical;
+	Params.HierarchicalClusterSize = 8;
+
+	const FQuery Queries[] = {
+		{ FIntVector(2, 2, 0), FIntVector(35, 5, 2) },
+		{ FIntVector(3, 8, 0), FIntVector(34, 30, 1) },
+		{ FIntVector(2, 35, 2), FIntVector(36, 3, 0) },
+		{ FIntVector(5, 5, 1), FIntVector(20, 34, 3) },
+	};
+
+	FPathfinderWorkspace Workspace;
+	for (int32 i = 0; i < UE_ARRAY_COUNT(Queries); ++i)
+	{
+		const FQuery& Query = Queries[i];
+
+		TArray<FIntVector> Path;
+		const bool bFound = FHallwayPathfinder::FindPath(
+			Grid, Query.Start, Query.End, Params, 0, 0, Path, nullptr, &Workspace);
+		TestTrue(FString::Printf(TEXT("Query %d: path found"), i), bFound);
+		if (!bFound)
+		{
+			continue;
+		}
+
+		TArray<FDungeonStaircase> Staircases;
+		FHallwayPathfinder::CarveHallway(
+			Grid, Path, static_cast<uint8>(i + 1), 0, 0, Params, Staircases, &Workspace);
+
+		// The next search brings the shared graph up to date; a new workspace builds one from scratch
+		TArray<FIntVector> Unused;
+		FPathfindStats IncrementalStats;
+		FHallwayPathfinder::FindPath(Grid, Query.Start, Query.End, Params, 0, 0, Unused, &IncrementalStats, &Workspace);
+
+		FPathfinderWorkspace FreshWorkspace;
+		FPathfindStats FreshStats;
+		FHallwayPathfinder::FindPath(Grid, Query.Start, Query.End, Params, 0, 0, Unused, &FreshStats, &FreshWorkspace);
+
+		TestTrue(FString::Printf(TEXT("Query %d: incremental graph matches rebuild"), i),
+			HallwayPathfinderTestHelpers::DescribeClusterGraph(Workspace.GetClusterGraph())
+				== HallwayPathfinderTestHelpers::DescribeClusterGraph(FreshWorkspace.GetClusterGraph()));
+		TestTrue(FString::Printf(TEXT("Query %d: only clusters near the hallway rebuilt"), i),
+			IncrementalStats.ClustersRebuilt < FreshStats.ClustersRebuilt);
+	}
+	return true;
+}
+
+// ============================================================================
+// Cluster graph follows the grid revision, not the grid's address
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHallwayPathHierarchicalUnreported, "Dungeon.Pathfinder.Hierarchical.UnreportedEditMatchesRebuild",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FHallwayPathHierarchicalUnreported::RunTest(const FString& Parameters)
+{
+	FDungeonGenerationParams Params;
+	Params.HallwaySearchMode = EDungeonHallwaySearch::Hierarchical;
+	Params.HierarchicalClusterSize = 8;
+	const FIntVector Start(2, 2, 0);
+	const FIntVector End(35, 5, 2);
+	FPathfinderWorkspace Workspace;
+
+	auto CompareWithRebuild = [this, &Params, &Start, &End, &Workspace](const FDungeonGrid& Grid, const TCHAR* What)
+	{
+		TArray<FIntVector> ReusedPath;
+		FHallwayPathfinder::FindPath(Grid, Start, End, Params, 0, 0, ReusedPath, nullptr, &Workspace);
+
+		FPathfinderWorkspace FreshWorkspace;
+		TArray<FIntVector> FreshPath;
+		FHallwayPathfinder::FindPath(Grid, Start, End, Params, 0, 0, FreshPath, nullptr, &FreshWorkspace);
+
+		TestTrue(FString::Printf(TEXT("%s: graph matches rebuild"), What),
+			HallwayPathfinderTestHelpers::DescribeClusterGraph(Workspace.GetClusterGraph())
+				== HallwayPathfinderTestHelpers::DescribeClusterGraph(FreshWorkspace.GetClusterGraph()));
+		TestTrue(FString::Printf(TEXT("%s: same path"), What), ReusedPath == FreshPath);
+	};
+
+	FDungeonGrid Grid = HallwayPathfinderTestHelpers::CreateWalledGrid(FIntVector(40, 40, 4), 12, 20);
+	CompareWithRebuild(Grid, TEXT("Initial grid"));
+
+	// A second wall the workspace is never told about
+	FDungeonCell Wall;
+	Wall.CellType = EDungeonCellType::Staircase;
+	Grid.FillBox(FIntVector(24, 10, 0), FIntVector(25, 40, 4), Wall);
+	CompareWithRebuild(Grid, TEXT("Unreported FillBox"));
+
+	// Same-sized grids built in turn on the stack tend to share an address
+	for (int32 WallX = 8; WallX < 32; WallX += 11)
+	{
+		FDungeonGrid StackGrid = HallwayPathfinderTestHelpers::CreateWalledGrid(FIntVector(40, 40, 4), WallX, 20);
+		CompareWithRebuild(StackGrid, *FString::Printf(TEXT("Stack grid with wall at %d"), WallX));
+	}
+	return true;
+}
+
+// ============================================================================
+// Benchmark: hierarchical vs A* on 256x256x4
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHallwayPathHierarchicalBenchmark, "Dungeon.Pathfinder.Benchmark.HierarchicalVsAStar",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FHallwayPathHierarchicalBenchmark::RunTest(const FString& Parameters)
+{
+	using HallwayPathfinderTestHelpers::FQuery;
+
+	const FIntVector GridSize(256, 256, 4);
+	const FDungeonGrid Grid = HallwayPathfinderTestHelpers::CreateScatteredGrid(GridSize, 0.15f, 4321);
+
+	FDungeonSeed QuerySeed(17);
+	TArray<FQuery> Queries;
+	for (int32 i = 0; i < 40; ++i)
+	{
+		const FIntVector Start = HallwayPathfinderTestHelpers::RandomEmptyCell(Grid, QuerySeed, 0, 49);
+		const FIntVector End = HallwayPathfinderTestHelpers::RandomEmptyCell(Grid, QuerySeed, 206, 255);
+		Queries.Add(FQuery{Start, End});
+	}
+
+	FDungeonGenerationParams AStarParams;
+	FDungeonGenerationParams HierParams;
+	HierParams.HallwaySearchMode = EDungeonHallwaySearch::Hierarchical;
+
+	FPathfinderWorkspace AStarWorkspace;
+	FPathfinderWorkspace HierWorkspace;
+	FPathfindStats AStarTotals;
+	FPathfindStats HierTotals;
+	int64 AStarCells = 0;
+	int64 HierCells = 0;
+
+	for (int32 i = 0; i < Queries.Num(); ++i)
+	{
+		const FQuery& Query = Queries[i];
+
+		TArray<FIntVector> AStarPath;
+		FPathfindStats AStarStats;
+		const bool bAStarFound = FHallwayPathfinder::FindPath(
+			Grid, Query.Start, Query.End, AStarParams, 0, 0, AStarPath, &AStarStats, &AStarWorkspace);
+
+		TArray<FIntVector> HierPath;
+		FPathfindStats HierStats;
+		const bool bHierFound = FHallwayPathfinder::FindPath(
+			Grid, Query.Start, Query.End, HierParams, 0, 0, HierPath, &HierStats, &HierWorkspace);
+
+		TestEqual(FString::Printf(TEXT("Query %d: both searches agree a path exists"), i), bHierFound, bAStarFound);
+		TestTrue(FString::Printf(TEXT("Query %d: hierarchical path continuous"), i),
+			HallwayPathfinderTestHelpers::IsPathContinuous(HierPath));
+
+		AStarTotals += AStarStats;
+		HierTotals += HierStats;
+		AStarCells += AStarPath.Num();
+		HierCells += HierPath.Num();
+	}
+
+	// The first hierarchical search pays for building the whole graph; the rest reuse it
+	AddInfo(FString::Printf(TEXT("A*:           %.2fms, %d pops, %lld path cells"),
+		AStarTotals.WallTimeMs, AStarTotals.NodesPopped, AStarCells));
+	AddInfo(FString::Printf(TEXT("Hierarchical: %.2fms, %d pops, %lld path cells, %d clusters built, %d fallbacks"),
+		HierTotals.WallTimeMs, HierTotals.NodesPopped, HierCells, HierTotals.ClustersRebuilt, HierTotals.HierarchicalFallbacks));
+	return true;
+}
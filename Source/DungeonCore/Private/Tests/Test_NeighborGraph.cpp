@@ -0,0 +1,265 @@
+// Test_NeighborGraph.cpp — Unit tests for the k-nearest-neighbor candidate graph
+#include "Misc/AutomationTest.h"
+#include "NeighborGraph.h"
+#include "DelaunayTetrahedralization.h"
+#include "DungeonSeed.h"
+
+// ============================================================================
+// Test Helpers
+// ============================================================================
+
+namespace NeighborGraphTestHelpers
+{
+	/** Brute-force k nearest neighbors of every point, as sorted unique (Low, High) pairs. */
+	TArray<TPair<int32, int32>> BruteForceNeighbors(const TArray<FVector>& Points, int32 K)
+	{
+		TSet<TPair<int32, int32>> Unique;
+		for (int32 i = 0; i < Points.Num(); ++i)
+		{
+			TArray<int32> Others;
+			for (int32 j = 0; j < Points.Num(); ++j)
+			{
+				if (j != i)
+				{
+					Others.Add(j);
+				}
+			}
+			Others.Sort([&Points, i](int32 A, int32 B)
+			{
+				const double DistA = FVector::DistSquared(Points[i], Points[A]);
+				const double DistB = FVector::DistSquared(Points[i], Points[B]);
+				return DistA < DistB || (DistA == DistB && A < B);
+			});
+			for (int32 n = 0; n < FMath::Min(K, Others.Num()); ++n)
+			{
+				Unique.Add(TPair<int32, int32>(FMath::Min(i, Others[n]), FMath::Max(i, Others[n])));
+			}
+		}
+		TArray<TPair<int32, int32>> Edges = Unique.Array();
+		Edges.Sort([](const TPair<int32, int32>& A, const TPair<int32, int32>& B)
+		{
+			return A.Key < B.Key || (A.Key == B.Key && A.Value < B.Value);
+		});
+		return Edges;
+	}
+
+	/** True if some third point rules out edge A-B under Pruning, checked against every point. */
+	bool HasWitness(const TArray<FVector>& Points, int32 A, int32 B, EDungeonNeighborPruning Pruning)
+	{
+		const double LengthSq = FVector::DistSquared(Points[A], Points[B]);
+		const FVector Mid = (Points[A] + Points[B]) * 0.5;
+		for (int32 C = 0; C < Points.Num(); ++C)
+		{
+			if (C == A || C == B)
+			{
+				continue;
+			}
+			const bool bWitness = Pruning == EDungeonNeighborPruning::Gabriel
+				? FVector::DistSquared(Points[C], Mid) < LengthSq * 0.25
+				: FVector::DistSquared(Points[C], Points[A]) < LengthSq && FVector::DistSquared(Points[C], Points[B]) < LengthSq;
+			if (bWitness)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/** Number of connected components over Edges. */
+	int32 CountComponents(int32 NumPoints, const TArray<TPair<int32, int32>>& Edges)
+	{
+		TArray<int32> Parent;
+		Parent.SetNum(NumPoints);
+		for (int32 i = 0; i < NumPoints; ++i)
+		{
+			Parent[i] = i;
+		}
+		auto Find = [&Parent](int32 X)
+		{
+			while (Parent[X] != X)
+			{
+				X = Parent[X] = Parent[Parent[X]];
+			}
+			return X;
+		};
+
+		int32 Components = NumPoints;
+		for (const auto& Edge : Edges)
+		{
+			const int32 A = Find(Edge.Key);
+			const int32 B = Find(Edge.Value);
+			if (A != B)
+			{
+				Parent[A] = B;
+				--Components;
+			}
+		}
+		return Components;
+	}
+
+	/** Tight clusters far apart from each other, so k nearest neighbors alone leave them disconnected. */
+	TArray<FVector> MakeClusters(FDungeonSeed& Rng, int32 NumClusters, int32 PointsPerCluster)
+	{
+		TArray<FVector> Points;
+		for (int32 c = 0; c < NumClusters; ++c)
+		{
+			const FVector Center(Rng.FRand() * 2000.0f, Rng.FRand() * 2000.0f, Rng.FRand() * 200.0f);
+			for (int32 i = 0; i < PointsPerCluster; ++i)
+			{
+				Points.Add(Center + FVector(Rng.FRand() * 10.0f, Rng.FRand() * 10.0f, Rng.FRand() * 3.0f));
+			}
+		}
+		return Points;
+	}
+}
+
+// ============================================================================
+// Grid k-NN finds the same neighbors as brute force, and the result is always connected
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNeighborGraphMatchesBruteForce, "Dungeon.NeighborGraph.NearestNeighbors.MatchesBruteForce",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FNeighborGraphMatchesBruteForce::RunTest(const FString& Parameters)
+{
+	using namespace NeighborGraphTestHelpers;
+
+	FDungeonSeed Rng(1234);
+	for (int32 Trial = 0; Trial < 30; ++Trial)
+	{
+		const int32 K = Rng.RandRange(1, 10);
+		TArray<FVector> Points;
+		if (Trial % 3 == 2)
+		{
+			Points = MakeClusters(Rng, Rng.RandRange(2, 6), Rng.RandRange(2, 20));
+		}
+		else
+		{
+			// Trial % 3 == 1 puts everything on one floor, like a single-floor layout
+			const int32 NumPoints = Rng.RandRange(2, 300);
+			for (int32 i = 0; i < NumPoints; ++i)
+			{
+				Points.Add(FVector(Rng.RandRange(0, 60), Rng.RandRange(0, 60), Trial % 3 == 1 ? 2 : Rng.RandRange(0, 6)));
+			}
+		}
+
+		TArray<TPair<int32, int32>> Edges;
+		FNeighborGraph::Build(Points, K, EDungeonNeighborPruning::None, Edges);
+
+		// Every brute-force neighbor edge is there; anything extra only bridges clusters
+		const TArray<TPair<int32, int32>> Expected = BruteForceNeighbors(Points, K);
+		int32 Missing = 0;
+		for (const TPair<int32, int32>& Edge : Expected)
+		{
+			Missing += Edges.Contains(Edge) ? 0 : 1;
+		}
+		TestEqual(FString::Printf(TEXT("Trial %d: neighbor edges missing"), Trial), Missing, 0);
+		TestEqual(FString::Printf(TEXT("Trial %d: bridges added"), Trial),
+			Edges.Num() - Expected.Num(), CountComponents(Points.Num(), Expected) - 1);
+		TestEqual(FString::Printf(TEXT("Trial %d: connected"), Trial), CountComponents(Points.Num(), Edges), 1);
+
+		TArray<TPair<int32, int32>> Again;
+		FNeighborGraph::Build(Points, K, EDungeonNeighborPruning::None, Again);
+		TestTrue(FString::Printf(TEXT("Trial %d: deterministic"), Trial), Again == Edges);
+	}
+	return true;
+}
+
+// ============================================================================
+// Gabriel / RNG pruning removes exactly the witnessed edges, except the few needed to stay connected
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNeighborGraphPruning, "Dungeon.NeighborGraph.Pruning.WitnessedEdgesRemovedAndConnected",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FNeighborGraphPruning::RunTest(const FString& Parameters)
+{
+	using namespace NeighborGraphTestHelpers;
+
+	FDungeonSeed Rng(777);
+	for (int32 Trial = 0; Trial < 20; ++Trial)
+	{
+		TArray<FVector> Points;
+		if (Trial % 2 == 0)
+		{
+			Points = MakeClusters(Rng, Rng.RandRange(1, 5), Rng.RandRange(3, 40));
+		}
+		else
+		{
+			const int32 NumPoints = Rng.RandRange(3, 200);
+			for (int32 i = 0; i < NumPoints; ++i)
+			{
+				Points.Add(FVector(Rng.FRand() * 100.0f, Rng.FRand() * 100.0f, Rng.FRand() * 10.0f));
+			}
+		}
+
+		TArray<TPair<int32, int32>> Unpruned;
+		FNeighborGraph::Build(Points, 6, EDungeonNeighborPruning::None, Unpruned);
+
+		const EDungeonNeighborPruning Modes[] = { EDungeonNeighborPruning::Gabriel, EDungeonNeighborPruning::RelativeNeighborhood };
+		int32 PreviousNum = Unpruned.Num();
+		for (const EDungeonNeighborPruning Mode : Modes)
+		{
+			TArray<TPair<int32, int32>> Edges;
+			FNeighborGraph::Build(Points, 6, Mode, Edges);
+			TestEqual(FString::Printf(TEXT("Trial %d mode %d: connected"), Trial, static_cast<int32>(Mode)),
+				CountComponents(Points.Num(), Edges), 1);
+
+			// Witnessed edges only survive as reconnections: no more of them than the unwitnessed
+			// edges alone leave components to join
+			TArray<TPair<int32, int32>> Unwitnessed;
+			int32 NumWitnessed = 0;
+			for (const TPair<int32, int32>& Edge : Unpruned)
+			{
+				const bool bWitnessed = HasWitness(Points, Edge.Key, Edge.Value, Mode);
+				if (!bWitnessed)
+				{
+					Unwitnessed.Add(Edge);
+					TestTrue(TEXT("Unwitnessed edge kept"), Edges.Contains(Edge));
+				}
+				NumWitnessed += bWitnessed && Edges.Contains(Edge) ? 1 : 0;
+			}
+			TestEqual(FString::Printf(TEXT("Trial %d mode %d: witnessed edges kept"), Trial, static_cast<int32>(Mode)),
+				NumWitnessed, CountComponents(Points.Num(), Unwitnessed) - 1);
+
+			// RNG is a subgraph of Gabriel, which is a subgraph of the unpruned graph
+			TestTrue(TEXT("Pruning never adds edges"), Edges.Num() <= PreviousNum);
+			PreviousNum = Edges.Num();
+		}
+	}
+	return true;
+}
+
+// ============================================================================
+// Benchmark: nearest-neighbor graph vs Delaunay at catacomb-scale room counts
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNeighborGraphBenchmark, "Dungeon.NeighborGraph.Benchmark.VsTetrahedralize",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FNeighborGraphBenchmark::RunTest(const FString& Parameters)
+{
+	const int32 Counts[] = { 255, 1000, 4000, 16000 };
+	for (const int32 NumPoints : Counts)
+	{
+		FDungeonSeed Rng(NumPoints);
+		TArray<FVector> Points;
+		for (int32 i = 0; i < NumPoints; ++i)
+		{
+			Points.Add(FVector(Rng.RandRange(0, 400), Rng.RandRange(0, 400), Rng.RandRange(0, 8)));
+		}
+
+		TArray<TPair<int32, int32>> Edges;
+		const double GraphStart = FPlatformTime::Seconds();
+		FNeighborGraph::Build(Points, 8, EDungeonNeighborPruning::Gabriel, Edges);
+		const double GraphMs = (FPlatformTime::Seconds() - GraphStart) * 1000.0;
+		TestEqual(FString::Printf(TEXT("%d points connected"), NumPoints),
+			NeighborGraphTestHelpers::CountComponents(NumPoints, Edges), 1);
+
+		TArray<TPair<int32, int32>> DelaunayEdges;
+		const double DelaunayStart = FPlatformTime::Seconds();
+		FDelaunayTetrahedralization::Tetrahedralize(Points, DelaunayEdges);
+		const double DelaunayMs = (FPlatformTime::Seconds() - DelaunayStart) * 1000.0;
+
+		AddInfo(FString::Printf(TEXT("%5d points: k-NN + Gabriel %.2fms (%d edges), Delaunay %.2fms (%d edges)"),
+			NumPoints, GraphMs, Edges.Num(), DelaunayMs, DelaunayEdges.Num()));
+	}
+	return true;
+}
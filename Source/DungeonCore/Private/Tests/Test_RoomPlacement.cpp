@@ -0,0 +1,541 @@
+// Test_RoomPlacement.cpp — Unit tests for room placement, its overlap broadphase, occupancy table and grid stamping
+#include "Misc/AutomationTest.h"
+#include "RoomPlacement.h"
+#include "DungeonTypes.h"
+#include "DungeonSeed.h"
+#include "DungeonGenerationParams.h"
+
+// ============================================================================
+// Test Helpers
+// ============================================================================
+
+namespace RoomPlacementTestHelpers
+{
+	/** Random room (overlaps allowed) with XY inside GridSize. */
+	FDungeonRoom RandomRoom(FDungeonSeed& Rng, const FIntVector& GridSize, const FIntVector& MaxSize)
+	{
+		FDungeonRoom Room;
+		Room.Size = FIntVector(
+			Rng.RandRange(1, MaxSize.X),
+			Rng.RandRange(1, MaxSize.Y),
+			Rng.RandRange(1, MaxSize.Z));
+		Room.Position = FIntVector(
+			Rng.RandRange(0, GridSize.X - Room.Size.X),
+			Rng.RandRange(0, GridSize.Y - Room.Size.Y),
+			Rng.RandRange(0, GridSize.Z - Room.Size.Z));
+		return Room;
+	}
+}
+
+// ============================================================================
+// Broadphase answers exactly like the brute-force scan
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRoomPlacementBroadphaseMatches, "Dungeon.RoomPlacement.Broadphase.MatchesBruteForce",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FRoomPlacementBroadphaseMatches::RunTest(const FString& Parameters)
+{
+	const FIntVector GridSize(64, 48, 4);
+	const FIntVector MaxSize(9, 9, 2);
+
+	// Bucket sizes smaller than, equal to and larger than a room; buffers including none
+	const int32 BucketSizes[] = { 1, 4, 11, 64 };
+	const int32 Buffers[] = { 0, 1, 3 };
+
+	int32 Mismatches = 0;
+	int32 Hits = 0;
+	int32 Queries = 0;
+	for (const int32 BucketSize : BucketSizes)
+	{
+		for (const int32 Buffer : Buffers)
+		{
+			FDungeonSeed Rng(BucketSize * 31 + Buffer);
+			TArray<FDungeonRoom> Rooms;
+			FRoomBroadphase Broadphase;
+			Broadphase.Reset(GridSize, BucketSize, Buffer);
+
+			for (int32 i = 0; i < 40; ++i)
+			{
+				const FDungeonRoom Room = RoomPlacementTestHelpers::RandomRoom(Rng, GridSize, MaxSize);
+				Broadphase.Add(Rooms.Add(Room), Room);
+			}
+
+			for (int32 q = 0; q < 500; ++q)
+			{
+				const FDungeonRoom Candidate = RoomPlacementTestHelpers::RandomRoom(Rng, GridSize, MaxSize);
+				const bool bExpected = FRoomPlacement::DoesRoomOverlap(Candidate.Position, Candidate.Size, Rooms, Buffer);
+				const bool bActual = Broadphase.Overlaps(Candidate.Position, Candidate.Size, Rooms);
+				Mismatches += bExpected != bActual ? 1 : 0;
+				Hits += bExpected ? 1 : 0;
+				Queries++;
+			}
+		}
+	}
+
+	TestEqual(TEXT("Broadphase agrees with brute force on every query"), Mismatches, 0);
+	TestTrue(TEXT("Queries include both overlaps and clear placements"), Hits > 0 && Hits < Queries);
+	return true;
+}
+
+// ============================================================================
+// Placed rooms never overlap, and placement is reproducible
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRoomPlacementNoOverlaps, "Dungeon.RoomPlacement.Placement.NoOverlapsAndDeterministic",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FRoomPlacementNoOverlaps::RunTest(const FString& Parameters)
+{
+	FDungeonGenerationParams Params;
+	Params.GridSize = FIntVector(80, 80, 3);
+	Params.RoomCount = 60;
+	Params.MaxPlacementAttempts = 300;
+	Params.RoomBuffer = 2;
+
+	auto Place = [&Params](int64 SeedValue, TArray<FDungeonRoom>& OutRooms)
+	{
+		FDungeonGrid Grid;
+		Grid.Initialize(Params.GridSize);
+		FDungeonSeed Seed(SeedValue);
+		FRoomPlacement::PlaceRooms(Grid, Params, Seed, OutRooms);
+	};
+
+	for (int64 SeedValue = 1; SeedValue <= 5; ++SeedValue)
+	{
+		TArray<FDungeonRoom> RoomsA;
+		TArray<FDungeonRoom> RoomsB;
+		Place(SeedValue, RoomsA);
+		Place(SeedValue, RoomsB);
+
+		TestEqual(FString::Printf(TEXT("Seed %lld: same room count"), SeedValue), RoomsA.Num(), RoomsB.Num());
+		for (int32 i = 0; i < RoomsA.Num() && i < RoomsB.Num(); ++i)
+		{
+			TestTrue(FString::Printf(TEXT("Seed %lld room %d: same box"), SeedValue, i),
+				RoomsA[i].Position == RoomsB[i].Position && RoomsA[i].Size == RoomsB[i].Size);
+		}
+
+		// Each room must have been clear of all rooms placed before it
+		for (int32 i = 1; i < RoomsA.Num(); ++i)
+		{
+			const TArray<FDungeonRoom> Earlier(RoomsA.GetData(), i);
+			TestFalse(FString::Printf(TEXT("Seed %lld room %d: clear of earlier rooms"), SeedValue, i),
+				FRoomPlacement::DoesRoomOverlap(RoomsA[i].Position, RoomsA[i].Size, Earlier, Params.RoomBuffer));
+		}
+	}
+	return true;
+}
+
+// ============================================================================
+// Occupancy table fit test agrees with the brute-force scan
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRoomPlacementOccupancyMatches, "Dungeon.RoomPlacement.OccupancyTable.MatchesBruteForce",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FRoomPlacementOccupancyMatches::RunTest(const FString& Parameters)
+{
+	const FIntVector GridSize(40, 32, 4);
+	const FIntVector MaxSize(8, 8, 2);
+	const int32 Buffers[] = { 0, 1, 3 };
+
+	int32 Mismatches = 0;
+	int32 Fits = 0;
+	int32 Queries = 0;
+	for (const int32 Buffer : Buffers)
+	{
+		FDungeonSeed Rng(500 + Buffer);
+		TArray<FDungeonRoom> Rooms;
+		FRoomOccupancyTable Occupancy;
+		Occupancy.Reset(GridSize, Buffer);
+
+		// Rooms may overlap each other here; the table just counts them more than once
+		for (int32 i = 0; i < 25; ++i)
+		{
+			Rooms.Add(RoomPlacementTestHelpers::RandomRoom(Rng, GridSize, MaxSize));
+			Occupancy.Add(Rooms.Last());
+		}
+
+		for (int32 q = 0; q < 1000; ++q)
+		{
+			const FDungeonRoom Candidate = RoomPlacementTestHelpers::RandomRoom(Rng, GridSize, MaxSize);
+			const bool bExpected = !FRoomPlacement::DoesRoomOverlap(Candidate.Position, Candidate.Size, Rooms, Buffer);
+			const bool bActual = Occupancy.Fits(Candidate.Position, Candidate.Size);
+			Mismatches += bExpected != bActual ? 1 : 0;
+			Fits += bExpected ? 1 : 0;
+			Queries++;
+		}
+	}
+
+	TestEqual(TEXT("Occupancy table agrees with brute force on every query"), Mismatches, 0);
+	TestTrue(TEXT("Queries include both fits and overlaps"), Fits > 0 && Fits < Queries);
+	return true;
+}
+
+// ============================================================================
+// Summed-area placement fills dense grids that rejection sampling gives up on
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRoomPlacementSummedAreaDense, "Dungeon.RoomPlacement.SummedArea.PlacesAllRoomsWhenDense",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FRoomPlacementSummedAreaDense::RunTest(const FString& Parameters)
+{
+	FDungeonGenerationParams Params;
+	Params.GridSize = FIntVector(48, 48, 1);
+	Params.RoomCount = 30;
+	Params.MinRoomSize = FIntVector(3, 3, 1);
+	Params.MaxRoomSize = FIntVector(6, 6, 1);
+	Params.RoomBuffer = 1;
+	Params.MaxPlacementAttempts = 10;
+
+	auto Place = [&Params](EDungeonRoomPlacement Mode, int64 SeedValue, TArray<FDungeonRoom>& OutRooms)
+	{
+		FDungeonGenerationParams ModeParams = Params;
+		ModeParams.RoomPlacementMode = Mode;
+		FDungeonGrid Grid;
+		Grid.Initialize(ModeParams.GridSize);
+		FDungeonSeed Seed(SeedValue);
+		FRoomPlacement::PlaceRooms(Grid, ModeParams, Seed, OutRooms);
+	};
+
+	int32 RejectionTotal = 0;
+	for (int64 SeedValue = 1; SeedValue <= 5; ++SeedValue)
+	{
+		TArray<FDungeonRoom> Rejection;
+		TArray<FDungeonRoom> SummedArea;
+		TArray<FDungeonRoom> SummedAreaAgain;
+		Place(EDungeonRoomPlacement::RejectionSampling, SeedValue, Rejection);
+		Place(EDungeonRoomPlacement::SummedAreaTable, SeedValue, SummedArea);
+		Place(EDungeonRoomPlacement::SummedAreaTable, SeedValue, SummedAreaAgain);
+		RejectionTotal += Rejection.Num();
+
+		TestEqual(FString::Printf(TEXT("Seed %lld: every room placed"), SeedValue), SummedArea.Num(), Params.RoomCount);
+		TestEqual(FString::Printf(TEXT("Seed %lld: reproducible room count"), SeedValue), SummedAreaAgain.Num(), SummedArea.Num());
+		for (int32 i = 0; i < SummedArea.Num(); ++i)
+		{
+			if (i < SummedAreaAgain.Num())
+			{
+				TestTrue(FString::Printf(TEXT("Seed %lld room %d: reproducible box"), SeedValue, i),
+					SummedArea[i].Position == SummedAreaAgain[i].Position && SummedArea[i].Size == SummedAreaAgain[i].Size);
+			}
+
+			const TArray<FDungeonRoom> Earlier(SummedArea.GetData(), i);
+			TestFalse(FString::Printf(TEXT("Seed %lld room %d: clear of earlier rooms"), SeedValue, i),
+				FRoomPlacement::DoesRoomOverlap(SummedArea[i].Position, SummedArea[i].Size, Earlier, Params.RoomBuffer));
+		}
+	}
+
+	AddInfo(FString::Printf(TEXT("Rejection sampling placed %d/%d rooms over 5 seeds"), RejectionTotal, Params.RoomCount * 5));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRoomPlacementSummedAreaFull, "Dungeon.RoomPlacement.SummedArea.StopsWhenGridFull",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FRoomPlacementSummedAreaFull::RunTest(const FString& Parameters)
+{
+	FDungeonGenerationParams Params;
+	Params.GridSize = FIntVector(14, 14, 1);
+	Params.RoomCount = 50;
+	Params.MinRoomSize = FIntVector(3, 3, 1);
+	Params.MaxRoomSize = FIntVector(4, 4, 1);
+	Params.RoomBuffer = 1;
+	Params.RoomPlacementMode = EDungeonRoomPlacement::SummedAreaTable;
+
+	FDungeonGrid Grid;
+	Grid.Initialize(Params.GridSize);
+	FDungeonSeed Seed(3);
+	TArray<FDungeonRoom> Rooms;
+	FRoomPlacement::PlaceRooms(Grid, Params, Seed, Rooms);
+
+	// 13x13 usable cells hold at most nine grown 4x4 rooms
+	TestTrue(TEXT("Placed some rooms"), Rooms.Num() >= 2);
+	TestTrue(TEXT("Stopped at what the grid holds"), Rooms.Num() <= 9);
+
+	FRoomOccupancyTable Occupancy;
+	Occupancy.Reset(Params.GridSize, Params.RoomBuffer);
+	for (const FDungeonRoom& Room : Rooms)
+	{
+		Occupancy.Add(Room);
+	}
+	bool bAnyFit = false;
+	for (int32 Y = Params.RoomBuffer; Y <= Params.GridSize.Y - Params.MinRoomSize.Y - Params.RoomBuffer; ++Y)
+	{
+		for (int32 X = Params.RoomBuffer; X <= Params.GridSize.X - Params.MinRoomSize.X - Params.RoomBuffer; ++X)
+		{
+			bAnyFit |= Occupancy.Fits(FIntVector(X, Y, 0), Params.MinRoomSize);
+		}
+	}
+	TestFalse(TEXT("No minimum-size room fits anywhere afterwards"), bAnyFit);
+	return true;
+}
+
+// ============================================================================
+// Poisson-disk placement: complete, reproducible, and spaced
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRoomPlacementPoissonDisk, "Dungeon.RoomPlacement.PoissonDisk.SpacedAndDeterministic",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FRoomPlacementPoissonDisk::RunTest(const FString& Parameters)
+{
+	FDungeonGenerationParams Params;
+	Params.GridSize = FIntVector(80, 80, 3);
+	Params.RoomCount = 40;
+	Params.MaxRoomSize = FIntVector(7, 7, 1);
+	Params.RoomPlacementMode = EDungeonRoomPlacement::PoissonDisk;
+
+	auto Place = [](const FDungeonGenerationParams& PlaceParams, int64 SeedValue, TArray<FDungeonRoom>& OutRooms)
+	{
+		FDungeonGrid Grid;
+		Grid.Initialize(PlaceParams.GridSize);
+		FDungeonSeed Seed(SeedValue);
+		FRoomPlacement::PlaceRooms(Grid, PlaceParams, Seed, OutRooms);
+	};
+
+	// Distance between centers with floors weighted like staircases, as the sampler measures it
+	auto CenterDistance = [&Params](const FDungeonRoom& A, const FDungeonRoom& B)
+	{
+		const float FloorScale = static_cast<float>(Params.StaircaseRiseToRun + 1);
+		const float DX = (A.Position.X + A.Size.X * 0.5f) - (B.Position.X + B.Size.X * 0.5f);
+		const float DY = (A.Position.Y + A.Size.Y * 0.5f) - (B.Position.Y + B.Size.Y * 0.5f);
+		const float DZ = ((A.Position.Z + A.Size.Z * 0.5f) - (B.Position.Z + B.Size.Z * 0.5f)) * FloorScale;
+		return FMath::Sqrt(DX * DX + DY * DY + DZ * DZ);
+	};
+
+	for (int64 SeedValue = 1; SeedValue <= 5; ++SeedValue)
+	{
+		TArray<FDungeonRoom> RoomsA;
+		TArray<FDungeonRoom> RoomsB;
+		Place(Params, SeedValue, RoomsA);
+		Place(Params, SeedValue, RoomsB);
+
+		TestEqual(FString::Printf(TEXT("Seed %lld: automatic spacing places every room"), SeedValue), RoomsA.Num(), Params.RoomCount);
+		TestEqual(FString::Printf(TEXT("Seed %lld: same room count"), SeedValue), RoomsB.Num(), RoomsA.Num());
+		for (int32 i = 0; i < RoomsA.Num(); ++i)
+		{
+			if (i < RoomsB.Num())
+			{
+				TestTrue(FString::Printf(TEXT("Seed %lld room %d: same box"), SeedValue, i),
+					RoomsA[i].Position == RoomsB[i].Position && RoomsA[i].Size == RoomsB[i].Size);
+			}
+
+			const TArray<FDungeonRoom> Earlier(RoomsA.GetData(), i);
+			TestFalse(FString::Printf(TEXT("Seed %lld room %d: clear of earlier rooms"), SeedValue, i),
+				FRoomPlacement::DoesRoomOverlap(RoomsA[i].Position, RoomsA[i].Size, Earlier, Params.RoomBuffer));
+		}
+	}
+
+	// A configured spacing is a hard minimum, even if it means fewer rooms
+	FDungeonGenerationParams SpacedParams = Params;
+	SpacedParams.RoomCenterSpacing = 14.0f;
+	TArray<FDungeonRoom> Spaced;
+	Place(SpacedParams, 7, Spaced);
+	TestTrue(TEXT("Configured spacing still places rooms"), Spaced.Num() >= 2);
+
+	float MinDistance = MAX_flt;
+	for (int32 i = 0; i < Spaced.Num(); ++i)
+	{
+		for (int32 j = i + 1; j < Spaced.Num(); ++j)
+		{
+			MinDistance = FMath::Min(MinDistance, CenterDistance(Spaced[i], Spaced[j]));
+		}
+	}
+	TestTrue(FString::Printf(TEXT("Closest centers %.2f apart, spacing 14"), MinDistance), MinDistance >= 14.0f);
+	return true;
+}
+
+// ============================================================================
+// Bulk grid writers match per-cell writes, including clipping and masks
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRoomPlacementFillBoxMatches, "Dungeon.RoomPlacement.Stamp.FillBoxMatchesPerCell",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FRoomPlacementFillBoxMatches::RunTest(const FString& Parameters)
+{
+	const FIntVector GridSize(13, 9, 3);
+	FDungeonSeed Rng(2024);
+
+	FDungeonGrid Bulk;
+	Bulk.Initialize(GridSize);
+	FDungeonGrid Reference;
+	Reference.Initialize(GridSize);
+
+	int32 Mismatches = 0;
+	for (int32 Iter = 0; Iter < 300; ++Iter)
+	{
+		// Boxes hang off every side of the grid, and some are empty
+		const FIntVector Min(Rng.RandRange(-4, GridSize.X), Rng.RandRange(-4, GridSize.Y), Rng.RandRange(-2, GridSize.Z));
+		const FIntVector Max = Min + FIntVector(Rng.RandRange(0, 8), Rng.RandRange(0, 6), Rng.RandRange(0, 3));
+
+		FDungeonCell Value;
+		Value.CellType = static_cast<EDungeonCellType>(Rng.RandRange(0, 7));
+		Value.RoomIndex = static_cast<uint8>(Rng.RandRange(0, 255));
+		Value.HallwayIndex = static_cast<uint8>(Rng.RandRange(0, 255));
+		Value.Flags = static_cast<uint8>(Rng.RandRange(0, 255));
+		const bool bMasked = Rng.RandRange(0, 1) == 1;
+		FDungeonCell Mask = FDungeonGrid::FieldMask(&FDungeonCell::CellType, &FDungeonCell::HallwayIndex);
+		Mask.Flags = 0x05;
+		const uint32 MatchTypes = FDungeonGrid::CellTypeBit(EDungeonCellType::Empty)
+			| FDungeonGrid::CellTypeBit(EDungeonCellType::Hallway);
+		const int32 Mode = Rng.RandRange(0, 2);
+
+		int32 Expected = 0;
+		for (int32 Z = Min.Z; Z < Max.Z; ++Z)
+		{
+			for (int32 Y = Min.Y; Y < Max.Y; ++Y)
+			{
+				for (int32 X = Min.X; X < Max.X; ++X)
+				{
+					if (!Reference.IsInBounds(X, Y, Z))
+					{
+						continue;
+					}
+					FDungeonCell& Cell = Reference.GetCellForWrite(X, Y, Z);
+					if (Mode == 2 && (MatchTypes & FDungeonGrid::CellTypeBit(Cell.CellType)) == 0)
+					{
+						continue;
+					}
+					if (Mode == 0 && !bMasked)
+					{
+						Cell = Value;
+					}
+					else
+					{
+						Cell.CellType = Value.CellType;
+						Cell.HallwayIndex = Value.HallwayIndex;
+						Cell.Flags = static_cast<uint8>((Cell.Flags & ~0x05) | (Value.Flags & 0x05));
+					}
+					++Expected;
+				}
+			}
+		}
+
+		int32 Written = 0;
+		int32 Callbacks = 0;
+		if (Mode == 0)
+		{
+			Written = bMasked ? Bulk.FillBox(Min, Max, Value, Mask) : Bulk.FillBox(Min, Max, Value);
+		}
+		else if (Mode == 1)
+		{
+			for (int32 Z = Min.Z; Z < Max.Z; ++Z)
+			{
+				for (int32 Y = Min.Y; Y < Max.Y; ++Y)
+				{
+					Written += Bulk.FillRow(Y, Z, Min.X, Max.X, Value, Mask);
+				}
+			}
+		}
+		else
+		{
+			Written = Bulk.FillBoxWhere(Min, Max, MatchTypes, Value, Mask,
+				[&Callbacks](const FIntVector&) { ++Callbacks; });
+			TestEqual(TEXT("One callback per written cell"), Callbacks, Written);
+		}
+
+		TestEqual(TEXT("Written count"), Written, Expected);
+		Mismatches += FMemory::Memcmp(Bulk.Cells.GetData(), Reference.Cells.GetData(),
+			Bulk.Cells.Num() * sizeof(FDungeonCell)) != 0 ? 1 : 0;
+	}
+
+	TestEqual(TEXT("Grids diverged after bulk writes"), Mismatches, 0);
+	return true;
+}
+
+// ============================================================================
+// StampRoomToGrid stamps per-floor cells and clips rooms hanging off the grid
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRoomPlacementStampClips, "Dungeon.RoomPlacement.Stamp.StampsFloorsAndClips",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FRoomPlacementStampClips::RunTest(const FString& Parameters)
+{
+	FDungeonGrid Grid;
+	Grid.Initialize(FIntVector(8, 8, 3));
+	Grid.GetCellForWrite(6, 6, 1).MaterialHint = 7;
+
+	FDungeonRoom Room;
+	Room.RoomIndex = 4;
+	Room.Position = FIntVector(5, 5, 1);
+	Room.Size = FIntVector(5, 5, 4);
+	FRoomPlacement::StampRoomToGrid(Grid, Room);
+
+	int32 RoomCells = 0;
+	for (int32 Z = 0; Z < 3; ++Z)
+	{
+		for (int32 Y = 0; Y < 8; ++Y)
+		{
+			for (int32 X = 0; X < 8; ++X)
+			{
+				const FDungeonCell& Cell = Grid.GetCell(X, Y, Z);
+				const bool bInside = X >= 5 && Y >= 5 && Z >= 1;
+				TestEqual(TEXT("Cell type"), Cell.CellType, bInside ? EDungeonCellType::Room : EDungeonCellType::Empty);
+				if (bInside)
+				{
+					TestEqual(TEXT("Room index"), static_cast<int32>(Cell.RoomIndex), 4);
+					TestEqual(TEXT("Floor index"), static_cast<int32>(Cell.FloorIndex), Z);
+					++RoomCells;
+				}
+			}
+		}
+	}
+	TestEqual(TEXT("Clipped room cells"), RoomCells, 3 * 3 * 2);
+	TestEqual(TEXT("Unstamped fields kept"), static_cast<int32>(Grid.GetCell(6, 6, 1).MaterialHint), 7);
+	return true;
+}
+
+// ============================================================================
+// Benchmark: broadphase vs brute-force overlap queries at the 255-room cap
+// ============================================================================
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRoomPlacementBroadphaseBenchmark, "Dungeon.RoomPlacement.Benchmark.BroadphaseVsBruteForce",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FRoomPlacementBroadphaseBenchmark::RunTest(const FString& Parameters)
+{
+	FDungeonGenerationParams Params;
+	Params.GridSize = FIntVector(200, 200, 5);
+	Params.RoomCount = 255;
+	Params.MaxPlacementAttempts = 1000;
+
+	FDungeonGrid Grid;
+	Grid.Initialize(Params.GridSize);
+	FDungeonSeed Seed(2024);
+	TArray<FDungeonRoom> Rooms;
+
+	const double PlaceStart = FPlatformTime::Seconds();
+	FRoomPlacement::PlaceRooms(Grid, Params, Seed, Rooms);
+	const double PlaceMs = (FPlatformTime::Seconds() - PlaceStart) * 1000.0;
+
+	FRoomBroadphase Broadphase;
+	Broadphase.Reset(Params.GridSize, FMath::Max(Params.MaxRoomSize.X, Params.MaxRoomSize.Y) + Params.RoomBuffer, Params.RoomBuffer);
+	for (int32 i = 0; i < Rooms.Num(); ++i)
+	{
+		Broadphase.Add(i, Rooms[i]);
+	}
+
+	FDungeonSeed QuerySeed(7);
+	TArray<FDungeonRoom> Candidates;
+	for (int32 q = 0; q < 100000; ++q)
+	{
+		Candidates.Add(RoomPlacementTestHelpers::RandomRoom(QuerySeed, Params.GridSize, Params.MaxRoomSize));
+	}
+
+	int32 BruteHits = 0;
+	const double BruteStart = FPlatformTime::Seconds();
+	for (const FDungeonRoom& Candidate : Candidates)
+	{
+		BruteHits += FRoomPlacement::DoesRoomOverlap(Candidate.Position, Candidate.Size, Rooms, Params.RoomBuffer) ? 1 : 0;
+	}
+	const double BruteMs = (FPlatformTime::Seconds() - BruteStart) * 1000.0;
+
+	int32 BroadHits = 0;
+	const double BroadStart = FPlatformTime::Seconds();
+	for (const FDungeonRoom& Candidate : Candidates)
+	{
+		BroadHits += Broadphase.Overlaps(Candidate.Position, Candidate.Size, Rooms) ? 1 : 0;
+	}
+	const double BroadMs = (FPlatformTime::Seconds() - BroadStart) * 1000.0;
+
+	TestEqual(TEXT("Both tests report the same overlaps"), BroadHits, BruteHits);
+	AddInfo(FString::Printf(TEXT("PlaceRooms: %d rooms in %.2fms"), Rooms.Num(), PlaceMs));
+	AddInfo(FString::Printf(TEXT("Brute force: %.2fms for %d queries"), BruteMs, Candidates.Num()));
+	AddInfo(FString::Printf(TEXT("Broadphase:  %.2fms for %d queries"), BroadMs, Candidates.Num()));
+	return true;
+}
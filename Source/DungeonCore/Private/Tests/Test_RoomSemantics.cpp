@@ -2,6 +2,7 @@
 #include "Misc/AutomationTest.h"
 #include "DungeonTypes.h"
 #include "DungeonConfig.h"
+#include "DungeonGenerationParams.h"
 #include "DungeonSeed.h"
 #include "RoomSemantics.h"
 #include "DungeonGenerator.h"
@@ -59,7 +60,7 @@ namespace RoomSemanticsTestHelpers
 			{
 				for (int32 Y = Room.Position.Y; Y < Room.Position.Y + Room.Size.Y && Y < GridSize.Y; ++Y)
 				{
-					FDungeonCell& Cell = Result.Grid.GetCell(X, Y, 0);
+					FDungeonCell& Cell = Result.Grid.GetCellForWrite(X, Y, 0);
 					Cell.CellType = EDungeonCellType::Room;
 					Cell.RoomIndex = Room.RoomIndex;
 				}
@@ -125,7 +126,7 @@ namespace RoomSemanticsTestHelpers
 				{
 					if (Result.Grid.IsInBounds(X, Y, 0))
 					{
-						FDungeonCell& Cell = Result.Grid.GetCell(X, Y, 0);
+						FDungeonCell& Cell = Result.Grid.GetCellForWrite(X, Y, 0);
 						Cell.CellType = EDungeonCellType::Room;
 						Cell.RoomIndex = Room.RoomIndex;
 					}
@@ -236,7 +237,7 @@ bool FRoomSemBoundaryEdgePick::RunTest(const FString& Parameters)
 	}
 
 	FDungeonSeed Seed(42);
-	int32 Chosen = FRoomSemantics::SelectEntranceRoom(Result, *Config, Seed);
+	int32 Chosen = FRoomSemantics::SelectEntranceRoom(Result, FDungeonGenerationParams::FromConfig(*Config), Seed);
 	TestEqual(TEXT("Boundary room chosen"), Chosen, 1);
 
 	RoomSemanticsTestHelpers::CleanupConfig(Config);
@@ -277,7 +278,7 @@ bool FRoomSemBottomFloorPick::RunTest(const FString& Parameters)
 	}
 
 	FDungeonSeed Seed(42);
-	int32 Chosen = FRoomSemantics::SelectEntranceRoom(Result, *Config, Seed);
+	int32 Chosen = FRoomSemantics::SelectEntranceRoom(Result, FDungeonGenerationParams::FromConfig(*Config), Seed);
 	TestEqual(TEXT("Bottom floor room chosen"), Chosen, 1);
 
 	RoomSemanticsTestHelpers::CleanupConfig(Config);
@@ -318,7 +319,7 @@ bool FRoomSemTopFloorPick::RunTest(const FString& Parameters)
 	}
 
 	FDungeonSeed Seed(42);
-	int32 Chosen = FRoomSemantics::SelectEntranceRoom(Result, *Config, Seed);
+	int32 Chosen = FRoomSemantics::SelectEntranceRoom(Result, FDungeonGenerationParams::FromConfig(*Config), Seed);
 	TestEqual(TEXT("Top floor room chosen"), Chosen, 1);
 
 	RoomSemanticsTestHelpers::CleanupConfig(Config);
@@ -336,7 +337,7 @@ bool FRoomSemAnyPick::RunTest(const FString& Parameters)
 	FDungeonResult Result = RoomSemanticsTestHelpers::CreateLinearResult(5);
 
 	FDungeonSeed Seed(42);
-	int32 Chosen = FRoomSemantics::SelectEntranceRoom(Result, *Config, Seed);
+	int32 Chosen = FRoomSemantics::SelectEntranceRoom(Result, FDungeonGenerationParams::FromConfig(*Config), Seed);
 	TestTrue(TEXT("Valid index returned"), Chosen >= 0 && Chosen < Result.Rooms.Num());
 
 	RoomSemanticsTestHelpers::CleanupConfig(Config);
@@ -467,7 +468,7 @@ bool FRoomSemBossAtFarthest::RunTest(const FString& Parameters)
 	TArray<FRoomSemanticContext> Contexts = FRoomSemantics::ComputeGraphMetrics(Result);
 
 	FDungeonSeed Seed(42);
-	FRoomSemantics::AssignRoomTypes(Result, *Config, Contexts, Seed);
+	FRoomSemantics::AssignRoomTypes(Result, FDungeonGenerationParams::FromConfig(*Config), Contexts, Seed);
 
 	// Room 4 is at NormalizedDistance=1.0, should be Boss
 	TestEqual(TEXT("Room 4 is Boss"), Result.Rooms[4].RoomType, EDungeonRoomType::Boss);
@@ -495,7 +496,7 @@ bool FRoomSemTreasurePrefersLeaf::RunTest(const FString& Parameters)
 	TArray<FRoomSemanticContext> Contexts = FRoomSemantics::ComputeGraphMetrics(Result);
 
 	FDungeonSeed Seed(42);
-	FRoomSemantics::AssignRoomTypes(Result, *Config, Contexts, Seed);
+	FRoomSemantics::AssignRoomTypes(Result, FDungeonGenerationParams::FromConfig(*Config), Contexts, Seed);
 
 	// Find which room is Treasure — should be a leaf (rooms 1-4)
 	int32 TreasureIdx = -1;
@@ -549,7 +550,7 @@ bool FRoomSemMultipleRulesRespected::RunTest(const FString& Parameters)
 	TArray<FRoomSemanticContext> Contexts = FRoomSemantics::ComputeGraphMetrics(Result);
 
 	FDungeonSeed Seed(42);
-	FRoomSemantics::AssignRoomTypes(Result, *Config, Contexts, Seed);
+	FRoomSemantics::AssignRoomTypes(Result, FDungeonGenerationParams::FromConfig(*Config), Contexts, Seed);
 
 	// Count types
 	int32 EntranceCount = 0, BossCount = 0, TreasureCount = 0, RestCount = 0, GenericCount = 0;
@@ -589,7 +590,7 @@ bool FRoomSemBossGuaranteeFallback::RunTest(const FString& Parameters)
 	TArray<FRoomSemanticContext> Contexts = FRoomSemantics::ComputeGraphMetrics(Result);
 
 	FDungeonSeed Seed(42);
-	FRoomSemantics::AssignRoomTypes(Result, *Config, Contexts, Seed);
+	FRoomSemantics::AssignRoomTypes(Result, FDungeonGenerationParams::FromConfig(*Config), Contexts, Seed);
 
 	bool bHasBoss = false;
 	for (const FDungeonRoom& Room : Result.Rooms)
@@ -618,7 +619,7 @@ bool FRoomSemEntranceAlwaysAssigned::RunTest(const FString& Parameters)
 	TArray<FRoomSemanticContext> Contexts = FRoomSemantics::ComputeGraphMetrics(Result);
 
 	FDungeonSeed Seed(42);
-	FRoomSemantics::AssignRoomTypes(Result, *Config, Contexts, Seed);
+	FRoomSemantics::AssignRoomTypes(Result, FDungeonGenerationParams::FromConfig(*Config), Contexts, Seed);
 
 	TestEqual(TEXT("Room 0 is Entrance"), Result.Rooms[0].RoomType, EDungeonRoomType::Entrance);
 
@@ -701,7 +702,7 @@ bool FRoomSemValidatorPasses::RunTest(const FString& Parameters)
 	TestTrue(TEXT("Generation produced rooms"), Result.Rooms.Num() >= 2);
 
 	// Run full validation including room semantics
-	FDungeonValidationResult Validation = FDungeonValidator::ValidateAll(Result, *Config);
+	FDungeonValidationResult Validation = FDungeonValidator::ValidateAll(Result, FDungeonGenerationParams::FromConfig(*Config));
 	if (!Validation.bPassed)
 	{
 		AddError(FString::Printf(TEXT("Validation failed: %s"), *Validation.GetSummary()));
@@ -710,7 +711,7 @@ bool FRoomSemValidatorPasses::RunTest(const FString& Parameters)
 
 	// Verify semantics specifically
 	TArray<FDungeonValidationIssue> SemanticsIssues;
-	FDungeonValidator::ValidateRoomSemantics(Result, *Config, SemanticsIssues);
+	FDungeonValidator::ValidateRoomSemantics(Result, FDungeonGenerationParams::FromConfig(*Config), SemanticsIssues);
 	TestEqual(TEXT("No semantics issues"), SemanticsIssues.Num(), 0);
 
 	Generator->RemoveFromRoot();
@@ -4,63 +4,57 @@
 
 /**
  * FDelaunayTetrahedralization
- * 3D Bowyer-Watson algorithm. Takes room center points in 3D and produces connectivity edges.
- * Handles coplanar points (single-floor dungeons) via caller-provided jitter.
+ * Incremental 3D Delaunay (Bowyer-Watson on a neighbor-linked mesh). Takes room center points in
+ * 3D and produces connectivity edges. Points are inserted in BRIO/Hilbert order, each located by a
+ * visibility walk from the last tetrahedron created, and its cavity grown by BFS over adjacency,
+ * so insertion is O(log n) expected instead of a scan over every tetrahedron.
+ * All geometric tests are exact (FGeometricPredicates), with cospherical ties broken by symbolic
+ * perturbation, so grid-snapped and coplanar inputs need no jitter.
+ * All transient storage lives on the calling thread's FMemStack under one mark per call, and the
+ * per-insertion scratch is reset rather than reallocated. The one exception is the exact fallback
+ * of a predicate on near-degenerate input, whose expansions can outgrow their inline storage and
+ * spill to the heap; the filtered fast path never does.
  */
 struct DUNGEONCORE_API FDelaunayTetrahedralization
 {
 	/**
 	 * Compute 3D Delaunay tetrahedralization and extract unique edges.
 	 * @param Points     Room center positions in 3D.
-	 * @param OutEdges   Unique edges as pairs of point indices (0-based).
+	 * @param OutEdges   Unique edges as pairs of point indices (0-based), sorted.
 	 */
 	static void Tetrahedralize(
 		const TArray<FVector>& Points,
 		TArray<TPair<int32, int32>>& OutEdges);
 
 private:
+	/**
+	 * Positively oriented tetrahedron. N[i] is the tetrahedron across the face opposite V[i]
+	 * (INDEX_NONE on the super-tetrahedron's hull). V[0] == INDEX_NONE marks a free slot.
+	 */
 	struct FTetrahedron
 	{
 		int32 V[4];
-		bool ContainsVertex(int32 Idx) const;
+		int32 N[4];
 	};
 
-	struct FFace
-	{
-		int32 V[3]; // Sorted ascending for canonical comparison
-
-		FFace(int32 A, int32 B, int32 C);
-		bool operator==(const FFace& Other) const;
-
-		friend uint32 GetTypeHash(const FFace& F)
-		{
-			return HashCombine(
-				HashCombine(::GetTypeHash(F.V[0]), ::GetTypeHash(F.V[1])),
-				::GetTypeHash(F.V[2]));
-		}
-	};
-
-	struct FEdge
-	{
-		int32 A, B; // A < B
-
-		FEdge(int32 InA, int32 InB);
-		bool operator==(const FEdge& Other) const;
+	/** Insertion order: biased randomized rounds (BRIO), each sorted along a 3D Hilbert curve. */
+	static void ComputeInsertionOrder(
+		const TArray<FVector>& Points,
+		TArrayView<int32> OutOrder);
 
-		friend uint32 GetTypeHash(const FEdge& E)
-		{
-			return HashCombine(::GetTypeHash(E.A), ::GetTypeHash(E.B));
-		}
-	};
+	/**
+	 * Visibility walk from StartTet toward Point. Returns the tetrahedron containing Point,
+	 * or INDEX_NONE if the walk did not settle within its step budget.
+	 */
+	static int32 LocateTetrahedron(
+		TArrayView<const FVector> Points,
+		TArrayView<const FTetrahedron> Tetrahedra,
+		int32 StartTet,
+		const FVector& Point);
 
-	/** Returns true if Point is inside the circumsphere of the tetrahedron. */
+	/** Returns true if Points[PointIdx] is inside the (symbolically perturbed) circumsphere of Tet. */
 	static bool IsInCircumsphere(
-		const TArray<FVector>& Points,
+		TArrayView<const FVector> Points,
 		const FTetrahedron& Tet,
-		const FVector& Point);
-
-	/** Compute the orientation sign of tetrahedron (positive = right-handed). */
-	static double Orientation(
-		const FVector& A, const FVector& B,
-		const FVector& C, const FVector& D);
+		int32 PointIdx);
 };
@@ -4,46 +4,52 @@
 
 /**
  * FDelaunayTriangulation
- * 2D Bowyer-Watson Delaunay triangulation.
- * Takes room center points and produces connectivity edges.
- * Phase 1: 2D only. Will be extended to 3D tetrahedralization in Phase 2.
+ * Incremental 2D Delaunay (Bowyer-Watson on a neighbor-linked mesh), the planar counterpart of
+ * FDelaunayTetrahedralization. Takes room center points projected to a plane and produces
+ * connectivity edges in the same format. Points are inserted in BRIO/Hilbert order, each located
+ * by a visibility walk and its cavity grown over adjacency, with exact predicates
+ * (FGeometricPredicates) and symbolic perturbation for cocircular and collinear input.
  */
 struct DUNGEONCORE_API FDelaunayTriangulation
 {
 	/**
 	 * Compute Delaunay triangulation of 2D points.
-	 * @param Points     Room center positions projected to 2D (X, Z plane).
-	 * @param OutEdges   Unique edges as pairs of point indices (0-based).
+	 * @param Points     Room center positions projected to 2D.
+	 * @param OutEdges   Unique edges as pairs of point indices (0-based), sorted.
 	 */
 	static void Triangulate(
 		const TArray<FVector2D>& Points,
 		TArray<TPair<int32, int32>>& OutEdges);
 
 private:
+	/**
+	 * Counter-clockwise triangle. N[i] is the triangle across the edge opposite V[i]
+	 * (INDEX_NONE on the super-triangle's hull). V[0] == INDEX_NONE marks a free slot.
+	 */
 	struct FTriangle
 	{
 		int32 V[3];
-		bool ContainsVertex(int32 Idx) const;
+		int32 N[3];
 	};
 
-	struct FEdge
-	{
-		int32 A, B;
-
-		FEdge() : A(0), B(0) {}
-		FEdge(int32 InA, int32 InB);
-		bool operator==(const FEdge& Other) const;
+	/** Insertion order: biased randomized rounds (BRIO), each sorted along a 2D Hilbert curve. */
+	static void ComputeInsertionOrder(
+		const TArray<FVector2D>& Points,
+		TArray<int32>& OutOrder);
 
-		friend uint32 GetTypeHash(const FEdge& E)
-		{
-			return HashCombine(::GetTypeHash(FMath::Min(E.A, E.B)),
-				::GetTypeHash(FMath::Max(E.A, E.B)));
-		}
-	};
+	/**
+	 * Visibility walk from StartTri toward Point. Returns the triangle containing Point,
+	 * or INDEX_NONE if the walk did not settle within its step budget.
+	 */
+	static int32 LocateTriangle(
+		const TArray<FVector2D>& Points,
+		const TArray<FTriangle>& Triangles,
+		int32 StartTri,
+		const FVector2D& Point);
 
-	/** Returns true if Point is inside the circumcircle of the triangle. */
+	/** Returns true if Points[PointIdx] is inside the (symbolically perturbed) circumcircle of Tri. */
 	static bool IsInCircumcircle(
 		const TArray<FVector2D>& Points,
 		const FTriangle& Tri,
-		const FVector2D& Point);
+		int32 PointIdx);
 };
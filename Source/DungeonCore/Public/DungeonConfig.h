@@ -47,6 +47,21 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Rooms", meta=(ClampMin="10", ClampMax="1000"))
 	int32 MaxPlacementAttempts = 100;
 
+	/**
+	 * How rooms are positioned. SummedAreaTable only ever picks positions that fit, so dense
+	 * grids stop dropping rooms; it draws from the seed differently, so layouts change.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Rooms")
+	EDungeonRoomPlacement RoomPlacementMode = EDungeonRoomPlacement::RejectionSampling;
+
+	/**
+	 * Minimum distance (cells) between room centers for PoissonDisk placement, with each floor
+	 * counting as a staircase's length. 0 derives it from the grid area and RoomCount and
+	 * tightens it as needed to place every room; a set value is never tightened.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Rooms", meta=(ClampMin="0.0", ClampMax="100.0", EditCondition="RoomPlacementMode==EDungeonRoomPlacement::PoissonDisk"))
+	float RoomCenterSpacing = 0.0f;
+
 	// --- Room Semantics (Phase 3 — defined here for data asset completeness) ---
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Room Types")
@@ -60,6 +75,22 @@ public:
 
 	// --- Hallways ---
 
+	/**
+	 * How candidate connections between rooms are found before the spanning tree. NearestNeighbors
+	 * skips the Delaunay stage for a sparse k-nearest-neighbor graph, much cheaper at very high room
+	 * counts; its candidate edges differ, so layouts change.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Hallways")
+	EDungeonRoomGraph RoomGraphMode = EDungeonRoomGraph::Delaunay;
+
+	/** Nearest rooms each room is linked to in NearestNeighbors mode, before pruning. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Hallways", meta=(ClampMin="1", ClampMax="32", EditCondition="RoomGraphMode==EDungeonRoomGraph::NearestNeighbors"))
+	int32 NeighborCount = 8;
+
+	/** Pruning applied to the nearest-neighbor graph. The pruned graph is still connected. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Hallways", meta=(EditCondition="RoomGraphMode==EDungeonRoomGraph::NearestNeighbors"))
+	EDungeonNeighborPruning NeighborPruning = EDungeonNeighborPruning::Gabriel;
+
 	/** Probability of re-adding non-MST Delaunay edges (creates loops). */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Hallways", meta=(ClampMin="0.0", ClampMax="1.0"))
 	float EdgeReadditionChance = 0.125f;
@@ -72,6 +103,66 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Hallways", meta=(ClampMin="1.0", ClampMax="10.0"))
 	float RoomPassthroughCostMultiplier = 3.0f;
 
+	/**
+	 * Search each hallway inside its two rooms' bounding box (plus margin) first, widening to the
+	 * full grid only if that fails. Much cheaper on large grids; may pick a different (locally
+	 * optimal) route than an unbounded search, so existing seeds can change layout.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Hallways")
+	bool bBoundHallwaySearch = false;
+
+	/** Cells added on every side of the rooms' bounding box when bBoundHallwaySearch is on. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Hallways", meta=(ClampMin="0", ClampMax="32", EditCondition="bBoundHallwaySearch"))
+	int32 HallwaySearchMargin = 4;
+
+	/**
+	 * Pathfinding strategy for hallways. Bidirectional explores far fewer cells on long cross-dungeon
+	 * edges; JumpPoint cuts heap traffic on large, sparse floors; Hierarchical plans over coarse
+	 * clusters first and suits very large grids.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Hallways")
+	EDungeonHallwaySearch HallwaySearchMode = EDungeonHallwaySearch::AStar;
+
+	/** Hallways shorter than this (Manhattan cells) use plain A* even in Bidirectional mode. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Hallways", meta=(ClampMin="0", ClampMax="1000", EditCondition="HallwaySearchMode==EDungeonHallwaySearch::Bidirectional"))
+	int32 BidirectionalMinDistance = 24;
+
+	/**
+	 * Use a radix heap keyed on fixed-point F scores for the A* open set instead of the binary heap.
+	 * Cheaper push/pop on large searches; ties between near-equal scores can resolve differently,
+	 * so existing seeds may pick different (equal-quality) routes. Bidirectional searches keep the
+	 * binary heap.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Hallways")
+	bool bUseRadixOpenSet = false;
+
+	/**
+	 * Search each hallway from every ground-floor boundary cell of one room to the first boundary
+	 * cell of the other, instead of center to center. Shallower searches; hallway paths start and
+	 * end at their doors. Changes layouts for existing seeds.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Hallways")
+	bool bMultiGoalHallwaySearch = false;
+
+	/**
+	 * Cluster edge length (cells) for Hierarchical hallway search. Larger clusters mean a smaller
+	 * abstract graph but more work refining each leg and rebuilding clusters after a carve.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Hallways", meta=(ClampMin="4", ClampMax="64", EditCondition="HallwaySearchMode==EDungeonHallwaySearch::Hierarchical"))
+	int32 HierarchicalClusterSize = 16;
+
+	/**
+	 * Search upcoming hallways in parallel against the grid as it stands, then carve them in edge
+	 * order, re-running only searches an earlier carve in the same batch could have affected.
+	 * Layouts are identical to sequential carving. Ignored in JumpPoint and Hierarchical modes.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Hallways")
+	bool bSpeculativeHallwayCarving = false;
+
+	/** Hallways searched together per speculative batch when bSpeculativeHallwayCarving is on. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Hallways", meta=(ClampMin="2", ClampMax="64", EditCondition="bSpeculativeHallwayCarving"))
+	int32 SpeculativeHallwayBatchSize = 8;
+
 	// --- Staircases (Phase 2) ---
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Staircases", meta=(ClampMin="1", ClampMax="5"))
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DungeonTypes.h"
+#include "RoomSemantics.h"
+
+class UDungeonConfiguration;
+
+/**
+ * FDungeonGenerationParams
+ * Plain snapshot of the generation-relevant fields of a UDungeonConfiguration.
+ * Captured once on the calling thread; every DungeonCore stage reads only this struct,
+ * so generation can run on worker threads or in a standalone harness without the data asset.
+ * Holds no UObject references. Seed settings (bUseFixedSeed/FixedSeed) are not part of the
+ * snapshot — the seed is always passed to the generator explicitly.
+ */
+struct DUNGEONCORE_API FDungeonGenerationParams
+{
+	// --- Grid ---
+	FIntVector GridSize = FIntVector(30, 30, 5);
+	float CellWorldSize = 400.0f;
+
+	// --- Rooms ---
+	int32 RoomCount = 8;
+	FIntVector MinRoomSize = FIntVector(3, 3, 1);
+	FIntVector MaxRoomSize = FIntVector(7, 7, 2);
+	int32 RoomBuffer = 1;
+	int32 MaxPlacementAttempts = 100;
+	EDungeonRoomPlacement RoomPlacementMode = EDungeonRoomPlacement::RejectionSampling;
+	float RoomCenterSpacing = 0.0f;
+
+	// --- Room Semantics ---
+	TArray<FDungeonRoomTypeRule> RoomTypeRules;
+	bool bGuaranteeEntrance = true;
+	bool bGuaranteeBossRoom = true;
+
+	// --- Hallways ---
+	EDungeonRoomGraph RoomGraphMode = EDungeonRoomGraph::Delaunay;
+	int32 NeighborCount = 8;
+	EDungeonNeighborPruning NeighborPruning = EDungeonNeighborPruning::Gabriel;
+	float EdgeReadditionChance = 0.125f;
+	float HallwayMergeCostMultiplier = 0.5f;
+	float RoomPassthroughCostMultiplier = 3.0f;
+	bool bBoundHallwaySearch = false;
+	int32 HallwaySearchMargin = 4;
+	EDungeonHallwaySearch HallwaySearchMode = EDungeonHallwaySearch::AStar;
+	int32 BidirectionalMinDistance = 24;
+	bool bUseRadixOpenSet = false;
+	bool bMultiGoalHallwaySearch = false;
+	int32 HierarchicalClusterSize = 16;
+	bool bSpeculativeHallwayCarving = false;
+	int32 SpeculativeHallwayBatchSize = 8;
+
+	// --- Staircases ---
+	int32 StaircaseRiseToRun = 2;
+	int32 StaircaseHeadroom = 2;
+
+	// --- Entrance ---
+	EDungeonEntrancePlacement EntrancePlacement = EDungeonEntrancePlacement::BoundaryEdge;
+
+	/** Copy all generation parameters out of a configuration asset. Call on the game thread. */
+	static FDungeonGenerationParams FromConfig(const UDungeonConfiguration& Config);
+
+	/**
+	 * Hash of every field that influences generation. Defined byte-by-byte (FNV-1a over
+	 * little-endian field values), so it is stable across runs, builds, and platforms and
+	 * can be persisted. Seed + hash identifies a layout.
+	 */
+	uint64 GetStableHash() const;
+};
@@ -1,10 +1,85 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Async/Future.h"
 #include "DungeonTypes.h"
+#include <atomic>
 #include "DungeonGenerator.generated.h"
 
 class UDungeonConfiguration;
+struct FDungeonGenerationParams;
+
+/** Pipeline stages reported through FDungeonGenerationProgress, in execution order. */
+UENUM(BlueprintType)
+enum class EDungeonGenerationStage : uint8
+{
+	NotStarted,
+	RoomPlacement,
+	EntranceSelection,
+	Tetrahedralization,
+	SpanningTree,
+	EdgeReaddition,
+	RoomSemantics,
+	HallwayCarving,
+	Validation,
+	Complete,
+	Cancelled,
+};
+
+/**
+ * FDungeonGenerationProgress
+ * Progress and cancellation state shared between a caller and an in-flight generation.
+ * Written by the pipeline, polled by the caller (e.g. from Tick). Cancellation is cooperative:
+ * the pipeline checks between stages and between hallway edges.
+ */
+struct DUNGEONCORE_API FDungeonGenerationProgress
+{
+	/** Request cancellation. The pipeline stops at its next checkpoint and returns an empty result. */
+	void Cancel() { bCancelRequested.store(true, std::memory_order_relaxed); }
+
+	bool IsCancelRequested() const { return bCancelRequested.load(std::memory_order_relaxed); }
+
+	/** True once the pipeline has observed a cancel request and stopped. */
+	bool WasCancelled() const { return GetStage() == EDungeonGenerationStage::Cancelled; }
+
+	EDungeonGenerationStage GetStage() const
+	{
+		return static_cast<EDungeonGenerationStage>(Stage.load(std::memory_order_acquire));
+	}
+
+	/** Completion of the current stage in [0, 1]. Hallway carving advances per edge; other stages report 0 then move on. */
+	float GetStageFraction() const { return StageFraction.load(std::memory_order_relaxed); }
+
+	void SetStage(EDungeonGenerationStage InStage, float InFraction = 0.0f)
+	{
+		StageFraction.store(InFraction, std::memory_order_relaxed);
+		Stage.store(static_cast<uint8>(InStage), std::memory_order_release);
+	}
+
+	void SetStageFraction(float InFraction) { StageFraction.store(InFraction, std::memory_order_relaxed); }
+
+private:
+	std::atomic<bool> bCancelRequested{false};
+	std::atomic<uint8> Stage{static_cast<uint8>(EDungeonGenerationStage::NotStarted)};
+	std::atomic<float> StageFraction{0.0f};
+};
+
+/** Throughput counters for one GenerateBatch call. */
+struct DUNGEONCORE_API FDungeonBatchStats
+{
+	int32 DungeonCount = 0;
+
+	/** Task graph worker threads available to the batch (excludes the calling thread). */
+	int32 WorkerThreadCount = 0;
+
+	/** Wall-clock time for the whole batch. */
+	double WallTimeMs = 0.0;
+
+	/** Sum of per-dungeon GenerationTimeMs. WallTimeMs / TotalGenerationTimeMs approximates parallel efficiency. */
+	double TotalGenerationTimeMs = 0.0;
+
+	double DungeonsPerSecond = 0.0;
+};
 
 /**
  * UDungeonGenerator
@@ -25,6 +100,52 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Dungeon|Generation")
 	FDungeonResult Generate(UDungeonConfiguration* Config, int64 Seed);
 
+	/**
+	 * Generate a dungeon from a parameter snapshot. UObject-free; safe to call from any thread.
+	 * Produces the same result as Generate for a config whose FromConfig snapshot equals Params.
+	 */
+	static FDungeonResult GenerateFromParams(const FDungeonGenerationParams& Params, int64 Seed);
+
+	/**
+	 * Generate a dungeon on a background task. Runs the same pipeline as Generate, so the
+	 * result is identical for the same config and seed.
+	 * Config is snapshotted into FDungeonGenerationParams before this returns; later edits
+	 * to the asset do not affect the in-flight generation.
+	 * @param Config    Generation parameters.
+	 * @param Seed      Random seed. 0 = use current time.
+	 * @param Progress  Optional shared state for polling the current stage and requesting cancellation.
+	 * @return Future fulfilled on the worker thread. Empty result if cancelled or Config is null.
+	 */
+	static TFuture<FDungeonResult> GenerateAsync(
+		UDungeonConfiguration* Config,
+		int64 Seed,
+		TSharedPtr<FDungeonGenerationProgress> Progress = nullptr);
+
+	/** UObject-free overload of GenerateAsync. Params is copied into the task. */
+	static TFuture<FDungeonResult> GenerateAsync(
+		const FDungeonGenerationParams& Params,
+		int64 Seed,
+		TSharedPtr<FDungeonGenerationProgress> Progress = nullptr);
+
+	/**
+	 * Generate one dungeon per seed, fanned out across task graph workers.
+	 * Each result is identical to calling Generate with the same config and seed.
+	 * @param Config    Generation parameters. Snapshotted once; workers never read the asset.
+	 * @param Seeds     One seed per dungeon. 0 = use current time.
+	 * @param OutStats  Optional throughput counters (wall time, dungeons/sec).
+	 * @return Results in the same order as Seeds.
+	 */
+	static TArray<FDungeonResult> GenerateBatch(
+		UDungeonConfiguration* Config,
+		TArrayView<const int64> Seeds,
+		FDungeonBatchStats* OutStats = nullptr);
+
+	/** UObject-free overload of GenerateBatch. Safe to call from any thread. */
+	static TArray<FDungeonResult> GenerateBatch(
+		const FDungeonGenerationParams& Params,
+		TArrayView<const int64> Seeds,
+		FDungeonBatchStats* OutStats = nullptr);
+
 	/**
 	 * Get world-space positions for all grid cells of a given type.
 	 * Useful for debug visualization (spawn cubes/spheres at each position).
@@ -34,4 +155,11 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Dungeon|Debug", meta=(DisplayName="Get Cell Positions By Type"))
 	static TArray<FVector> GetCellWorldPositionsByType(const FDungeonResult& Result, EDungeonCellType CellType);
+
+private:
+	/** Run all pipeline steps on the calling thread. Shared by every public entry point. */
+	static FDungeonResult RunPipeline(
+		const FDungeonGenerationParams& Params,
+		int64 Seed,
+		FDungeonGenerationProgress* Progress);
 };
@@ -0,0 +1,7 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+/** "stat Dungeon" — per-stage cycle counters for the generation pipeline. Declared per .cpp with DECLARE_CYCLE_STAT. */
+DECLARE_STATS_GROUP(TEXT("Dungeon"), STATGROUP_Dungeon, STATCAT_Advanced);
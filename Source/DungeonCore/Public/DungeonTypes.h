@@ -47,6 +47,66 @@ enum class EDungeonEntrancePlacement : uint8
 	Any,
 };
 
+/** Search strategy FHallwayPathfinder uses to route a hallway. */
+UENUM(BlueprintType)
+enum class EDungeonHallwaySearch : uint8
+{
+	/** Unidirectional A* from room A to room B. */
+	AStar,
+	/** A* from both rooms at once, meeting in the middle. Applied to hallways at least BidirectionalMinDistance long. */
+	Bidirectional,
+	/** A* that jumps across runs of Empty cells on the goal floor instead of pushing every cell. */
+	JumpPoint,
+	/**
+	 * HPA*: route over a graph of per-floor cluster entrances, then refine only inside the clusters
+	 * on that route. Falls back to plain A* when the abstract route cannot be refined.
+	 */
+	Hierarchical,
+};
+
+/** How FRoomPlacement picks room positions. */
+UENUM(BlueprintType)
+enum class EDungeonRoomPlacement : uint8
+{
+	/** Draw a size and position per attempt and reject it on overlap, up to MaxPlacementAttempts per room. */
+	RejectionSampling,
+	/**
+	 * Draw a size, then pick uniformly among the positions where it fits, read off an occupancy
+	 * summed-area table. Places every room while a minimum-size room still fits anywhere.
+	 */
+	SummedAreaTable,
+	/**
+	 * Bridson-style Poisson-disk sampling: each room is grown off an existing one at one to two
+	 * times RoomCenterSpacing from it and at least that far from every other, for evenly spread rooms.
+	 */
+	PoissonDisk,
+};
+
+/** How Generate finds the candidate room connections the spanning tree and loop edges are drawn from. */
+UENUM(BlueprintType)
+enum class EDungeonRoomGraph : uint8
+{
+	/** Delaunay tetrahedralization of the room centers (triangulation for single-floor layouts). */
+	Delaunay,
+	/**
+	 * Each room linked to its NeighborCount nearest rooms through a uniform grid, optionally pruned,
+	 * and bridged across any gaps so the graph stays connected. Linear time in practice.
+	 */
+	NearestNeighbors,
+};
+
+/** Edge pruning applied to the NearestNeighbors room graph. */
+UENUM(BlueprintType)
+enum class EDungeonNeighborPruning : uint8
+{
+	/** Keep every nearest-neighbor edge. */
+	None,
+	/** Drop an edge when another room lies strictly inside the sphere it is a diameter of. */
+	Gabriel,
+	/** Drop an edge when another room is strictly closer to both its ends than they are to each other. Sparser than Gabriel. */
+	RelativeNeighborhood,
+};
+
 // ============================================================================
 // Plain Structs (not USTRUCT — performance-critical dense storage)
 // ============================================================================
@@ -66,6 +126,26 @@ struct DUNGEONCORE_API FDungeonCell
 
 static_assert(sizeof(FDungeonCell) == 8, "FDungeonCell must be exactly 8 bytes");
 
+/**
+ * FDungeonGrid's revision stamp. Every grid, and every copy of one, counts within its own block of
+ * 2^32 stamps, so two grid states never share a stamp even at the same address.
+ */
+struct DUNGEONCORE_API FDungeonGridRevision
+{
+	uint64 Value;
+
+	FDungeonGridRevision() : Value(NewSequence()) {}
+	FDungeonGridRevision(const FDungeonGridRevision&) : Value(NewSequence()) {}
+	FDungeonGridRevision& operator=(const FDungeonGridRevision&)
+	{
+		Value = NewSequence();
+		return *this;
+	}
+
+	/** First stamp of a block no other grid has used. */
+	static uint64 NewSequence();
+};
+
 /** 3D grid holding all cell data. Indexed as [X + Y*SizeX + Z*SizeX*SizeY]. */
 struct DUNGEONCORE_API FDungeonGrid
 {
@@ -84,13 +164,119 @@ struct DUNGEONCORE_API FDungeonGrid
 		return CellIndex(Coord.X, Coord.Y, Coord.Z);
 	}
 
-	FDungeonCell& GetCell(int32 X, int32 Y, int32 Z);
 	const FDungeonCell& GetCell(int32 X, int32 Y, int32 Z) const;
-	FDungeonCell& GetCell(const FIntVector& Coord);
 	const FDungeonCell& GetCell(const FIntVector& Coord) const;
 
+	/** Mutable access to one cell for a single-cell write; advances the revision (see GetRevision). */
+	FDungeonCell& GetCellForWrite(int32 X, int32 Y, int32 Z);
+	FDungeonCell& GetCellForWrite(const FIntVector& Coord);
+
 	bool IsInBounds(int32 X, int32 Y, int32 Z) const;
 	bool IsInBounds(const FIntVector& Coord) const;
+
+	/** Clamp the half-open box [InOutMin, InOutMaxExclusive) to the grid. False if nothing is left. */
+	bool ClipBox(FIntVector& InOutMin, FIntVector& InOutMaxExclusive) const;
+
+	// --- Bulk writers ---
+	// Each clips once, then writes whole X-runs. Mask selects which bits come from Value (a set
+	// bit takes Value's bit, a clear bit keeps the cell's); omit it to overwrite cells outright.
+	// All return the number of cells written.
+
+	/** Fill cells [MinX, MaxXExclusive) of row (Y, Z). */
+	int32 FillRow(int32 Y, int32 Z, int32 MinX, int32 MaxXExclusive, const FDungeonCell& Value);
+	int32 FillRow(int32 Y, int32 Z, int32 MinX, int32 MaxXExclusive, const FDungeonCell& Value, const FDungeonCell& Mask);
+
+	/** Fill the half-open box [Min, MaxExclusive). */
+	int32 FillBox(const FIntVector& Min, const FIntVector& MaxExclusive, const FDungeonCell& Value);
+	int32 FillBox(const FIntVector& Min, const FIntVector& MaxExclusive, const FDungeonCell& Value, const FDungeonCell& Mask);
+
+	/**
+	 * Fill only the cells of [Min, MaxExclusive) whose type is in MatchTypes (see CellTypeBit),
+	 * calling OnWritten for each one written.
+	 */
+	int32 FillBoxWhere(const FIntVector& Min, const FIntVector& MaxExclusive, uint32 MatchTypes,
+		const FDungeonCell& Value, const FDungeonCell& Mask, TFunctionRef<void(const FIntVector&)> OnWritten);
+
+	static constexpr uint32 CellTypeBit(EDungeonCellType Type)
+	{
+		return 1u << static_cast<uint32>(Type);
+	}
+
+	/** A mask cell with every bit set in the named fields, e.g. FieldMask(&FDungeonCell::CellType). */
+	template <typename... FieldTypes>
+	static FDungeonCell FieldMask(FieldTypes FDungeonCell::*... Fields)
+	{
+		FDungeonCell Mask;
+		((reinterpret_cast<uint8&>(Mask.*Fields) = 0xFF), ...);
+		return Mask;
+	}
+
+	/**
+	 * Stamp of the current cell contents, for caches derived from the grid (FHallwayCostField,
+	 * FStaircaseMaskCache). Initialize, each GetCellForWrite, each FillRow/FillBox call and each
+	 * cell FillBoxWhere writes advance it by one. Code writing Cells directly must call MarkChanged.
+	 */
+	FORCEINLINE uint64 GetRevision() const { return Revision.Value; }
+	FORCEINLINE void MarkChanged() { ++Revision.Value; }
+
+private:
+	FDungeonGridRevision Revision;
+};
+
+/** Search counters for one FHallwayPathfinder::FindPath call. */
+struct DUNGEONCORE_API FPathfindStats
+{
+	/** Heap pops, including stale ones. */
+	int32 NodesPopped = 0;
+	int32 NodesPushed = 0;
+
+	/** Pops of cells already closed via a cheaper entry (lazy-deletion duplicates). */
+	int32 StalePops = 0;
+
+	int32 StaircaseProbes = 0;
+	int32 StaircaseRejections = 0;
+
+	/** Cells whose staircase mask was not cached and had to be built (8 CanBuildStaircase calls each). */
+	int32 StaircaseMaskMisses = 0;
+
+	int32 PeakOpenSetSize = 0;
+
+	/** Cells visited by jump point scans without being pushed (JumpPoint mode only). */
+	int32 JumpScanCells = 0;
+
+	/** Windowed searches that found nothing and were repeated on the full grid. */
+	int32 WindowFallbacks = 0;
+
+	/** Clusters whose abstract-graph edges were (re)computed before this search (Hierarchical mode only). */
+	int32 ClustersRebuilt = 0;
+
+	/** Hierarchical searches whose abstract route could not be refined and were repeated as flat A*. */
+	int32 HierarchicalFallbacks = 0;
+
+	/** Speculative searches thrown away because an earlier hallway in the batch carved cells they read. */
+	int32 SpeculativeReruns = 0;
+
+	double WallTimeMs = 0.0;
+	bool bFoundPath = false;
+
+	/** Accumulate another search into this one. Peak is the max, everything else sums. */
+	FPathfindStats& operator+=(const FPathfindStats& Other)
+	{
+		NodesPopped += Other.NodesPopped;
+		NodesPushed += Other.NodesPushed;
+		StalePops += Other.StalePops;
+		StaircaseProbes += Other.StaircaseProbes;
+		StaircaseRejections += Other.StaircaseRejections;
+		StaircaseMaskMisses += Other.StaircaseMaskMisses;
+		PeakOpenSetSize = FMath::Max(PeakOpenSetSize, Other.PeakOpenSetSize);
+		JumpScanCells += Other.JumpScanCells;
+		WindowFallbacks += Other.WindowFallbacks;
+		ClustersRebuilt += Other.ClustersRebuilt;
+		HierarchicalFallbacks += Other.HierarchicalFallbacks;
+		SpeculativeReruns += Other.SpeculativeReruns;
+		WallTimeMs += Other.WallTimeMs;
+		return *this;
+	}
 };
 
 // ============================================================================
@@ -187,6 +373,47 @@ struct DUNGEONCORE_API FDungeonStaircase
 	TArray<FIntVector> OccupiedCells;
 };
 
+/** Wall-clock milliseconds spent in each pipeline step. Sums to slightly less than GenerationTimeMs. */
+USTRUCT(BlueprintType)
+struct DUNGEONCORE_API FDungeonStageTimings
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category="Dungeon")
+	double RoomPlacementMs = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category="Dungeon")
+	double EntranceSelectionMs = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category="Dungeon")
+	double TetrahedralizationMs = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category="Dungeon")
+	double SpanningTreeMs = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category="Dungeon")
+	double EdgeReadditionMs = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category="Dungeon")
+	double RoomSemanticsMs = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category="Dungeon")
+	double HallwayCarvingMs = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category="Dungeon")
+	double MetricsMs = 0.0;
+
+	/** Always 0 in shipping builds (validation is compiled out). */
+	UPROPERTY(BlueprintReadOnly, Category="Dungeon")
+	double ValidationMs = 0.0;
+
+	double GetTotalMs() const
+	{
+		return RoomPlacementMs + EntranceSelectionMs + TetrahedralizationMs + SpanningTreeMs
+			+ EdgeReadditionMs + RoomSemanticsMs + HallwayCarvingMs + MetricsMs + ValidationMs;
+	}
+};
+
 /** Complete immutable output of the dungeon generator. */
 USTRUCT(BlueprintType)
 struct DUNGEONCORE_API FDungeonResult
@@ -204,6 +431,9 @@ struct DUNGEONCORE_API FDungeonResult
 	UPROPERTY(BlueprintReadOnly, Category="Dungeon")
 	float CellWorldSize = 400.0f;
 
+	/** FDungeonGenerationParams::GetStableHash of the params used (C++ only — uint64 not Blueprint-safe). */
+	uint64 ParamsHash = 0;
+
 	// -- Grid data (C++ only — too large for Blueprint) --
 	FDungeonGrid Grid;
 
@@ -236,6 +466,15 @@ struct DUNGEONCORE_API FDungeonResult
 	UPROPERTY(BlueprintReadOnly, Category="Dungeon")
 	double GenerationTimeMs = 0.0;
 
+	UPROPERTY(BlueprintReadOnly, Category="Dungeon")
+	FDungeonStageTimings StageTimings;
+
+	/** Pathfinder counters, one per FinalEdges entry (same index). C++ only. */
+	TArray<FPathfindStats> PathfindStats;
+
+	/** Sum of PathfindStats (PeakOpenSetSize is the max over all searches). */
+	FPathfindStats PathfindTotals;
+
 	UPROPERTY(BlueprintReadOnly, Category="Dungeon")
 	int32 TotalRoomCells = 0;
 
@@ -4,7 +4,7 @@
 #include "CoreMinimal.h"
 #include "DungeonTypes.h"
 
-class UDungeonConfiguration;
+struct FDungeonGenerationParams;
 
 /** A single validation issue found in a dungeon result. */
 struct DUNGEONCORE_API FDungeonValidationIssue
@@ -42,7 +42,7 @@ struct DUNGEONCORE_API FDungeonValidationResult
 struct DUNGEONCORE_API FDungeonValidator
 {
 	/** Run all validations and return aggregated result. */
-	static FDungeonValidationResult ValidateAll(const FDungeonResult& Result, const UDungeonConfiguration& Config);
+	static FDungeonValidationResult ValidateAll(const FDungeonResult& Result, const FDungeonGenerationParams& Params);
 
 	/** Entrance room and cell exist and are marked correctly. */
 	static void ValidateEntrance(const FDungeonResult& Result, TArray<FDungeonValidationIssue>& OutIssues);
@@ -57,7 +57,7 @@ struct DUNGEONCORE_API FDungeonValidator
 	static void ValidateNoRoomOverlap(const FDungeonResult& Result, TArray<FDungeonValidationIssue>& OutIssues);
 
 	/** Buffer distance maintained between rooms (XY only, matching RoomPlacement convention). */
-	static void ValidateRoomBuffer(const FDungeonResult& Result, const UDungeonConfiguration& Config, TArray<FDungeonValidationIssue>& OutIssues);
+	static void ValidateRoomBuffer(const FDungeonResult& Result, const FDungeonGenerationParams& Params, TArray<FDungeonValidationIssue>& OutIssues);
 
 	/** BFS on room adjacency graph from entrance reaches all rooms. */
 	static void ValidateRoomConnectivity(const FDungeonResult& Result, TArray<FDungeonValidationIssue>& OutIssues);
@@ -69,7 +69,7 @@ struct DUNGEONCORE_API FDungeonValidator
 	static void ValidateReachability(const FDungeonResult& Result, TArray<FDungeonValidationIssue>& OutIssues);
 
 	/** Room types assigned correctly per config rules. */
-	static void ValidateRoomSemantics(const FDungeonResult& Result, const UDungeonConfiguration& Config, TArray<FDungeonValidationIssue>& OutIssues);
+	static void ValidateRoomSemantics(const FDungeonResult& Result, const FDungeonGenerationParams& Params, TArray<FDungeonValidationIssue>& OutIssues);
 
 private:
 	/** Flood fill from Start through non-Empty cells in 6 directions. Populates VisitedIndices with flat cell indices. */
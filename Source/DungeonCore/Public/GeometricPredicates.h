@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * FGeometricPredicates
+ * Robust orientation, in-circle and in-sphere tests for the Delaunay stage, after Shewchuk: a
+ * floating-point evaluation with a static error bound answers almost every query, and only results
+ * too close to zero to trust are recomputed exactly with floating-point expansions. Signs are
+ * always exact.
+ */
+struct DUNGEONCORE_API FGeometricPredicates
+{
+	/**
+	 * det[B-A, C-A]: positive if A, B, C wind counter-clockwise, negative if clockwise,
+	 * zero if collinear. Only the sign is exact.
+	 */
+	static double Orient2D(
+		const FVector2D& A, const FVector2D& B,
+		const FVector2D& C);
+
+	/**
+	 * Positive if D lies inside the circumcircle of A, B, C when they wind counter-clockwise
+	 * (the sign flips for a clockwise triangle), zero if the four points are cocircular.
+	 * Only the sign is exact.
+	 */
+	static double InCircle(
+		const FVector2D& A, const FVector2D& B,
+		const FVector2D& C, const FVector2D& D);
+
+	/**
+	 * InCircle with the same index-ordered symbolic perturbation as InSpherePerturbed.
+	 * Returns +1 or -1 (0 only if A, B, C are collinear and every tie-break vanishes too).
+	 */
+	static int32 InCirclePerturbed(
+		TArrayView<const FVector2D> Points,
+		int32 A, int32 B, int32 C, int32 D);
+
+	/**
+	 * det[B-A, C-A, D-A]: positive if A, B, C, D form a right-handed (positively oriented)
+	 * tetrahedron, negative if left-handed, zero if coplanar. Only the sign is exact.
+	 */
+	static double Orient3D(
+		const FVector& A, const FVector& B,
+		const FVector& C, const FVector& D);
+
+	/**
+	 * Positive if E lies inside the circumsphere of A, B, C, D when Orient3D(A, B, C, D) > 0
+	 * (the sign flips for a negatively oriented tetrahedron), zero if the five points are
+	 * cospherical. Only the sign is exact.
+	 */
+	static double InSphere(
+		const FVector& A, const FVector& B,
+		const FVector& C, const FVector& D,
+		const FVector& E);
+
+	/**
+	 * InSphere with symbolic perturbation, never zero for a non-degenerate tetrahedron: each
+	 * point's lifted coordinate |p|^2 is raised by an infinitesimal that grows with its index,
+	 * so cospherical ties break the same way every time they are asked. Returns +1 or -1 (0 only
+	 * if A, B, C, D are coplanar and every tie-break vanishes too).
+	 */
+	static int32 InSpherePerturbed(
+		TArrayView<const FVector> Points,
+		int32 A, int32 B, int32 C, int32 D, int32 E);
+};
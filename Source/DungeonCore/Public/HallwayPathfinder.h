@@ -3,8 +3,438 @@
 #include "CoreMinimal.h"
 
 struct FDungeonGrid;
+struct FDungeonRoom;
 struct FDungeonStaircase;
-class UDungeonConfiguration;
+struct FDungeonGenerationParams;
+struct FPathfindStats;
+
+/**
+ * FPathSearchWindow
+ * Inclusive cell-space box that confines an A* search. Workspace arrays are sized to the
+ * window rather than the grid, so short hallways touch a small fraction of the cells.
+ */
+struct DUNGEONCORE_API FPathSearchWindow
+{
+	FIntVector Min = FIntVector::ZeroValue;
+	FIntVector Max = FIntVector::ZeroValue;
+
+	FPathSearchWindow() = default;
+	FPathSearchWindow(const FIntVector& InMin, const FIntVector& InMax) : Min(InMin), Max(InMax) {}
+
+	static FPathSearchWindow FullGrid(const FIntVector& GridSize)
+	{
+		return FPathSearchWindow(FIntVector::ZeroValue, GridSize - FIntVector(1, 1, 1));
+	}
+
+	/** Bounding box of both rooms grown by Margin cells on every axis, clamped to the grid. */
+	static FPathSearchWindow FromRooms(
+		const FDungeonRoom& RoomA,
+		const FDungeonRoom& RoomB,
+		int32 Margin,
+		const FIntVector& GridSize);
+
+	FPathSearchWindow ClampedTo(const FIntVector& GridSize) const;
+
+	FORCEINLINE bool Contains(const FIntVector& Coord) const
+	{
+		return Coord.X >= Min.X && Coord.X <= Max.X
+			&& Coord.Y >= Min.Y && Coord.Y <= Max.Y
+			&& Coord.Z >= Min.Z && Coord.Z <= Max.Z;
+	}
+
+	bool CoversGrid(const FIntVector& GridSize) const
+	{
+		return Min == FIntVector::ZeroValue && Max == GridSize - FIntVector(1, 1, 1);
+	}
+
+	FORCEINLINE FIntVector Size() const { return Max - Min + FIntVector(1, 1, 1); }
+
+	FORCEINLINE int32 Num() const
+	{
+		const FIntVector S = Size();
+		return S.X * S.Y * S.Z;
+	}
+
+	/** Dense index of a contained cell, X fastest (same layout as FDungeonGrid). */
+	FORCEINLINE int32 Index(const FIntVector& Coord) const
+	{
+		const FIntVector S = Size();
+		return (Coord.X - Min.X) + (Coord.Y - Min.Y) * S.X + (Coord.Z - Min.Z) * S.X * S.Y;
+	}
+
+	FORCEINLINE FIntVector Coord(int32 Idx) const
+	{
+		const FIntVector S = Size();
+		return FIntVector(
+			Min.X + Idx % S.X,
+			Min.Y + (Idx / S.X) % S.Y,
+			Min.Z + Idx / (S.X * S.Y));
+	}
+};
+
+/**
+ * FRadixOpenSet
+ * Radix heap over F scores quantized to 1/KeyScale fixed point. Bucket i > 0 holds keys whose
+ * highest bit differing from the last popped key is bit i-1, so push is O(1) and each entry is
+ * redistributed at most 32 times over its lifetime, with no comparator calls.
+ * A radix heap needs keys that never drop below the last pop. Hallway costs make the A*
+ * heuristic inconsistent, so a lower key is clamped up to the last pop: that node is still
+ * popped next, ordered only against ties.
+ */
+struct DUNGEONCORE_API FRadixOpenSet
+{
+	/** Fixed-point resolution of F scores (1/256 cell). */
+	static constexpr float KeyScale = 256.0f;
+
+	void Reset();
+
+	FORCEINLINE void Push(float FScore, int32 CellIdx)
+	{
+		const uint32 Key = FMath::Max(Quantize(FScore), LastKey);
+		Buckets[BucketFor(Key)].Add(FEntry{Key, CellIdx});
+		Count++;
+	}
+
+	/** Remove and return the cell with the smallest key. The set must not be empty. */
+	int32 Pop();
+
+	FORCEINLINE int32 Num() const { return Count; }
+
+	static FORCEINLINE uint32 Quantize(float FScore)
+	{
+		return static_cast<uint32>(FMath::Min(FScore * KeyScale + 0.5f, static_cast<float>(MAX_uint32 >> 1)));
+	}
+
+private:
+	struct FEntry
+	{
+		uint32 Key;
+		int32 CellIdx;
+	};
+
+	static constexpr int32 NumBuckets = 33;
+
+	FORCEINLINE int32 BucketFor(uint32 Key) const
+	{
+		return Key == LastKey ? 0 : 32 - static_cast<int32>(FMath::CountLeadingZeros(Key ^ LastKey));
+	}
+
+	TArray<FEntry> Buckets[NumBuckets];
+	uint32 LastKey = 0;
+	int32 Count = 0;
+};
+
+/**
+ * FHallwayCostField
+ * One byte per grid cell classifying how A* may enter it, built in one pass the first time a
+ * search runs on a grid and then patched cell by cell as hallways are carved. Each search maps
+ * classes to costs from its params; the only per-search exception is that its source and
+ * destination rooms are free, which is checked on Room cells alone.
+ * Keyed on the grid's revision: an edit that was never reported, or a different grid, forces a
+ * full rebuild on the next Bind instead of serving stale classes.
+ */
+struct DUNGEONCORE_API FHallwayCostField
+{
+	enum class ECostClass : uint8
+	{
+		Blocked,   // Staircases, entrances, and room airspace/walls above a room's ground floor
+		Empty,     // Cost 1
+		Hallway,   // Hallway or door, HallwayMergeCostMultiplier
+		Room,      // Room ground floor: RoomPassthroughCostMultiplier, free for source/dest rooms
+		RoomWall,  // Cost 5
+	};
+
+	static constexpr int32 NumClasses = 5;
+
+	/** Attach to Grid, rebuilding every class unless this field is current for Grid's revision. */
+	void Bind(const FDungeonGrid& Grid);
+
+	/**
+	 * Reclassify Coord and the cell above it (whose class depends on what lies below). Keeps the
+	 * field current only if the write being reported is the one grid write since it last was;
+	 * otherwise the field is left for Bind to rebuild.
+	 */
+	void UpdateCell(const FDungeonGrid& Grid, const FIntVector& Coord);
+
+	/** Reclassify every cell in Coords, which must cover all changes since the field was last current. */
+	void UpdateCells(const FDungeonGrid& Grid, TArrayView<const FIntVector> Coords);
+
+	FORCEINLINE ECostClass GetClass(int32 GridIdx) const { return Classes[GridIdx]; }
+
+	/**
+	 * A box holding every Room-class cell of RoomIndex, or false if it has none. Cells leaving the
+	 * Room class don't shrink it until the next full rebuild, so it may be loose but never misses one.
+	 */
+	bool GetRoomBounds(uint8 RoomIndex, FPathSearchWindow& OutBounds) const;
+
+private:
+	void IncludeInRoomBounds(const FDungeonGrid& Grid, const FIntVector& Coord);
+
+	TArray<ECostClass> Classes;
+
+	/** Per RoomIndex; Min.X > Max.X while the room has no Room-class cell. */
+	TArray<FPathSearchWindow> RoomBounds;
+
+	/** Grid revision the classes match; 0 is never issued. */
+	uint64 BoundRevision = 0;
+};
+
+/**
+ * FStaircaseMaskCache
+ * Per-cell bitmask of the staircase moves (4 directions x up/down) CanBuildStaircase allows from
+ * that cell, filled in the first time a search asks. The masks depend only on grid contents, so
+ * they stay valid across searches; whoever edits the grid invalidates the cells around each edit
+ * (CarveHallway does this when given the workspace). Keyed on the grid's revision, like
+ * FHallwayCostField, so an unreported edit or a different grid drops every mask on the next Bind.
+ */
+struct DUNGEONCORE_API FStaircaseMaskCache
+{
+	/**
+	 * Attach to Grid for the given staircase shape. Keeps existing masks if the cache is current for
+	 * Grid's revision and the shape is unchanged, otherwise drops them all.
+	 */
+	void Bind(const FDungeonGrid& Grid, int32 InRiseToRun, int32 InHeadroomCells);
+
+	/** Bit for one move. DirIndex follows +X, -X, +Y, -Y. */
+	static FORCEINLINE uint8 MoveBit(int32 DirIndex, int32 Rise)
+	{
+		return static_cast<uint8>(1 << (DirIndex * 2 + (Rise > 0 ? 0 : 1)));
+	}
+
+	FORCEINLINE bool IsKnown(int32 GridIdx) const { return Known[GridIdx]; }
+	FORCEINLINE uint8 GetMask(int32 GridIdx) const { return Masks[GridIdx]; }
+
+	FORCEINLINE void SetMask(int32 GridIdx, uint8 Mask)
+	{
+		Masks[GridIdx] = Mask;
+		Known[GridIdx] = true;
+	}
+
+	/**
+	 * Forget every mask that reads Coord: entries up to RiseToRun+1 cells away along an axis. Like
+	 * FHallwayCostField::UpdateCell, this keeps the cache current only for the one grid write since
+	 * it last was; after any wider gap the cache is left for Bind to drop.
+	 */
+	void InvalidateAround(const FDungeonGrid& Grid, const FIntVector& Coord);
+
+	/** InvalidateAround for every cell in Coords, which must cover all changes since the cache was last current. */
+	void InvalidateCells(const FDungeonGrid& Grid, TArrayView<const FIntVector> Coords);
+
+private:
+	void ClearAround(const FIntVector& Coord);
+
+	TArray<uint8> Masks;
+	TBitArray<> Known;
+
+	/** Grid revision the masks match; 0 is never issued. */
+	uint64 BoundRevision = 0;
+	FIntVector GridSize = FIntVector::ZeroValue;
+	int32 RiseToRun = 0;
+	int32 HeadroomCells = 0;
+};
+
+/**
+ * FHallwayClusterGraph
+ * Abstract graph for Hierarchical (HPA*) hallway search. Each floor is cut into square clusters;
+ * nodes are entrance cells on the borders between neighboring clusters plus the two ends of one
+ * staircase link per cluster column and floor pair, and edges inside a cluster carry the cost of
+ * the cheapest route between two of its nodes. Built on the first hierarchical search, then
+ * rebuilt only around cells reported through FPathfinderWorkspace::NotifyCellChanged. Keyed on
+ * the grid's revision like FHallwayCostField, so an unreported edit or a different grid rebuilds it.
+ * Edge costs ignore the per-search source/dest room discount, so they are estimates; the
+ * refined path is always costed exactly.
+ */
+struct DUNGEONCORE_API FHallwayClusterGraph
+{
+	struct FEdge
+	{
+		int32 To;
+		float Cost;
+	};
+
+	struct FNode
+	{
+		FIntVector Cell = FIntVector::ZeroValue;
+		int32 Cluster = INDEX_NONE;
+
+		/** Node across the border, or at the other end of the staircase link. */
+		int32 Partner = INDEX_NONE;
+		float PartnerCost = 0.0f;
+		bool bStaircase = false;
+
+		/** Cheapest routes to other nodes of the same cluster, never leaving it. */
+		TArray<FEdge> Edges;
+	};
+
+	/**
+	 * Attach to Grid for Params' cluster size, costs and staircase shape. Keeps the graph if it is
+	 * current for Grid's revision and none of them changed, otherwise marks every cluster dirty.
+	 */
+	void Bind(const FDungeonGrid& Grid, const FDungeonGenerationParams& Params);
+
+	/**
+	 * Mark every cluster whose nodes or edges could depend on Coord. Like
+	 * FHallwayCostField::UpdateCell, this keeps the graph current only for the one grid write since
+	 * it last was; after any wider gap the graph is left for Bind to rebuild.
+	 */
+	void MarkDirty(const FDungeonGrid& Grid, const FIntVector& Coord);
+
+	/** MarkDirty for every cell in Coords, which must cover all changes since the graph was last current. */
+	void MarkCellsDirty(const FDungeonGrid& Grid, TArrayView<const FIntVector> Coords);
+
+	FORCEINLINE int32 GetClusterSize() const { return ClusterSize; }
+	FORCEINLINE int32 NumClusters() const { return ClusterNodes.Num(); }
+
+	FORCEINLINE int32 ClusterOf(const FIntVector& Coord) const
+	{
+		return Coord.X / ClusterSize + (Coord.Y / ClusterSize) * ClustersX
+			+ Coord.Z * ClustersX * ClustersY;
+	}
+
+	/** Cells of one cluster: a single-floor box, clipped at the grid's far edges. */
+	FPathSearchWindow ClusterBox(int32 Cluster) const;
+
+	FORCEINLINE const FNode& GetNode(int32 NodeIdx) const { return Nodes[NodeIdx]; }
+	FORCEINLINE int32 NumNodeSlots() const { return Nodes.Num(); }
+	FORCEINLINE const TArray<int32>& GetClusterNodes(int32 Cluster) const { return ClusterNodes[Cluster]; }
+
+private:
+	friend struct FHallwayPathfinder;
+
+	/** Per-cluster links: its +X border, its +Y border, and the staircase up to the floor above. */
+	enum ELinkSlot : int32 { EastBorder, NorthBorder, StaircaseUp, NumLinkSlots };
+
+	int32 AddNode(const FIntVector& Cell, int32 Cluster);
+	void RemoveNode(int32 NodeIdx);
+	void MarkDirtyAround(const FIntVector& Coord);
+
+	TArray<FNode> Nodes;
+	TArray<int32> FreeNodes;
+
+	/** Live nodes per cluster. */
+	TArray<TArray<int32>> ClusterNodes;
+
+	/** Nodes created by each link, Cluster * NumLinkSlots + ELinkSlot. */
+	TArray<TArray<int32>> LinkNodes;
+
+	TBitArray<> DirtyClusters;
+	bool bAnyDirty = false;
+
+	/** Grid revision the graph matches once its dirty clusters are rebuilt; 0 is never issued. */
+	uint64 BoundRevision = 0;
+	FIntVector GridSize = FIntVector::ZeroValue;
+	int32 ClusterSize = 0;
+	int32 ClustersX = 0;
+	int32 ClustersY = 0;
+	int32 RiseToRun = 0;
+	int32 HeadroomCells = 0;
+	float HallwayCost = 0.0f;
+	float RoomCost = 0.0f;
+};
+
+/**
+ * FPathfinderWorkspace
+ * Scratch state for FHallwayPathfinder::FindPath, reused across every hallway of a generation.
+ * Per-cell entries are stamped with the search epoch that wrote them, so starting a new search
+ * is O(1): BeginSearch bumps the epoch and stale entries read as "unvisited".
+ * Not thread-safe — give each concurrent search its own workspace.
+ */
+struct DUNGEONCORE_API FPathfinderWorkspace
+{
+	struct FOpenNode
+	{
+		float FScore;
+		int32 CellIdx;
+	};
+
+	/** Grow to NumCells if needed and invalidate everything from the previous search. */
+	void BeginSearch(int32 NumCells);
+
+	FORCEINLINE float GetGScore(int32 Idx) const
+	{
+		return Cells[Idx].VisitEpoch == Epoch ? Cells[Idx].GScore : MAX_flt;
+	}
+
+	FORCEINLINE int32 GetCameFrom(int32 Idx) const
+	{
+		return Cells[Idx].VisitEpoch == Epoch ? Cells[Idx].CameFrom : -1;
+	}
+
+	FORCEINLINE void SetVisited(int32 Idx, float GScore, int32 CameFrom)
+	{
+		FCellState& State = Cells[Idx];
+		State.GScore = GScore;
+		State.CameFrom = CameFrom;
+		State.VisitEpoch = Epoch;
+	}
+
+	FORCEINLINE bool IsClosed(int32 Idx) const { return Cells[Idx].ClosedEpoch == Epoch; }
+	FORCEINLINE void SetClosed(int32 Idx) { Cells[Idx].ClosedEpoch = Epoch; }
+
+	/** Cells claimed by a staircase planned earlier in this search. */
+	FORCEINLINE bool IsStaircaseReserved(int32 Idx) const { return Cells[Idx].ReservedEpoch == Epoch; }
+	FORCEINLINE void SetStaircaseReserved(int32 Idx) { Cells[Idx].ReservedEpoch = Epoch; }
+
+	/** Cells that end this search when popped. */
+	FORCEINLINE bool IsGoal(int32 Idx) const { return Cells[Idx].GoalEpoch == Epoch; }
+	FORCEINLINE void SetGoal(int32 Idx) { Cells[Idx].GoalEpoch = Epoch; }
+
+	/** Pooled open-set heap. Emptied by BeginSearch; capacity is kept. */
+	TArray<FOpenNode> OpenSet;
+
+	/** Pooled radix open set, used instead of OpenSet when bUseRadixOpenSet is on. */
+	FRadixOpenSet RadixOpenSet;
+
+	/**
+	 * Grid-derived caches for the grid this workspace searches. Unlike the rest of the workspace
+	 * they outlive a search, so pass the workspace to CarveHallway (or call NotifyCellChanged)
+	 * whenever that grid changes.
+	 */
+	FHallwayCostField CostField;
+	FStaircaseMaskCache StaircaseMasks;
+
+	/** Bring the grid-derived caches up to date after Coord's cell type changed. */
+	void NotifyCellChanged(const FDungeonGrid& Grid, const FIntVector& Coord);
+
+	/** NotifyCellChanged for a batch of edits; Coords must list every cell changed since the caches were last current. */
+	void NotifyCellsChanged(const FDungeonGrid& Grid, TArrayView<const FIntVector> Coords);
+
+	/**
+	 * Second set of G/CameFrom/closed state for the backward half of a bidirectional search.
+	 * Created on first use. Staircase reservations are shared and live in this (forward) workspace.
+	 */
+	FPathfinderWorkspace& GetBackward();
+
+	/** Abstract graph for Hierarchical searches. Created on first use; kept current by NotifyCellChanged. */
+	FHallwayClusterGraph& GetClusterGraph();
+
+	/**
+	 * Optional dependency tracking for speculative carving. When ExploredCells is set, every A* or
+	 * bidirectional search appends the grid index of each cell it closes, as it closes it; the grid
+	 * cells a search read all lie within staircase reach of those. Jump point scans and Hierarchical
+	 * cluster floods read further and are not covered. When ChangeLog is set, NotifyCellChanged
+	 * appends each changed coordinate. Both are owned and cleared by the caller.
+	 */
+	TArray<int32>* ExploredCells = nullptr;
+	TArray<FIntVector>* ChangeLog = nullptr;
+
+private:
+	struct FCellState
+	{
+		float GScore;
+		int32 CameFrom;
+		uint32 VisitEpoch;
+		uint32 ClosedEpoch;
+		uint32 ReservedEpoch;
+		uint32 GoalEpoch;
+	};
+
+	TArray<FCellState> Cells;
+	uint32 Epoch = 0;
+
+	TUniquePtr<FPathfinderWorkspace> Backward;
+	TUniquePtr<FHallwayClusterGraph> ClusterGraph;
+};
 
 /**
  * FHallwayPathfinder
@@ -19,26 +449,58 @@ struct DUNGEONCORE_API FHallwayPathfinder
 	 * @param Grid            The dungeon grid (read for costs, not modified).
 	 * @param Start           Starting cell (room A center).
 	 * @param End             Ending cell (room B center).
-	 * @param Config          Generation config (cost multipliers, staircase params).
+	 * @param Params          Generation parameters (cost multipliers, staircase params).
 	 * @param SourceRoomIdx   RoomIndex (1-based) of the source room — free to traverse.
 	 * @param DestRoomIdx     RoomIndex (1-based) of the destination room — free to traverse.
 	 * @param OutPath         Ordered cells from Start to End. Staircase transitions appear as
 	 *                        non-adjacent cells with a Z-coordinate change.
+	 * @param OutStats        Optional search counters (nodes expanded, heap ops, staircase probes, time).
+	 * @param Workspace       Optional scratch state reused across calls. A temporary one is used if null.
+	 * @param Window          Optional box to search first. If no path exists inside it, the search
+	 *                        is repeated on the full grid (counted in FPathfindStats::WindowFallbacks).
+	 *                        Hierarchical searches plan over the whole grid; the window only
+	 *                        applies to their flat fallback.
 	 * @return true if a path was found.
 	 */
 	static bool FindPath(
 		const FDungeonGrid& Grid,
 		const FIntVector& Start,
 		const FIntVector& End,
-		const UDungeonConfiguration& Config,
+		const FDungeonGenerationParams& Params,
 		uint8 SourceRoomIdx,
 		uint8 DestRoomIdx,
-		TArray<FIntVector>& OutPath);
+		TArray<FIntVector>& OutPath,
+		FPathfindStats* OutStats = nullptr,
+		FPathfinderWorkspace* Workspace = nullptr,
+		const FPathSearchWindow* Window = nullptr);
+
+	/**
+	 * Multi-source, multi-goal FindPath: the path starts at whichever start cell gives the cheapest
+	 * route and ends at the first goal cell reached. The heuristic measures distance to the goals'
+	 * bounding box. With one cell in each set this behaves exactly like the single-cell overload.
+	 * Every start and goal must be in bounds, and a window is only used if it contains them all.
+	 */
+	static bool FindPath(
+		const FDungeonGrid& Grid,
+		TArrayView<const FIntVector> Starts,
+		TArrayView<const FIntVector> Goals,
+		const FDungeonGenerationParams& Params,
+		uint8 SourceRoomIdx,
+		uint8 DestRoomIdx,
+		TArray<FIntVector>& OutPath,
+		FPathfindStats* OutStats = nullptr,
+		FPathfinderWorkspace* Workspace = nullptr,
+		const FPathSearchWindow* Window = nullptr);
+
+	/** Ground-floor perimeter cells of Room: where a hallway leaving or entering it gets its door. */
+	static void GetRoomBoundaryCells(const FDungeonRoom& Room, TArray<FIntVector>& OutCells);
 
 	/**
 	 * Carve a found path into the grid. Marks non-room cells as Hallway,
 	 * transition cells as Door, and staircase cells as Staircase/StaircaseHead.
+	 * The path's own endpoints become doors only under bMultiGoalHallwaySearch (boundary to boundary).
 	 * @param OutStaircases   Populated with staircase data for any floor transitions in the path.
+	 * @param Workspace       Optional workspace whose grid-derived caches are updated for every cell written.
 	 */
 	static void CarveHallway(
 		FDungeonGrid& Grid,
@@ -46,10 +508,103 @@ struct DUNGEONCORE_API FHallwayPathfinder
 		uint8 HallwayIndex,
 		uint8 SourceRoomIdx,
 		uint8 DestRoomIdx,
-		const UDungeonConfiguration& Config,
-		TArray<FDungeonStaircase>& OutStaircases);
+		const FDungeonGenerationParams& Params,
+		TArray<FDungeonStaircase>& OutStaircases,
+		FPathfinderWorkspace* Workspace = nullptr);
 
 private:
+	/**
+	 * A* restricted to Window. Appends to OutPath only on success; counters accumulate into Stats.
+	 * With bJumpPoints, same-floor moves on the goal floor (when all goals share one) jump across
+	 * uniform Empty runs. BlockedCells start out reserved, as if staircases of this search held them.
+	 */
+	static bool FindPathInWindow(
+		const FDungeonGrid& Grid,
+		TArrayView<const FIntVector> Starts,
+		TArrayView<const FIntVector> Goals,
+		const FDungeonGenerationParams& Params,
+		uint8 SourceRoomIdx,
+		uint8 DestRoomIdx,
+		const FPathSearchWindow& Window,
+		bool bJumpPoints,
+		FPathfinderWorkspace& WS,
+		FPathfindStats& Stats,
+		TArray<FIntVector>& OutPath,
+		TArrayView<const FIntVector> BlockedCells = TArrayView<const FIntVector>());
+
+	/**
+	 * FindPathInWindow's search loop; FindPathInWindow picks the instantiation. bMultiFloor = false
+	 * compiles staircase moves out; non-zero FixedRiseToRun / FixedHeadroom replace the Params
+	 * values with constants, anything else runs the generic <true, 0, 0> kernel.
+	 */
+	template <bool bMultiFloor, int32 FixedRiseToRun, int32 FixedHeadroom>
+	static bool FindPathInWindowKernel(
+		const FDungeonGrid& Grid,
+		TArrayView<const FIntVector> Starts,
+		TArrayView<const FIntVector> Goals,
+		const FDungeonGenerationParams& Params,
+		uint8 SourceRoomIdx,
+		uint8 DestRoomIdx,
+		const FPathSearchWindow& Window,
+		bool bJumpPoints,
+		FPathfinderWorkspace& WS,
+		FPathfindStats& Stats,
+		TArray<FIntVector>& OutPath,
+		TArrayView<const FIntVector> BlockedCells);
+
+	/**
+	 * Bidirectional A* restricted to Window. The backward half walks moves in reverse: a cardinal
+	 * step pays for the cell it leaves, and a staircase up from its entry is searched as a
+	 * staircase down from its exit. Both halves share one staircase reservation set.
+	 * Always uses the binary heap: the stopping rule needs each frontier's exact minimum F. That
+	 * rule is only sound with a consistent heuristic, so both halves scale Manhattan distance by
+	 * the cheapest step cost and route it around the free source/dest rooms (see
+	 * FBidirectionalHeuristic); the result is a cheapest path, never costlier than plain A*'s.
+	 */
+	static bool FindPathBidirectionalInWindow(
+		const FDungeonGrid& Grid,
+		TArrayView<const FIntVector> Starts,
+		TArrayView<const FIntVector> Goals,
+		const FDungeonGenerationParams& Params,
+		uint8 SourceRoomIdx,
+		uint8 DestRoomIdx,
+		const FPathSearchWindow& Window,
+		FPathfinderWorkspace& WS,
+		FPathfindStats& Stats,
+		TArray<FIntVector>& OutPath);
+
+	/**
+	 * HPA*: A* over WS's cluster graph with the starts and goals attached through their own
+	 * clusters, then every leg refined by A* confined to the one cluster it crosses. Border and
+	 * staircase links are single moves. Appends to OutPath only on success.
+	 */
+	static bool FindPathHierarchical(
+		const FDungeonGrid& Grid,
+		TArrayView<const FIntVector> Starts,
+		TArrayView<const FIntVector> Goals,
+		const FDungeonGenerationParams& Params,
+		uint8 SourceRoomIdx,
+		uint8 DestRoomIdx,
+		FPathfinderWorkspace& WS,
+		FPathfindStats& Stats,
+		TArray<FIntVector>& OutPath);
+
+	/** Re-place the links of every dirty cluster, then recompute edges wherever nodes changed. */
+	static void UpdateClusterGraph(
+		const FDungeonGrid& Grid,
+		const FDungeonGenerationParams& Params,
+		FPathfinderWorkspace& WS,
+		FPathfindStats& Stats);
+
+	/** Legal staircase moves from Coord (FStaircaseMaskCache::MoveBit), computed on a cache miss. */
+	static uint8 GetStaircaseMask(
+		const FDungeonGrid& Grid,
+		const FIntVector& Coord,
+		int32 RiseToRun,
+		int32 HeadroomCells,
+		FStaircaseMaskCache& Cache,
+		FPathfindStats& Stats);
+
 	/** Check if all cells needed for a staircase are available (Empty or Hallway). */
 	static bool CanBuildStaircase(
 		const FDungeonGrid& Grid,
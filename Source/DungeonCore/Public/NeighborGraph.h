@@ -0,0 +1,28 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DungeonTypes.h"
+
+/**
+ * FNeighborGraph
+ * Delaunay-free candidate graph for the spanning tree: every point linked to its k nearest
+ * neighbors, found through a uniform grid sized to about two points per cell, so building it is
+ * linear in practice. Optionally pruned to its Gabriel or relative-neighborhood subgraph. The
+ * result is always connected: separate clusters are bridged by their closest pair of points, and
+ * pruned edges are put back, shortest first, wherever pruning split the graph.
+ */
+struct DUNGEONCORE_API FNeighborGraph
+{
+	/**
+	 * Build the candidate graph.
+	 * @param Points         Room center positions in 3D.
+	 * @param NeighborCount  Nearest neighbors linked per point (k), before pruning.
+	 * @param Pruning        Subgraph to reduce the k-nearest-neighbor edges to.
+	 * @param OutEdges       Unique edges as pairs of point indices (0-based, lower index first), sorted.
+	 */
+	static void Build(
+		const TArray<FVector>& Points,
+		int32 NeighborCount,
+		EDungeonNeighborPruning Pruning,
+		TArray<TPair<int32, int32>>& OutEdges);
+};
@@ -5,7 +5,67 @@
 struct FDungeonGrid;
 struct FDungeonRoom;
 struct FDungeonSeed;
-class UDungeonConfiguration;
+struct FDungeonGenerationParams;
+
+/**
+ * FRoomBroadphase
+ * Uniform XY bucket grid over placed rooms, so a placement overlap test only looks at nearby
+ * rooms. Each room is filed under every bucket its footprint touches once grown by the room
+ * buffer on +X/+Y; a candidate grown the same way can only overlap rooms sharing a bucket.
+ */
+struct DUNGEONCORE_API FRoomBroadphase
+{
+	/** Drop every room and cover GridSize with square buckets of BucketSize cells. */
+	void Reset(const FIntVector& GridSize, int32 InBucketSize, int32 InBuffer);
+
+	/** File Rooms[RoomIdx] (already appended) under its buckets. */
+	void Add(int32 RoomIdx, const FDungeonRoom& Room);
+
+	/** Same answer as FRoomPlacement::DoesRoomOverlap against every room added so far. */
+	bool Overlaps(const FIntVector& Position, const FIntVector& Size, const TArray<FDungeonRoom>& Rooms) const;
+
+private:
+	/** Bucket range covered by [Min, Min + Extent + Buffer) on X/Y, clamped to the grid. */
+	void GetBucketRange(const FIntVector& Min, const FIntVector& Extent, FIntPoint& OutMin, FIntPoint& OutMax) const;
+
+	TArray<TArray<int32>> Buckets;
+	int32 BucketSize = 1;
+	int32 BucketsX = 0;
+	int32 BucketsY = 0;
+	int32 Buffer = 0;
+};
+
+/**
+ * FRoomOccupancyTable
+ * 3D summed-area table over placed rooms, each grown by the room buffer on +X/+Y, so whether a
+ * room of a given size fits at a position takes eight lookups. Adding a room folds its box into
+ * the table directly instead of rebuilding it from an occupancy grid.
+ */
+struct DUNGEONCORE_API FRoomOccupancyTable
+{
+	/** Drop every room and size the table for GridSize. */
+	void Reset(const FIntVector& InGridSize, int32 InBuffer);
+
+	/** Mark Room (grown by the buffer on +X/+Y, clamped to the grid) as occupied. */
+	void Add(const FDungeonRoom& Room);
+
+	/** Same answer as FRoomPlacement::DoesRoomOverlap against every room added so far. */
+	bool Fits(const FIntVector& Position, const FIntVector& Size) const;
+
+	/** Occupied-cell count inside [Min, Max), counting cells covered by several grown rooms once per room. */
+	int64 SumBox(const FIntVector& Min, const FIntVector& Max) const;
+
+private:
+	FORCEINLINE int32 TableIndex(int32 X, int32 Y, int32 Z) const
+	{
+		return X + Y * (GridSize.X + 1) + Z * (GridSize.X + 1) * (GridSize.Y + 1);
+	}
+
+	/** Table[x, y, z] = occupied volume inside [0, x) x [0, y) x [0, z); one extra entry per axis. */
+	TArray<int64> Table;
+	FIntVector GridSize = FIntVector::ZeroValue;
+	int32 Buffer = 0;
+};
 
 /**
  * FRoomPlacement
@@ -19,17 +79,42 @@ struct DUNGEONCORE_API FRoomPlacement
 	 */
 	static bool PlaceRooms(
 		FDungeonGrid& Grid,
-		const UDungeonConfiguration& Config,
+		const FDungeonGenerationParams& Params,
 		FDungeonSeed& Seed,
 		TArray<FDungeonRoom>& OutRooms);
 
-private:
+	/** Brute-force overlap test against every room: buffer on XY (hallway space), none on Z. */
 	static bool DoesRoomOverlap(
 		const FIntVector& Position,
 		const FIntVector& Size,
 		const TArray<FDungeonRoom>& ExistingRooms,
 		int32 Buffer);
 
+private:
+	/** EDungeonRoomPlacement::SummedAreaTable: sizes drawn as usual, positions only among those that fit. */
+	static bool PlaceRoomsSummedArea(
+		FDungeonGrid& Grid,
+		const FDungeonGenerationParams& Params,
+		FDungeonSeed& RoomSeed,
+		TArray<FDungeonRoom>& OutRooms);
+
+	/**
+	 * EDungeonRoomPlacement::PoissonDisk: Bridson's algorithm over room centers, with rooms kept
+	 * apart by both the spacing and the usual buffered overlap test.
+	 */
+	static bool PlaceRoomsPoissonDisk(
+		FDungeonGrid& Grid,
+		const FDungeonGenerationParams& Params,
+		FDungeonSeed& RoomSeed,
+		TArray<FDungeonRoom>& OutRooms);
+
+	/** Append a room at Position/Size to OutRooms and stamp it into the grid. */
+	static const FDungeonRoom& AddRoom(
+		FDungeonGrid& Grid,
+		const FIntVector& Position,
+		const FIntVector& Size,
+		TArray<FDungeonRoom>& OutRooms);
+
 	static void StampRoomToGrid(
 		FDungeonGrid& Grid,
 		const FDungeonRoom& Room);
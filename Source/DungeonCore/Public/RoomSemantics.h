@@ -4,7 +4,7 @@
 #include "DungeonTypes.h"
 #include "RoomSemantics.generated.h"
 
-class UDungeonConfiguration;
+struct FDungeonGenerationParams;
 struct FDungeonSeed;
 
 /**
@@ -72,20 +72,20 @@ struct DUNGEONCORE_API FRoomSemanticContext
  */
 struct DUNGEONCORE_API FRoomSemantics
 {
-	/** Pick entrance room index based on Config.EntrancePlacement. Uses RNG for tie-breaking. */
+	/** Pick entrance room index based on Params.EntrancePlacement. Uses RNG for tie-breaking. */
 	static int32 SelectEntranceRoom(
 		const FDungeonResult& Result,
-		const UDungeonConfiguration& Config,
+		const FDungeonGenerationParams& Params,
 		FDungeonSeed& Seed);
 
 	/** BFS from entrance; populates Room.GraphDistanceFromEntrance, Room.bOnMainPath, returns contexts. */
 	static TArray<FRoomSemanticContext> ComputeGraphMetrics(
 		FDungeonResult& Result);
 
-	/** Assign room types from Config.RoomTypeRules using priority + scoring. Modifies Result.Rooms[].RoomType. */
+	/** Assign room types from Params.RoomTypeRules using priority + scoring. Modifies Result.Rooms[].RoomType. */
 	static void AssignRoomTypes(
 		FDungeonResult& Result,
-		const UDungeonConfiguration& Config,
+		const FDungeonGenerationParams& Params,
 		const TArray<FRoomSemanticContext>& Contexts,
 		FDungeonSeed& Seed);
 };
@@ -5,6 +5,7 @@
 #include "DungeonTileSet.h"
 #include "DungeonTileMapper.h"
 #include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Async/Async.h"
 
 #if WITH_EDITOR
 #include "DrawDebugHelpers.h"
@@ -21,26 +22,39 @@ ADungeonActor::ADungeonActor()
 	SetRootComponent(Root);
 }
 
-void ADungeonActor::GenerateDungeon()
+bool ADungeonActor::CanGenerate(const TCHAR* Caller) const
 {
 	if (!DungeonConfig)
 	{
-		UE_LOG(LogDungeonOutput, Error, TEXT("ADungeonActor::GenerateDungeon — DungeonConfig is null"));
-		return;
+		UE_LOG(LogDungeonOutput, Error, TEXT("ADungeonActor::%s — DungeonConfig is null"), Caller);
+		return false;
 	}
 
 	if (!TileSet)
 	{
-		UE_LOG(LogDungeonOutput, Error, TEXT("ADungeonActor::GenerateDungeon — TileSet is null"));
-		return;
+		UE_LOG(LogDungeonOutput, Error, TEXT("ADungeonActor::%s — TileSet is null"), Caller);
+		return false;
 	}
 
 	if (!TileSet->IsValid())
 	{
-		UE_LOG(LogDungeonOutput, Error, TEXT("ADungeonActor::GenerateDungeon — TileSet has no valid meshes"));
+		UE_LOG(LogDungeonOutput, Error, TEXT("ADungeonActor::%s — TileSet has no valid meshes"), Caller);
+		return false;
+	}
+
+	return true;
+}
+
+void ADungeonActor::GenerateDungeon()
+{
+	if (!CanGenerate(TEXT("GenerateDungeon")))
+	{
 		return;
 	}
 
+	// A synchronous generation supersedes any async one still running
+	CancelAsyncGeneration();
+
 	// Clear previous generation
 	if (bHasDungeon)
 	{
@@ -55,6 +69,69 @@ void ADungeonActor::GenerateDungeon()
 		CachedResult.Rooms.Num(), CachedResult.Hallways.Num(),
 		CachedResult.Staircases.Num(), CachedResult.GenerationTimeMs);
 
+	BuildTileComponents();
+}
+
+void ADungeonActor::GenerateDungeonAsync()
+{
+	if (!CanGenerate(TEXT("GenerateDungeonAsync")))
+	{
+		return;
+	}
+
+	CancelAsyncGeneration();
+
+	TSharedPtr<FDungeonGenerationProgress> Progress = MakeShared<FDungeonGenerationProgress>();
+	PendingProgress = Progress;
+
+	TWeakObjectPtr<ADungeonActor> WeakThis(this);
+	UDungeonGenerator::GenerateAsync(DungeonConfig, Seed, Progress)
+		.Next([WeakThis, Progress](FDungeonResult Result)
+		{
+			// Tile components can only be created on the game thread
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, Progress, Result = MoveTemp(Result)]() mutable
+			{
+				ADungeonActor* This = WeakThis.Get();
+				if (!This || This->PendingProgress != Progress || Progress->WasCancelled())
+				{
+					return; // Actor gone, superseded by a newer request, or cancelled
+				}
+
+				This->PendingProgress.Reset();
+
+				if (This->bHasDungeon)
+				{
+					This->ClearDungeon();
+				}
+
+				This->CachedResult = MoveTemp(Result);
+
+				UE_LOG(LogDungeonOutput, Log, TEXT("Generated dungeon (async): %d rooms, %d hallways, %d staircases in %.1fms"),
+					This->CachedResult.Rooms.Num(), This->CachedResult.Hallways.Num(),
+					This->CachedResult.Staircases.Num(), This->CachedResult.GenerationTimeMs);
+
+				This->BuildTileComponents();
+				This->OnDungeonGenerated.Broadcast();
+			});
+		});
+}
+
+void ADungeonActor::CancelAsyncGeneration()
+{
+	if (PendingProgress.IsValid())
+	{
+		PendingProgress->Cancel();
+		PendingProgress.Reset();
+	}
+}
+
+void ADungeonActor::BuildTileComponents()
+{
+	if (!TileSet)
+	{
+		return;
+	}
+
 	// Map grid to tile transforms
 	FDungeonTileMapResult TileMap = FDungeonTileMapper::MapToTiles(
 		CachedResult, *TileSet, GetActorLocation());
@@ -221,6 +298,12 @@ int32 ADungeonActor::GetTotalInstanceCount() const
 	return Total;
 }
 
+void ADungeonActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	CancelAsyncGeneration();
+	Super::EndPlay(EndPlayReason);
+}
+
 void ADungeonActor::Tick(float DeltaSeconds)
 {
 	Super::Tick(DeltaSeconds);
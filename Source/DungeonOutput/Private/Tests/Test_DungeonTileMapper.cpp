@@ -46,8 +46,8 @@ namespace DungeonTileMapperTestHelpers
 		{
 			for (int32 X = 0; X < 5; ++X)
 			{
-				Result.Grid.GetCell(X, Y, 0).CellType = EDungeonCellType::RoomWall;
-				Result.Grid.GetCell(X, Y, 0).RoomIndex = 1;
+				Result.Grid.GetCellForWrite(X, Y, 0).CellType = EDungeonCellType::RoomWall;
+				Result.Grid.GetCellForWrite(X, Y, 0).RoomIndex = 1;
 			}
 		}
 
@@ -56,8 +56,8 @@ namespace DungeonTileMapperTestHelpers
 		{
 			for (int32 X = 1; X <= 3; ++X)
 			{
-				Result.Grid.GetCell(X, Y, 0).CellType = EDungeonCellType::Room;
-				Result.Grid.GetCell(X, Y, 0).RoomIndex = 1;
+				Result.Grid.GetCellForWrite(X, Y, 0).CellType = EDungeonCellType::Room;
+				Result.Grid.GetCellForWrite(X, Y, 0).RoomIndex = 1;
 			}
 		}
 
@@ -91,35 +91,35 @@ namespace DungeonTileMapperTestHelpers
 		// Default all to Empty
 		for (int32 Y = 0; Y < 5; ++Y)
 			for (int32 X = 0; X < 11; ++X)
-				Result.Grid.GetCell(X, Y, 0).CellType = EDungeonCellType::Empty;
+				Result.Grid.GetCellForWrite(X, Y, 0).CellType = EDungeonCellType::Empty;
 
 		// Room A: walls at x=[0..4], y=[0..4], interior room at x=[1..3], y=[1..3]
 		for (int32 Y = 0; Y < 5; ++Y)
 			for (int32 X = 0; X < 5; ++X)
-				Result.Grid.GetCell(X, Y, 0).CellType = EDungeonCellType::RoomWall;
+				Result.Grid.GetCellForWrite(X, Y, 0).CellType = EDungeonCellType::RoomWall;
 		for (int32 Y = 1; Y <= 3; ++Y)
 			for (int32 X = 1; X <= 3; ++X)
-				Result.Grid.GetCell(X, Y, 0).CellType = EDungeonCellType::Room;
+				Result.Grid.GetCellForWrite(X, Y, 0).CellType = EDungeonCellType::Room;
 
 		// Room B: walls at x=[8..10], y=[0..4], interior at x=[9..10], y=[1..3]
 		// (using 3-wide room at x=[8..10])
 		for (int32 Y = 0; Y < 5; ++Y)
 			for (int32 X = 8; X < 11; ++X)
-				Result.Grid.GetCell(X, Y, 0).CellType = EDungeonCellType::RoomWall;
+				Result.Grid.GetCellForWrite(X, Y, 0).CellType = EDungeonCellType::RoomWall;
 		for (int32 Y = 1; Y <= 3; ++Y)
 			for (int32 X = 9; X <= 10; ++X)
-				Result.Grid.GetCell(X, Y, 0).CellType = EDungeonCellType::Room;
+				Result.Grid.GetCellForWrite(X, Y, 0).CellType = EDungeonCellType::Room;
 
 		// Hallway at y=2, x=[5..7]
 		for (int32 X = 5; X <= 7; ++X)
 		{
-			Result.Grid.GetCell(X, 2, 0).CellType = EDungeonCellType::Hallway;
-			Result.Grid.GetCell(X, 2, 0).HallwayIndex = 1;
+			Result.Grid.GetCellForWrite(X, 2, 0).CellType = EDungeonCellType::Hallway;
+			Result.Grid.GetCellForWrite(X, 2, 0).HallwayIndex = 1;
 		}
 
 		// Doors connecting rooms to hallway
-		Result.Grid.GetCell(4, 2, 0).CellType = EDungeonCellType::Door;
-		Result.Grid.GetCell(8, 2, 0).CellType = EDungeonCellType::Door;
+		Result.Grid.GetCellForWrite(4, 2, 0).CellType = EDungeonCellType::Door;
+		Result.Grid.GetCellForWrite(8, 2, 0).CellType = EDungeonCellType::Door;
 
 		Result.EntranceRoomIndex = -1;
 		return Result;
@@ -141,14 +141,14 @@ namespace DungeonTileMapperTestHelpers
 			{
 				for (int32 X = 0; X < 5; ++X)
 				{
-					Result.Grid.GetCell(X, Y, Z).CellType = EDungeonCellType::RoomWall;
+					Result.Grid.GetCellForWrite(X, Y, Z).CellType = EDungeonCellType::RoomWall;
 				}
 			}
 			for (int32 Y = 1; Y <= 3; ++Y)
 			{
 				for (int32 X = 1; X <= 3; ++X)
 				{
-					Result.Grid.GetCell(X, Y, Z).CellType = EDungeonCellType::Room;
+					Result.Grid.GetCellForWrite(X, Y, Z).CellType = EDungeonCellType::Room;
 				}
 			}
 		}
@@ -323,8 +323,8 @@ bool FTileMapperStaircaseExists::RunTest(const FString& Parameters)
 	Result.Grid.Initialize(FIntVector(3, 3, 2));
 
 	// Place a staircase cell at (1,1,0) going +X
-	Result.Grid.GetCell(1, 1, 0).CellType = EDungeonCellType::Staircase;
-	Result.Grid.GetCell(1, 1, 0).StaircaseDirection = 0; // +X
+	Result.Grid.GetCellForWrite(1, 1, 0).CellType = EDungeonCellType::Staircase;
+	Result.Grid.GetCellForWrite(1, 1, 0).StaircaseDirection = 0; // +X
 	Result.EntranceRoomIndex = -1;
 
 	FDungeonTileMapResult TileMap = FDungeonTileMapper::MapToTiles(Result, *TS, FVector::ZeroVector);
@@ -356,8 +356,8 @@ bool FTileMapperStaircaseRotation::RunTest(const FString& Parameters)
 		Result.GridSize = FIntVector(3, 3, 1);
 		Result.CellWorldSize = 400.0f;
 		Result.Grid.Initialize(FIntVector(3, 3, 1));
-		Result.Grid.GetCell(1, 1, 0).CellType = EDungeonCellType::Staircase;
-		Result.Grid.GetCell(1, 1, 0).StaircaseDirection = static_cast<uint8>(Dir);
+		Result.Grid.GetCellForWrite(1, 1, 0).CellType = EDungeonCellType::Staircase;
+		Result.Grid.GetCellForWrite(1, 1, 0).StaircaseDirection = static_cast<uint8>(Dir);
 		Result.EntranceRoomIndex = -1;
 
 		FDungeonTileMapResult TileMap = FDungeonTileMapper::MapToTiles(Result, *TS, FVector::ZeroVector);
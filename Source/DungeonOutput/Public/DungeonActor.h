@@ -9,6 +9,9 @@
 class UDungeonConfiguration;
 class UDungeonTileSet;
 class UHierarchicalInstancedStaticMeshComponent;
+struct FDungeonGenerationProgress;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnDungeonActorGenerated);
 
 /**
  * Blueprint-exposed actor that generates and displays a dungeon.
@@ -39,6 +42,26 @@ public:
 	UFUNCTION(BlueprintCallable, CallInEditor, Category = "Dungeon")
 	void GenerateDungeon();
 
+	/**
+	 * Generate the dungeon on a background task, then create tile geometry on the game thread.
+	 * The previous dungeon stays visible until the new one is ready. Starting a new generation
+	 * cancels any generation still in flight.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dungeon")
+	void GenerateDungeonAsync();
+
+	/** Cancel an in-flight GenerateDungeonAsync. No-op if nothing is pending. */
+	UFUNCTION(BlueprintCallable, Category = "Dungeon")
+	void CancelAsyncGeneration();
+
+	/** Returns true while a GenerateDungeonAsync call is in flight. */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Dungeon")
+	bool IsGeneratingAsync() const { return PendingProgress.IsValid(); }
+
+	/** Fired on the game thread after GenerateDungeonAsync has built the tile geometry. */
+	UPROPERTY(BlueprintAssignable, Category = "Dungeon")
+	FOnDungeonActorGenerated OnDungeonGenerated;
+
 	/** Destroy all tile geometry. */
 	UFUNCTION(BlueprintCallable, CallInEditor, Category = "Dungeon")
 	void ClearDungeon();
@@ -111,6 +134,7 @@ public:
 
 	// AActor interface
 	virtual void Tick(float DeltaSeconds) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual bool ShouldTickIfViewportsOnly() const override;
 
 #if WITH_EDITOR
@@ -126,6 +150,15 @@ private:
 
 	bool bHasDungeon = false;
 
+	/** Progress of the in-flight async generation. Null when idle. */
+	TSharedPtr<FDungeonGenerationProgress> PendingProgress;
+
+	/** Log an error and return false if config or tile set are missing. */
+	bool CanGenerate(const TCHAR* Caller) const;
+
+	/** Create HISMC components for CachedResult. */
+	void BuildTileComponents();
+
 #if WITH_EDITOR
 	void DrawDebugVisualization();
 	void UpdateTickState();